@@ -95,6 +95,7 @@
   AvidaRun* testWorld;
   Avida::Viewer::OrganismTracePtr trace;
   int curSnapshotIndex;
+  Avida::Viewer::HardwareSnapshot* curSnapshot; // copy of the displayed step, trace references go stale
   
   AvidaEDEnvActionsDataSource* envActions;
   
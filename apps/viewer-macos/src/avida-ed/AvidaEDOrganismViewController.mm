@@ -83,10 +83,17 @@ static const CGFloat SPLIT_RIGHT_MIN = 202;
 
   if (snapshot >= 0 && snapshot < trace->SnapshotCount()) {
     curSnapshotIndex = snapshot;
-    [self setTaskCountsWithSnapshot:trace->Snapshot(snapshot)];
-    [self setStateDisplayWithSnapshot:trace->Snapshot(snapshot)];
-    [orgView setSnapshot:&trace->Snapshot(snapshot)];
+    
+    // The org view draws from this snapshot later on, so it gets a copy of its own rather than a trace reference
+    if (!curSnapshot) curSnapshot = new Avida::Viewer::HardwareSnapshot(0);
+    *curSnapshot = trace->Snapshot(snapshot);
+    [self setTaskCountsWithSnapshot:*curSnapshot];
+    [self setStateDisplayWithSnapshot:*curSnapshot];
+    [orgView setSnapshot:curSnapshot];
     [timelineView setCurrentPoint:snapshot];
+    
+    [sldStatus setToolTip:[NSString stringWithFormat:@"Trace of %d steps: %.1f KB stored, %.1f KB peak",
+                           trace->SnapshotCount(), trace->StorageSize() / 1024.0, trace->PeakMemoryUsage() / 1024.0]];
   }
   
   [sldStatus setIntValue:curSnapshotIndex];
@@ -345,10 +352,17 @@ static const CGFloat SPLIT_RIGHT_MIN = 202;
   if (self) {
     tmrAnim = nil;
     testWorld = world;
+    curSnapshot = NULL;
   }
   return self;
 }
 
+
+- (void) dealloc {
+  delete curSnapshot;
+  curSnapshot = NULL;
+}
+
 - (void) loadView {
   [super loadView];
   [self viewDidLoad];
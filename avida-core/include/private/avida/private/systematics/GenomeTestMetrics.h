@@ -28,6 +28,7 @@
 #include "avida/systematics/Group.h"
 
 class cAvidaContext;
+class cGenomeTestService;
 class cWorld;
 
 
@@ -51,10 +52,14 @@ namespace Avida {
     
     class GenomeTestMetrics : public GroupData
     {
+      friend class ::cGenomeTestService;
     public:
       static const Apto::String ObjectKey;
       
     private:
+      bool m_pending;   // Queued with the test service and not yet collected (submitting thread only)
+      bool m_done;      // Set by the test service, under its lock, once the values below are filled in
+      
       bool m_is_viable;
       double m_fitness;
       double m_colony_fitness;
@@ -65,8 +70,11 @@ namespace Avida {
       Apto::Array<int> m_task_counts;
       
       
+      LIB_EXPORT GenomeTestMetrics();
       LIB_EXPORT GenomeTestMetrics(cWorld* world, cAvidaContext& ctx, GroupPtr bg);
       
+      void evaluate(cWorld* world, cAvidaContext& ctx, const Genome& genome);
+      
     public:
       LIB_EXPORT ~GenomeTestMetrics();
       
@@ -82,7 +90,16 @@ namespace Avida {
       LIB_EXPORT const Apto::Array<int>& GetTaskCounts() const { return m_task_counts; }
       
       
+      // Returns the metrics for the group, testing it on the spot if needed or waiting for a background test already
+      // under way.  A background test still in the queue is run on the calling thread instead.
       LIB_EXPORT static GenomeTestMetricsPtr GetMetrics(cWorld* world, cAvidaContext& ctx, GroupPtr bg);
+      
+      // Returns the metrics only if they are already available, otherwise queues a background test and returns NULL.
+      // Without a test service running this behaves exactly like GetMetrics.
+      LIB_EXPORT static GenomeTestMetricsPtr GetMetricsIfReady(cWorld* world, cAvidaContext& ctx, GroupPtr bg);
+      
+      // Queues a background test of the group, if the test service is running and it has not been tested already
+      LIB_EXPORT static void RequestMetrics(cWorld* world, GroupPtr bg);
     };
     
   };
@@ -77,6 +77,11 @@ namespace Avida {
       int m_last_num_organisms;
       int m_total_organisms;
       
+      // Contribution currently recorded in the arbiter's incremental statistics
+      int m_stats_units;
+      bool m_stats_threshold;
+      int m_genome_size;
+      
       Apto::Array<GenotypePtr> m_parents;
       Apto::String m_parent_str;
       
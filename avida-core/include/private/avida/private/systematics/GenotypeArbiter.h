@@ -47,15 +47,26 @@ namespace Avida {
         EVENT_REMOVE_THRESHOLD
       };
       
-      static const int HASH_SIZE = 3203;
-      
     private:
       // Config Settings
       int m_threshold;
       bool m_disable_class;
       
       // Internal Data Structures
-      Apto::List<GenotypePtr, Apto::SparseVector> m_active_hash[HASH_SIZE];
+      struct ActiveEntry
+      {
+        unsigned long long fingerprint;
+        unsigned int serial;    // Insertion order, the most recently added of several matching genotypes is used
+        GenotypePtr genotype;   // NULL when the slot is empty or deleted
+        bool deleted;
+        
+        ActiveEntry() : fingerprint(0), serial(0), deleted(false) { ; }
+      };
+      Apto::Array<ActiveEntry> m_active_table;  // Open addressing (linear probing), keyed by genome fingerprint
+      int m_active_entries;
+      int m_active_used;                        // Live plus deleted slots
+      unsigned int m_active_serial;
+      Apto::Map<int, GenotypePtr> m_id_index;   // All active and historic genotypes by ID
       Apto::Array<Apto::List<GenotypePtr, Apto::SparseVector>, Apto::ManagedPointer> m_active_sz;
       Apto::List<GenotypePtr, Apto::SparseVector> m_historic;
       GenotypePtr m_coalescent;
@@ -67,6 +78,35 @@ namespace Avida {
       
       Update m_cur_update;
       
+      // Running sums of unit-weighted age terms, referenced to m_stats_update (see AgeSums::Shift)
+      struct AgeSums
+      {
+        long long units;  // sum(u)
+        double age;       // sum(u * age)
+        long long u2;     // sum(u^2)
+        double u2_age;    // sum(u^2 * age)
+        double u2_age2;   // sum(u^2 * age^2)
+        
+        AgeSums() : units(0), age(0.0), u2(0), u2_age(0.0), u2_age2(0.0) { ; }
+        
+        inline void Add(int u, double a, int sign);
+        inline void Shift(double d);
+      };
+      
+      // Incrementally maintained statistics, updated whenever a genotype changes size list (see refreshStats).  Counts
+      // are kept exactly; the double moments can outgrow exact integer range, so they are rebuilt from the size lists
+      // every STATS_REBUILD_INTERVAL updates to keep rounding from accumulating.
+      static const int STATS_REBUILD_INTERVAL = 1000;
+      Update m_stats_update;
+      Update m_stats_rebuild_update;
+      AgeSums m_stats_all;
+      AgeSums m_stats_threshold;
+      long long m_stats_groups;   // genotypes with at least one unit
+      double m_stats_depth;       // sum(u * depth)
+      double m_stats_depth2;      // sum((u * depth)^2)
+      double m_stats_size;        // sum(u * size)
+      double m_stats_size2;       // sum((u * size)^2)
+      
       // Stats
       int m_tot_genotypes;
       
@@ -157,10 +197,17 @@ namespace Avida {
       template <class T> Data::PackagePtr packageData(const T&) const;
       Data::ProviderPtr activateProvider(World*);
       
-      unsigned int hashGenome(const InstructionSequence& genome) const;
+      unsigned long long hashGenome(const InstructionSequence& genome) const;
+      void insertActive(GenotypePtr genotype, unsigned long long fingerprint);
+      void removeActive(GenotypePtr genotype, unsigned long long fingerprint);
+      GenotypePtr findActive(UnitPtr u, unsigned long long fingerprint);
+      void resizeActiveTable(int size);
       Apto::String nameGenotype(int size);
       
       void removeGenotype(GenotypePtr genotype);
+      void refreshStats(GenotypePtr genotype, int units);
+      void applyStats(GenotypePtr genotype, int units, bool threshold, int sign);
+      void rebuildStats();
       void updateCoalescent();
       
       inline void resizeActiveList(int size);
@@ -191,6 +238,24 @@ namespace Avida {
       if (m_active_sz.GetSize() <= size) m_active_sz.Resize(size + 1);
     }
 
+    inline void GenotypeArbiter::AgeSums::Add(int u, double a, int sign)
+    {
+      const double du = u;
+      units += sign * u;
+      age += sign * du * a;
+      u2 += sign * (long long)u * u;
+      u2_age += sign * du * du * a;
+      u2_age2 += sign * (du * a) * (du * a);
+    }
+    
+    inline void GenotypeArbiter::AgeSums::Shift(double d)
+    {
+      // Every age grows by d: sum(u^2 (a + d)^2) = sum(u^2 a^2) + 2d sum(u^2 a) + d^2 sum(u^2)
+      age += d * units;
+      u2_age2 += 2.0 * d * u2_age + d * d * u2;
+      u2_age += d * u2;
+    }
+
     inline GenotypePtr GenotypeArbiter::getBest()
     {
       return (m_best) ? m_active_sz[m_best].GetFirst() : GenotypePtr(NULL);
@@ -0,0 +1,122 @@
+/*
+ *  private/viewer/SnapshotDelta.h
+ *  Avida
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Authors: David M. Bryson <david@programerror.com>
+ *
+ */
+
+#ifndef AvidaViewerPrivateSnapshotDelta_h
+#define AvidaViewerPrivateSnapshotDelta_h
+
+#include "avida/viewer/OrganismTrace.h"
+
+
+namespace Avida {
+  namespace Viewer {
+    namespace Private {
+      
+      // SnapshotDelta
+      // --------------------------------------------------------------------------------------------------------------
+      
+      // Differences between two consecutive snapshots of a trace.  Memory space changes are recorded as a single splice
+      // spanning everything between the common prefix and suffix, which covers copy writes, inserts, deletes and growth
+      // of the offspring.  Buffers, function counts and heads are recorded per entry, or replaced outright when their key
+      // sets differ.  Applying the delta to a copy of the earlier snapshot reproduces the later one exactly, which
+      // SameSnapshot() compares field by field.
+      
+      class SnapshotDelta
+      {
+      private:
+        struct RegisterChange
+        {
+          int idx;
+          int value;
+        };
+        
+        struct MemSpaceChange
+        {
+          int mem_space;
+          bool relabeled;
+          Apto::String label;
+          int start;
+          int removed;
+          Apto::Array<Instruction> memory;
+          Apto::Array<bool> mutated;
+          bool heads_changed;
+          Apto::Array<Apto::String> head_labels;
+          Apto::Array<int> head_positions;
+        };
+        
+        struct JumpChange
+        {
+          int idx;
+          HardwareSnapshot::Jump jump;
+        };
+        
+        const cInstSet* m_inst_set;
+        
+        int m_num_registers;
+        Apto::Array<RegisterChange> m_registers;
+        
+        bool m_buffers_replaced;
+        Apto::Array<Apto::String> m_buffer_labels;
+        Apto::Array<Apto::Array<int> > m_buffer_values;
+        bool m_selected_buffer_changed;
+        Apto::String m_selected_buffer;
+        
+        bool m_function_counts_replaced;
+        Apto::Array<Apto::String> m_function_names;
+        Apto::Array<int> m_function_counts;
+        
+        int m_num_mem_spaces;
+        Apto::Array<MemSpaceChange, Apto::ManagedPointer> m_mem_spaces;
+        
+        int m_num_jumps;
+        Apto::Array<JumpChange> m_jumps;
+        
+        Instruction m_next_inst;
+        bool m_post_divide;
+        
+        
+        SnapshotDelta(); // @not_implemented
+        SnapshotDelta(const SnapshotDelta&); // @not_implemented
+        SnapshotDelta& operator=(const SnapshotDelta&); // @not_implemented
+        
+      public:
+        LIB_LOCAL SnapshotDelta(const HardwareSnapshot& prev, const HardwareSnapshot& cur);
+        
+        LIB_LOCAL void ApplyTo(HardwareSnapshot& snapshot) const;
+        LIB_LOCAL size_t MemoryUsage() const;
+        
+        LIB_LOCAL static bool SameSnapshot(const HardwareSnapshot& a, const HardwareSnapshot& b);
+        
+      private:
+        LIB_LOCAL void diffMemSpace(int idx, const HardwareSnapshot::MemSpace* prev,
+                                    const HardwareSnapshot::MemSpace& cur);
+        
+        template <typename T> LIB_LOCAL static bool sameKeys(const Apto::Map<Apto::String, T>& a,
+                                                             const Apto::Map<Apto::String, T>& b);
+        LIB_LOCAL static bool sameValues(const Apto::Array<int>& a, const Apto::Array<int>& b);
+      };
+      
+    };
+  };
+};
+
+#endif
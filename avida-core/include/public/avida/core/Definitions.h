@@ -62,6 +62,7 @@ enum eTIMESLICE
   SLICE_DEME_PROB_MERIT,
   SLICE_PROB_DEMESIZE_PROB_MERIT,
   SLICE_PROB_INTEGRATED_MERIT,
+  SLICE_BATCHED_PROB_MERIT,
 };
 
 enum ePOSITION_OFFSPRING
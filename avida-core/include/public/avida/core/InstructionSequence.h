@@ -135,7 +135,8 @@ namespace Avida {
     static int FindHammingDistance(const InstructionSequence& seq1, const InstructionSequence& seq2, int offset = 0);
     static int FindBestOffset(const InstructionSequence& seq1, const InstructionSequence& seq2);
     static int FindSlidingDistance(const InstructionSequence& seq1, const InstructionSequence& seq2);
-    static int FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2);
+    // With max_dist >= 0, any distance greater than max_dist is reported as max_dist + 1
+    static int FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2, int max_dist = -1);
     
     
   protected:
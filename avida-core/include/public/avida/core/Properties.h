@@ -335,6 +335,17 @@ namespace Avida {
     
     LIB_EXPORT virtual bool Serialize(ArchivePtr ar) const = 0;
     
+    
+    // Property IDs interned to dense, process wide indices.  Intern a name once, when the property is registered or
+    // a provider is set up, then read values through the typed lookups by index.  Maps that can address their
+    // properties directly override these to skip hashing the name and building a temporary Property; the defaults
+    // look the name up through Get().
+    LIB_EXPORT static int Intern(const PropertyID& p_id);
+    LIB_EXPORT static PropertyID InternedID(int p_idx);
+    
+    LIB_EXPORT virtual double GetDouble(int p_idx) const;
+    LIB_EXPORT virtual int GetInt(int p_idx) const;
+    
   private:
     // Disallow copying
     PropertyMap(const PropertyMap&);
@@ -37,11 +37,18 @@ class cWorld;
 namespace Avida {
   namespace Viewer {    
     
+    namespace Private {
+      class SnapshotDelta;
+      class SnapshotTracer;
+    };
+    
+    
     // HardwareSnapshot
     // --------------------------------------------------------------------------------------------------------------  
     
     class HardwareSnapshot
     {
+      friend class Private::SnapshotDelta;
     private:
       const cInstSet* m_inst_set;
       
@@ -118,19 +125,49 @@ namespace Avida {
       
       // Internal Access Methods
       LIB_LOCAL const Apto::Array<bool>& MutatedStateOfMemSpace(int idx) const;
+      LIB_LOCAL size_t MemoryUsage() const;
     };
     
 
     // OrganismTrace
     // --------------------------------------------------------------------------------------------------------------  
     
+    // Snapshots are stored as a full keyframe every KEYFRAME_INTERVAL steps, with the steps in between recorded as
+    // deltas against the step before.  Snapshot() rebuilds the requested step from its keyframe, or from a recently
+    // rebuilt earlier step, and keeps the last SNAPSHOT_CACHE_SIZE rebuilt steps.  A returned reference remains valid
+    // until that many other steps have been requested, so callers that keep a step around should keep a copy of it.
+    
     class OrganismTrace
-    {      
+    {
+      friend class Private::SnapshotTracer;
     private:
+      static const int KEYFRAME_INTERVAL = 64;
+      static const int SNAPSHOT_CACHE_SIZE = 8;
+      
       GenomePtr m_genome;
-      Apto::Array<HardwareSnapshot*> m_snapshots;
       GenomePtr m_offspring_genome;
       
+      int m_snapshot_count;
+      Apto::Array<HardwareSnapshot*> m_keyframes;
+      Apto::Array<Private::SnapshotDelta*> m_deltas;  // delta from the previous step, NULL for keyframes
+      HardwareSnapshot* m_last_snapshot;              // most recent step, only held while tracing
+      
+      struct CachedSnapshot
+      {
+        int step;
+        int last_use;
+        HardwareSnapshot* snapshot;
+      };
+      mutable CachedSnapshot m_cache[SNAPSHOT_CACHE_SIZE];
+      mutable int m_cache_clock;
+      
+      size_t m_storage_size;
+      mutable size_t m_peak_memory;
+      
+      
+      OrganismTrace(const OrganismTrace&); // @not_implemented
+      OrganismTrace& operator=(const OrganismTrace&); // @not_implemented
+      
     public:
       LIB_EXPORT OrganismTrace(cWorld* world, GenomePtr genome, double mut_rate = 0.0, int seed = -1);
       LIB_EXPORT ~OrganismTrace();
@@ -138,8 +175,18 @@ namespace Avida {
       LIB_EXPORT inline ConstGenomePtr OrganismGenome() const { return m_genome; }
       LIB_EXPORT inline ConstGenomePtr OffspringGenome() const { return m_offspring_genome; }
       
-      LIB_EXPORT inline int SnapshotCount() const { return m_snapshots.GetSize(); }
-      LIB_EXPORT inline const HardwareSnapshot& Snapshot(int idx) const { return *m_snapshots[idx]; }      
+      LIB_EXPORT inline int SnapshotCount() const { return m_snapshot_count; }
+      LIB_EXPORT const HardwareSnapshot& Snapshot(int idx) const;
+      
+      // Estimated bytes held by the stored keyframes and deltas, and the most held at any one time while tracing or
+      // rebuilding snapshots
+      LIB_EXPORT inline size_t StorageSize() const { return m_storage_size; }
+      LIB_EXPORT inline size_t PeakMemoryUsage() const { return m_peak_memory; }
+      
+    private:
+      LIB_LOCAL void addSnapshot(HardwareSnapshot* snapshot);
+      LIB_LOCAL void finishTrace();
+      LIB_LOCAL void updatePeakMemoryUsage(size_t working_size) const;
     };
     
   };
@@ -3988,8 +3988,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cConnectionList cellA_list = cellA.ConnectionList();
+      cConnectionList cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4065,8 +4065,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cConnectionList cellA_list = cellA.ConnectionList();
+      cConnectionList cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4127,8 +4127,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cConnectionList cellA_list = cellA.ConnectionList();
+      cConnectionList cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4203,8 +4203,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cConnectionList cellA_list = cellA.ConnectionList();
+      cConnectionList cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4262,8 +4262,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cConnectionList cellA_list = cellA.ConnectionList();
+    cConnectionList cellB_list = cellB.ConnectionList();
     cellA_list.PushRear(&cellB);
     cellB_list.PushRear(&cellA);
   }
@@ -4302,8 +4302,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cConnectionList cellA_list = cellA.ConnectionList();
+    cConnectionList cellB_list = cellB.ConnectionList();
     cellA_list.Remove(&cellB);
     cellB_list.Remove(&cellA);
   }
@@ -5655,6 +5655,12 @@ public:
 		cInstSet& is = m_world->GetHardwareManager().GetInstSet("(default)");
 		Instruction inst = is.GetInst(m_inst_name);
 		is.SetProbFail(inst, m_prob);
+    
+    // Running organisms may have bound an execute loop that does not test for instruction failure
+    cPopulation& pop = m_world->GetPopulation();
+    for (int i = 0; i < pop.GetSize(); i++) {
+      if (pop.GetCell(i).IsOccupied()) pop.GetCell(i).GetOrganism()->GetHardware().BindSingleProcess();
+    }
 	}
 };
 
@@ -111,6 +111,7 @@ STATS_OUT_FILE(PrintTimeData,               time.dat            );
 STATS_OUT_FILE(PrintExtendedTimeData,       xtime.dat           );
 STATS_OUT_FILE(PrintMutationRateData,       mutation_rates.dat  );
 STATS_OUT_FILE(PrintDivideMutData,          divide_mut.dat      );
+STATS_OUT_FILE(PrintTestResultCacheData,    test_cache.dat      );
 STATS_OUT_FILE(PrintParasiteData,           parasite.dat        );
 STATS_OUT_FILE(PrintPreyAverageData,        prey_average.dat   );
 STATS_OUT_FILE(PrintPredatorAverageData,    predator_average.dat   );
@@ -5299,6 +5300,7 @@ void RegisterPrintActions(cActionLibrary* action_lib)
   action_lib->Register<cActionPrintExtendedTimeData>("PrintExtendedTimeData");
   action_lib->Register<cActionPrintMutationRateData>("PrintMutationRateData");
   action_lib->Register<cActionPrintDivideMutData>("PrintDivideMutData");
+  action_lib->Register<cActionPrintTestResultCacheData>("PrintTestResultCacheData");
   action_lib->Register<cActionPrintParasiteData>("PrintParasiteData");
   action_lib->Register<cActionPrintNumDivides>("PrintNumDivides");
   
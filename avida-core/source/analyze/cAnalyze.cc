@@ -47,6 +47,7 @@
 #include "cAnalyzeTreeStats_Gamma.h"
 #include "cAvidaContext.h"
 #include "cCPUTestInfo.h"
+#include "cEditDistanceMatrix.h"
 #include "cEnvironment.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
@@ -3228,38 +3229,30 @@ void cAnalyze::CommandPrintDistances(cString cur_string)
   int threshold_pair_count = 0;
 	double count = 0;
 	
-  cAnalyzeGenotype * genotype1 = NULL;
-  cAnalyzeGenotype * genotype2 = NULL;
-  tListIterator<cAnalyzeGenotype> batch_it1(batch[cur_batch].List());
+  // Compute all of the distances up front, in parallel
+  cEditDistanceMatrix distances(batch[cur_batch].List());
+  distances.Calculate(m_jobqueue);
+  
+  Apto::Array<int> counts(distances.GetNumRows());
+  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+  cAnalyzeGenotype * genotype = NULL;
+  for (int i = 0; (genotype = batch_it.Next()) != NULL; i++) counts[i] = genotype->GetNumCPUs();
 
   int watermark = 0;
   
-  while ((genotype1 = batch_it1.Next()) != NULL) {
+  for (int i = 0; i < counts.GetSize(); i++) {
 		count ++;
-    const int gen1_count = genotype1->GetNumCPUs();
+    const int gen1_count = counts[i];
 
     // Pair this genotype with itself for a distance of 0.
     pair_count += gen1_count * (gen1_count - 1) / 2;
 
     // Loop through the other genotypes this one can be paired with.
-    tListIterator<cAnalyzeGenotype> batch_it2(batch_it1);
-    while ((genotype2 = batch_it2.Next()) != NULL) {
-      const int gen2_count = genotype2->GetNumCPUs();
+    for (int j = i + 1; j < counts.GetSize(); j++) {
+      const int gen2_count = counts[j];
       const int cur_pairs = gen1_count * gen2_count;
       
-      const Genome& genotype1_genome = genotype1->GetGenome();
-      ConstInstructionSequencePtr genotype1_seq_p;
-      ConstGeneticRepresentationPtr genotype1_rep_p = genotype1_genome.Representation();
-      genotype1_seq_p.DynamicCastFrom(genotype1_rep_p);
-      const InstructionSequence& genotype1_seq = *genotype1_seq_p;
-      
-      const Genome& genotype2_genome = genotype2->GetGenome();
-      ConstInstructionSequencePtr genotype2_seq_p;
-      ConstGeneticRepresentationPtr genotype2_rep_p = genotype2_genome.Representation();
-      genotype2_seq_p.DynamicCastFrom(genotype2_rep_p);
-      const InstructionSequence& genotype2_seq = *genotype2_seq_p;
-
-      const int cur_dist = InstructionSequence::FindEditDistance(genotype1_seq, genotype2_seq);
+      const int cur_dist = distances.Get(i, j);
       dist_total += cur_pairs * cur_dist;
       if (cur_dist > dist_max) dist_max = cur_dist;
       pair_count += cur_pairs;
@@ -7406,6 +7399,12 @@ void cAnalyze::CommandLevenstein(cString cur_string)
     cout.flush();
   }
   
+  // Compute all of the distances up front, in parallel; a batch compared with itself only needs half of them
+  cEditDistanceMatrix* distances = NULL;
+  if (batch1 == batch2) distances = new cEditDistanceMatrix(batch[batch1].List());
+  else distances = new cEditDistanceMatrix(batch[batch1].List(), batch[batch2].List());
+  distances->Calculate(m_jobqueue);
+  
   // Setup some variables;
   cAnalyzeGenotype * genotype1 = NULL;
   cAnalyzeGenotype * genotype2 = NULL;
@@ -7416,9 +7415,9 @@ void cAnalyze::CommandLevenstein(cString cur_string)
   tListIterator<cAnalyzeGenotype> list2_it(batch[batch2].List());
   
   // Loop through all of the genotypes in each batch...
-  while ((genotype1 = list1_it.Next()) != NULL) {
+  for (int i = 0; (genotype1 = list1_it.Next()) != NULL; i++) {
     list2_it.Reset();
-    while ((genotype2 = list2_it.Next()) != NULL) {
+    for (int j = 0; (genotype2 = list2_it.Next()) != NULL; j++) {
       // Determine the counts...
       const int count1 = genotype1->GetNumCPUs();
       const int count2 = genotype2->GetNumCPUs();
@@ -7427,24 +7426,14 @@ void cAnalyze::CommandLevenstein(cString cur_string)
       if (num_pairs == 0) continue;
       
       // And do the tests...
-      const Genome& genotype1_genome = genotype1->GetGenome();
-      ConstInstructionSequencePtr genotype1_seq_p;
-      ConstGeneticRepresentationPtr genotype1_rep_p = genotype1_genome.Representation();
-      genotype1_seq_p.DynamicCastFrom(genotype1_rep_p);
-      const InstructionSequence& genotype1_seq = *genotype1_seq_p;
-
-      const Genome& genotype2_genome = genotype2->GetGenome();
-      ConstInstructionSequencePtr genotype2_seq_p;
-      ConstGeneticRepresentationPtr genotype2_rep_p = genotype2_genome.Representation();
-      genotype2_seq_p.DynamicCastFrom(genotype2_rep_p);
-      const InstructionSequence& genotype2_seq = *genotype2_seq_p;
-
-      const int dist = InstructionSequence::FindEditDistance(genotype1_seq, genotype2_seq);
+      const int dist = distances->Get(i, j);
       total_dist += dist * num_pairs;
       total_count += num_pairs;
     }
   }
   
+  delete distances;
+  
   // Calculate the final answer
   double ave_dist = (double) total_dist / (double) total_count;
   cout << " ave distance = " << ave_dist << endl;
@@ -10258,6 +10247,19 @@ void cAnalyze::BatchDuplicate(cString cur_string)
   batch[batch_to].SetAligned(false);
 }
 
+// Recalculates one genotype from the analyze job queue, using its own copy of the test settings
+class cRecalculateJob
+{
+private:
+  cAnalyzeGenotype* m_genotype;
+  cCPUTestInfo m_test_info;
+  
+public:
+  cRecalculateJob(cAnalyzeGenotype* genotype, const cCPUTestInfo& test_info) : m_genotype(genotype), m_test_info(test_info) { ; }
+  
+  void Recalculate(cAvidaContext& ctx) { m_genotype->Recalculate(ctx, &m_test_info); }
+};
+
 void cAnalyze::BatchRecalculate(cString cur_string)
 {
   Apto::Array<int> manual_inputs;  // Used only if manual inputs are specified
@@ -10303,16 +10305,44 @@ void cAnalyze::BatchRecalculate(cString cur_string)
     cerr << "warning: " << msg << endl;
   }
   
+  // Test each distinct genome once on the job queue; genotypes repeating an earlier genome are filled in afterwards.
+  // With random inputs every genotype draws its own inputs, so each one is tested even if its genome repeats.
+  tList<cRecalculateJob> job_list;
+  tAnalyzeJobBatch<cRecalculateJob> jobbatch(m_jobqueue);
+  Apto::Map<Apto::String, cAnalyzeGenotype*> tested_genomes;
+  Apto::Array<cAnalyzeGenotype*> dup_genotypes;
+  Apto::Array<cAnalyzeGenotype*> dup_sources;
+  
   tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
   cAnalyzeGenotype * genotype = NULL;
+  while ((genotype = batch_it.Next()) != NULL) {
+    const Apto::String genome_str = genotype->GetGenome().AsString();
+    cAnalyzeGenotype* source = NULL;
+    if (!use_random_inputs && tested_genomes.Get(genome_str, source)) {
+      dup_genotypes.Push(genotype);
+      dup_sources.Push(source);
+      continue;
+    }
+    tested_genomes.Set(genome_str, genotype);
+    
+    cRecalculateJob* job = new cRecalculateJob(genotype, test_info);
+    job_list.Push(job);
+    jobbatch.AddJob(job, &cRecalculateJob::Recalculate);
+  }
+  jobbatch.RunBatch();
+  
+  cRecalculateJob* job = NULL;
+  while ((job = job_list.Pop())) delete job;
+  
+  for (int i = 0; i < dup_genotypes.GetSize(); i++) dup_genotypes[i]->CopyTestStats(*dup_sources[i]);
+  
+  // Second pass, in batch order: if the previous genotype was the parent of this one, fill in the stats that depend
+  // on it (such as distance to parent, etc.)
+  batch_it.Reset();
   cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
+  while ((genotype = batch_it.Next()) != NULL) {
     if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info);
+      genotype->CalcParentStats(last_genotype);
     }
     last_genotype = genotype;
   }
@@ -599,25 +599,7 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
 
   
   // Setup a new parent stats if we have a parent to work with.
-  if (parent_genotype != NULL) {
-    fitness_ratio = GetFitness() / parent_genotype->GetFitness();
-    efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
-    comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
-    ConstInstructionSequencePtr seq_p;
-    GeneticRepresentationPtr rep_p = m_genome.Representation();
-    seq_p.DynamicCastFrom(rep_p);
-    const InstructionSequence& seq = *seq_p;
-    
-    const Genome& parent_genome = parent_genotype->GetGenome();
-    ConstInstructionSequencePtr parent_seq_p;
-    ConstGeneticRepresentationPtr parent_rep_p = parent_genome.Representation();
-    parent_seq_p.DynamicCastFrom(parent_rep_p);
-    const InstructionSequence& parent_seq = *parent_seq_p;
-    
-    parent_dist = cStringUtil::EditDistance((const char *)seq.AsString(), (const char *)parent_seq.AsString(), parent_muts);
-    
-    ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
-  }
+  if (parent_genotype != NULL) CalcParentStats(parent_genotype);
   
   // Summarize plasticity information if multiple recalculations performed
   if (num_trials > 1){
@@ -630,6 +612,58 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
 }
 
 
+void cAnalyzeGenotype::CalcParentStats(cAnalyzeGenotype* parent_genotype)
+{
+  fitness_ratio = GetFitness() / parent_genotype->GetFitness();
+  efficiency_ratio = GetEfficiency() / parent_genotype->GetEfficiency();
+  comp_merit_ratio = GetCompMerit() / parent_genotype->GetCompMerit();
+  ConstInstructionSequencePtr seq_p;
+  GeneticRepresentationPtr rep_p = m_genome.Representation();
+  seq_p.DynamicCastFrom(rep_p);
+  const InstructionSequence& seq = *seq_p;
+  
+  const Genome& parent_genome = parent_genotype->GetGenome();
+  ConstInstructionSequencePtr parent_seq_p;
+  ConstGeneticRepresentationPtr parent_rep_p = parent_genome.Representation();
+  parent_seq_p.DynamicCastFrom(parent_rep_p);
+  const InstructionSequence& parent_seq = *parent_seq_p;
+  
+  parent_dist = cStringUtil::EditDistance((const char *)seq.AsString(), (const char *)parent_seq.AsString(), parent_muts);
+  
+  ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
+}
+
+
+// Take the test CPU results of a genotype with the same genome, in place of testing this one again
+void cAnalyzeGenotype::CopyTestStats(const cAnalyzeGenotype& source)
+{
+  viable                = source.viable;
+  m_env_inputs          = source.m_env_inputs;
+  executed_flags        = source.executed_flags;
+  inst_executed_counts  = source.inst_executed_counts;
+  length                = source.length;
+  copy_length           = source.copy_length;
+  exe_length            = source.exe_length;
+  merit                 = source.merit;
+  gest_time             = source.gest_time;
+  fitness               = source.fitness;
+  errors                = source.errors;
+  div_type              = source.div_type;
+  mate_id               = source.mate_id;
+  task_counts           = source.task_counts;
+  task_qualities        = source.task_qualities;
+  internal_task_counts  = source.internal_task_counts;
+  internal_task_qualities = source.internal_task_qualities;
+  rbins_total           = source.rbins_total;
+  rbins_avail           = source.rbins_avail;
+  collect_spec_counts   = source.collect_spec_counts;
+  m_mating_type         = source.m_mating_type;
+  m_mate_preference     = source.m_mate_preference;
+  m_mating_display_a    = source.m_mating_display_a;
+  m_mating_display_b    = source.m_mating_display_b;
+}
+
+
 void cAnalyzeGenotype::PrintTasks(ofstream& fp, int min_task, int max_task)
 {
   if (max_task == -1) max_task = task_counts.GetSize();
@@ -81,6 +81,12 @@ cAnalyzeJobQueue::~cAnalyzeJobQueue()
   delete m_job_seed_rng;
 }
 
+inline void cAnalyzeJobQueue::prepareJob(cAnalyzeJob* job)
+{
+  job->SetID(m_last_jobid++);
+  job->SetSeed(m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()));
+}
+
 inline void cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
 {
   if (m_workers.GetSize()) m_queue.PushRear(job);
@@ -90,7 +96,7 @@ inline void cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
 void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
 {
   Apto::MutexAutoLock lock(m_mutex);
-  job->SetID(m_last_jobid++);
+  prepareJob(job);
   queueJob(job);
   m_jobs++;
 }
@@ -98,7 +104,7 @@ void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
 void cAnalyzeJobQueue::AddJobImmediate(cAnalyzeJob* job)
 {
   m_mutex.Lock();
-  job->SetID(m_last_jobid++);
+  prepareJob(job);
   queueJob(job);
   m_jobs++;
   m_mutex.Unlock(); // should unlock prior to signaling condition variable
@@ -135,7 +141,7 @@ void cAnalyzeJobQueue::Execute()
 
 void cAnalyzeJobQueue::singleThreadedJobExecution(cAnalyzeJob* job)
 {
-  Apto::RNG::AvidaRNG rng(GetSeedForJob(job->GetID()));
+  Apto::RNG::AvidaRNG rng(GetSeedForJob(job));
   cAvidaContext ctx(&m_world->GetDriver(), rng);
   job->Run(ctx);
   delete job;
@@ -59,6 +59,7 @@ private:
 
 
   void singleThreadedJobExecution(cAnalyzeJob* job);
+  inline void prepareJob(cAnalyzeJob* job);
   inline void queueJob(cAnalyzeJob* job);
 
   
@@ -77,7 +78,9 @@ public:
   void Start();
   void Execute();
   
-  int GetSeedForJob(int jobid) { Apto::MutexAutoLock lock(m_mutex); return m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()); }
+  // Seeds are drawn as jobs are queued, so a job's random number stream depends only on the order in which jobs were
+  // added, not on which worker runs it or when
+  int GetSeedForJob(cAnalyzeJob* job) { return job->GetSeed(); }
 };
 
 #endif
@@ -46,7 +46,7 @@ void cAnalyzeJobWorker::Run()
     
     if (job) {
       // Set RNG from the waiting pool and execute the job
-      rng.ResetSeed(m_queue->GetSeedForJob(job->GetID()));
+      rng.ResetSeed(m_queue->GetSeedForJob(job));
       job->Run(ctx);
       delete job;
       m_queue->m_mutex.Lock();
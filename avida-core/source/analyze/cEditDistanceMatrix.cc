@@ -0,0 +1,97 @@
+/*
+ *  cEditDistanceMatrix.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cEditDistanceMatrix.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cAnalyzeJobQueue.h"
+#include "tAnalyzeJobBatch.h"
+
+
+cEditDistanceMatrix::cEditDistanceMatrix(tList<cAnalyzeGenotype>& genotypes) : m_symmetric(true)
+{
+  loadSequences(genotypes, m_rows);
+  m_cols = m_rows;
+
+  m_dists.Resize(m_rows.GetSize());
+  for (int row = 0; row < m_rows.GetSize(); row++) m_dists[row].Resize(m_rows.GetSize() - row - 1);
+}
+
+cEditDistanceMatrix::cEditDistanceMatrix(tList<cAnalyzeGenotype>& row_genotypes,
+                                         tList<cAnalyzeGenotype>& col_genotypes)
+  : m_symmetric(false)
+{
+  loadSequences(row_genotypes, m_rows);
+  loadSequences(col_genotypes, m_cols);
+  m_dists.Resize(m_rows.GetSize());
+  for (int row = 0; row < m_rows.GetSize(); row++) m_dists[row].Resize(m_cols.GetSize());
+}
+
+
+void cEditDistanceMatrix::loadSequences(tList<cAnalyzeGenotype>& genotypes,
+                                        Apto::Array<ConstInstructionSequencePtr>& seqs)
+{
+  seqs.Resize(genotypes.GetSize());
+
+  tListIterator<cAnalyzeGenotype> list_it(genotypes);
+  cAnalyzeGenotype* genotype = NULL;
+  for (int i = 0; (genotype = list_it.Next()) != NULL; i++) {
+    ConstGeneticRepresentationPtr rep_p = genotype->GetGenome().Representation();
+    seqs[i].DynamicCastFrom(rep_p);
+  }
+}
+
+
+void cEditDistanceMatrix::Calculate(cAnalyzeJobQueue& queue)
+{
+  tList<cBlock> block_list;
+  tAnalyzeJobBatch<cBlock> jobbatch(queue);
+
+  for (int row = 0; row < m_rows.GetSize(); row += BLOCK_SIZE) {
+    // Blocks entirely below the diagonal of a symmetric matrix have nothing to compute
+    const int first_col = (m_symmetric) ? row : 0;
+    for (int col = first_col; col < m_cols.GetSize(); col += BLOCK_SIZE) {
+      cBlock* block = new cBlock(this, row, col);
+      block_list.Push(block);
+      jobbatch.AddJob(block, &cBlock::Calculate);
+    }
+  }
+  jobbatch.RunBatch();
+
+  cBlock* block = NULL;
+  while ((block = block_list.Pop())) delete block;
+}
+
+
+void cEditDistanceMatrix::cBlock::Calculate(cAvidaContext&)
+{
+  const int row_end = Apto::Min(m_row_start + BLOCK_SIZE, m_matrix->m_rows.GetSize());
+  const int col_end = Apto::Min(m_col_start + BLOCK_SIZE, m_matrix->m_cols.GetSize());
+
+  for (int row = m_row_start; row < row_end; row++) {
+    const InstructionSequence& row_seq = *m_matrix->m_rows[row];
+    const int col_start = (m_matrix->m_symmetric) ? Apto::Max(m_col_start, row + 1) : m_col_start;
+    for (int col = col_start; col < col_end; col++) {
+      m_matrix->entry(row, col) = InstructionSequence::FindEditDistance(row_seq, *m_matrix->m_cols[col]);
+    }
+  }
+}
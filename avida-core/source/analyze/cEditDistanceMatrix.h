@@ -0,0 +1,109 @@
+/*
+ *  cEditDistanceMatrix.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cEditDistanceMatrix_h
+#define cEditDistanceMatrix_h
+
+#include "apto/core.h"
+#include "avida/core/InstructionSequence.h"
+
+#include "tList.h"
+
+class cAnalyzeGenotype;
+class cAnalyzeJobQueue;
+class cAvidaContext;
+
+using namespace Avida;
+
+
+// cEditDistanceMatrix - edit distances between every pair of genotypes drawn from two lists (or within one list).
+//
+// The matrix is cut into square blocks that are computed as independent jobs on the analyze job queue.  Every entry is
+// written by exactly one block, so blocks share the distance storage without locking.  A matrix over a single list is
+// symmetric, and only the pairs above the diagonal are computed and stored.  Distances are stored one array per row,
+// since the number of pairs passes the range of an array index long before the number of genotypes does.
+
+class cEditDistanceMatrix
+{
+private:
+  static const int BLOCK_SIZE = 64;
+
+  class cBlock
+  {
+  private:
+    cEditDistanceMatrix* m_matrix;
+    int m_row_start;
+    int m_col_start;
+
+  public:
+    cBlock(cEditDistanceMatrix* matrix, int row_start, int col_start)
+      : m_matrix(matrix), m_row_start(row_start), m_col_start(col_start) { ; }
+
+    void Calculate(cAvidaContext& ctx);
+  };
+  friend class cBlock;
+
+
+  Apto::Array<ConstInstructionSequencePtr> m_rows;
+  Apto::Array<ConstInstructionSequencePtr> m_cols;
+  bool m_symmetric;
+  Apto::Array<Apto::Array<int> > m_dists;  // symmetric rows hold only the columns after the diagonal
+
+  void loadSequences(tList<cAnalyzeGenotype>& genotypes, Apto::Array<ConstInstructionSequencePtr>& seqs);
+  inline int& entry(int row, int col);
+
+
+  cEditDistanceMatrix(); // @not_implemented
+  cEditDistanceMatrix(const cEditDistanceMatrix&); // @not_implemented
+  cEditDistanceMatrix& operator=(const cEditDistanceMatrix&); // @not_implemented
+
+public:
+  cEditDistanceMatrix(tList<cAnalyzeGenotype>& genotypes);
+  cEditDistanceMatrix(tList<cAnalyzeGenotype>& row_genotypes, tList<cAnalyzeGenotype>& col_genotypes);
+
+  void Calculate(cAnalyzeJobQueue& queue);
+
+  int GetNumRows() const { return m_rows.GetSize(); }
+  int GetNumCols() const { return m_cols.GetSize(); }
+
+  // Rows and columns are numbered in list order
+  inline int Get(int row, int col) const;
+};
+
+
+inline int& cEditDistanceMatrix::entry(int row, int col)
+{
+  if (!m_symmetric) return m_dists[row][col];
+
+  // Upper triangle only
+  assert(row < col);
+  return m_dists[row][col - row - 1];
+}
+
+inline int cEditDistanceMatrix::Get(int row, int col) const
+{
+  if (!m_symmetric) return m_dists[row][col];
+
+  if (row == col) return 0;
+  if (row > col) return m_dists[col][row - col - 1];
+  return m_dists[row][col - row - 1];
+}
+
+#endif
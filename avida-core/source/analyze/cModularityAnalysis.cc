@@ -109,7 +109,7 @@ void cModularityAnalysis::CalcFunctionalModularity(cAvidaContext& ctx)
       testcpu->TestGenome(ctx, test_info, mod_genome);
       
       if (test_info.GetColonyFitness() > 0.0) {
-        const Apto::Array<int>& test_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+        const tArraySlice<int>& test_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
         
         for (int cur_task = 0; cur_task < num_tasks; cur_task++) {
           // This is done so that under 'binary' option it marks
@@ -322,7 +322,7 @@ double cMutationalNeighborhood::ProcessOneStepGenome(cAvidaContext& ctx, cTestCP
   if (test_fitness >= m_neut_min) odata.site_count[cur_site]++;
   
   if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const Apto::Array<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+    const tArraySlice<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
     bool knockout = false;
     bool anytask = false;
     for (int i = 0; i < m_base_tasks.GetSize(); i++) {
@@ -531,7 +531,7 @@ double cMutationalNeighborhood::ProcessTwoStepGenome(cAvidaContext& ctx, cTestCP
   if (test_fitness >= m_neut_min) tdata.site_count[cur.site]++;
   
   if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const Apto::Array<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+    const tArraySlice<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
     bool knockout = false;
     bool anytask = false;
     for (int i = 0; i < m_base_tasks.GetSize(); i++) {
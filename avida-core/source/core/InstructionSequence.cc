@@ -33,6 +33,10 @@ const int MEMORY_INCREASE_MINIMUM = 5;
 const double MEMORY_INCREASE_FACTOR = 1.5;
 const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
+typedef unsigned long long EditBlock;       // One word of the bit-vector edit distance
+const int EDIT_BLOCK_BITS = 64;
+const int EDIT_NUM_OPS = 256;               // Instruction ops are stored in a byte
+
 
 Avida::InstructionSequence::InstructionSequence(const InstructionSequence& seq)
 : GeneticRepresentation(seq), m_seq(seq.GetSize()), m_active_size(seq.GetSize())
@@ -544,14 +548,51 @@ int Avida::InstructionSequence::FindSlidingDistance(const InstructionSequence& s
 }
 
 
-int Avida::InstructionSequence::FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2)
+// Advance one block of vertical deltas across a text site.  carry_in is the horizontal delta (-1, 0 or +1) entering
+// the top row of the block; returns the horizontal delta leaving the row marked by high_bit.
+static inline int advanceEditBlock(EditBlock& pos_delta, EditBlock& neg_delta, EditBlock match, int carry_in,
+                                   EditBlock high_bit)
+{
+  const EditBlock xv = match | neg_delta;
+  if (carry_in < 0) match |= 1;
+  const EditBlock xh = (((match & pos_delta) + pos_delta) ^ pos_delta) | match;
+  
+  EditBlock pos_h = neg_delta | ~(xh | pos_delta);
+  EditBlock neg_h = pos_delta & xh;
+  
+  int carry_out = 0;
+  if (pos_h & high_bit) carry_out = 1;
+  else if (neg_h & high_bit) carry_out = -1;
+  
+  pos_h <<= 1;
+  neg_h <<= 1;
+  if (carry_in < 0) neg_h |= 1;
+  else if (carry_in > 0) pos_h |= 1;
+  
+  pos_delta = neg_h | ~(xv | pos_h);
+  neg_delta = pos_h & xv;
+  
+  return carry_out;
+}
+
+static inline int cutoffEditDistance(int dist, int max_dist)
+{
+  return (max_dist >= 0 && dist > max_dist) ? max_dist + 1 : dist;
+}
+
+
+// Edit distance by the Myers/Hyyro bit-vector algorithm.  The shorter sequence is packed 64 sites to a word, and each
+// site of the longer one advances the vertical deltas of a whole column of the dynamic programming table at once.
+// A non-negative max_dist stops the computation as soon as the distance is known to exceed it.
+int Avida::InstructionSequence::FindEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2,
+                                                 int max_dist)
 {
   const int size1 = seq1.GetSize();
   const int size2 = seq2.GetSize();
   const int min_size = (size1 < size2) ? size1 : size2;
   
   // If either size is zero, return the other one!
-  if (!min_size) return (size1 > size2) ? size1 : size2;
+  if (!min_size) return cutoffEditDistance((size1 > size2) ? size1 : size2, max_dist);
   
   // Count how many direct matches we have at the front and end.
   int match_front = 0, match_end = 0;
@@ -562,52 +603,62 @@ int Avida::InstructionSequence::FindEditDistance(const InstructionSequence& seq1
   const int test_size1 = size1 - match_front - match_end;
   const int test_size2 = size2 - match_front - match_end;
   
-  if (test_size1 <= 0 || test_size2 <=0) return abs(test_size1 - test_size2);
+  if (test_size1 <= 0 || test_size2 <=0) return cutoffEditDistance(abs(test_size1 - test_size2), max_dist);
+  
+  // The distance is at least the difference in length
+  if (max_dist >= 0 && abs(test_size1 - test_size2) > max_dist) return max_dist + 1;
+  
+  // Pack the shorter remainder (the pattern) into bit vectors and run the longer one (the text) against it
+  const bool seq1_shorter = (test_size1 <= test_size2);
+  const InstructionSequence& pattern = (seq1_shorter) ? seq1 : seq2;
+  const InstructionSequence& text = (seq1_shorter) ? seq2 : seq1;
+  const int pattern_size = (seq1_shorter) ? test_size1 : test_size2;
+  const int text_size = (seq1_shorter) ? test_size2 : test_size1;
   
-  // Now match everything else...
-  int* cur_row  = new int[test_size1];  // The row we are calculating
-  int* prev_row = new int[test_size1];  // The last row we calculated
+  const int num_blocks = (pattern_size + EDIT_BLOCK_BITS - 1) / EDIT_BLOCK_BITS;
+  const int table_size = EDIT_NUM_OPS * num_blocks;
   
-  // Initialize the previous row to record the differece from nothing.
-  for (int i = 0; i < test_size1; i++)  prev_row[i] = i + 1;
+  // Match masks (one row of num_blocks words per instruction op), then the positive and negative vertical deltas
+  EditBlock local_storage[EDIT_NUM_OPS + 2];
+  EditBlock* storage = (num_blocks == 1) ? local_storage : new EditBlock[table_size + 2 * num_blocks];
+  EditBlock* match_masks = storage;
+  EditBlock* pos_deltas = storage + table_size;
+  EditBlock* neg_deltas = pos_deltas + num_blocks;
+  
+  for (int i = 0; i < table_size; i++) match_masks[i] = 0;
+  for (int i = 0; i < pattern_size; i++) {
+    match_masks[pattern[match_front + i].GetOp() * num_blocks + i / EDIT_BLOCK_BITS] |=
+      EditBlock(1) << (i % EDIT_BLOCK_BITS);
+  }
+  for (int b = 0; b < num_blocks; b++) {
+    pos_deltas[b] = ~EditBlock(0);
+    neg_deltas[b] = 0;
+  }
   
-  // Loop through each subsequent character in the test code
-  for (int i = 0; i < test_size2; i++) {
-    // Initialize the first entry in cur_row.
-    if (seq1[match_front] == seq2[match_front + i]) cur_row[0] = i;
-    else cur_row[0] = (i < prev_row[0]) ? (i+1) : (prev_row[0] + 1);
+  // Every row but the last block's final one is a full word
+  const EditBlock high_bit = EditBlock(1) << (EDIT_BLOCK_BITS - 1);
+  const EditBlock last_high_bit = EditBlock(1) << ((pattern_size - 1) % EDIT_BLOCK_BITS);
+  
+  // Score tracks the bottom row of the table, starting at the distance from the pattern to nothing
+  int score = pattern_size;
+  for (int i = 0; i < text_size; i++) {
+    const EditBlock* column_masks = match_masks + text[match_front + i].GetOp() * num_blocks;
     
-    // Move down the cur_row and fill it out.
-    for (int j = 1; j < test_size1; j++) {
-      // If the values are equal, keep the value in the upper left.
-      if (seq1[match_front + j] == seq2[match_front + i]) {
-        cur_row[j] = prev_row[j-1];
-      }
-      
-      // Otherwise, set the current position the the minimal of the three
-      // numbers above (insertion), to the left (deletion), or upper left
-      // (mutation) in the chart, plus one.
-      else {
-        cur_row[j] = (prev_row[j] < prev_row[j-1]) ? prev_row[j] : prev_row[j-1];
-        if (cur_row[j-1] < cur_row[j]) cur_row[j] = cur_row[j-1];
-        cur_row[j]++;
-      }
+    int carry = 1;
+    for (int b = 0; b < num_blocks; b++) {
+      carry = advanceEditBlock(pos_deltas[b], neg_deltas[b], column_masks[b], carry,
+                               (b == num_blocks - 1) ? last_high_bit : high_bit);
     }
+    score += carry;
     
-    // Swap cur_row and prev_row. (we only really need to move the cur row
-    // over to prev, but this saves us from having to keep re-allocating
-    // new rows.  We recycle!
-    int* temp_row = cur_row;
-    cur_row = prev_row;
-    prev_row = temp_row;
+    // Each remaining text site can lower the score by at most one
+    if (max_dist >= 0 && score - (text_size - i - 1) > max_dist) {
+      score = max_dist + 1;
+      break;
+    }
   }
   
-  // Now that we are done, return the bottom-right corner of the chart.
-  
-  const int value = prev_row[test_size1 - 1];
-  
-  delete [] cur_row;
-  delete [] prev_row;
+  if (storage != local_storage) delete [] storage;
   
-  return value;
+  return score;
 }
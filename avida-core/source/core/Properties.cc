@@ -93,6 +93,44 @@ Avida::PropertyPtr Avida::PropertyMap::s_default_prop(new StringProperty("", Pro
 Avida::PropertyMap::~PropertyMap() { ; }
 
 
+namespace Avida {
+  struct InternedPropertyIDs
+  {
+    Apto::Mutex mutex;
+    Apto::Map<PropertyID, int> index;
+    Apto::Array<PropertyID> ids;
+  };
+};
+
+typedef Apto::SingletonHolder<Avida::InternedPropertyIDs, Apto::CreateWithNew, Apto::DestroyAtExit, Apto::ThreadSafe> InternedPropertyIDsSingleton;
+
+
+int Avida::PropertyMap::Intern(const PropertyID& p_id)
+{
+  InternedPropertyIDs& interned = InternedPropertyIDsSingleton::Instance();
+  Apto::MutexAutoLock lock(interned.mutex);
+  
+  int p_idx = -1;
+  if (!interned.index.Get(p_id, p_idx)) {
+    p_idx = interned.ids.GetSize();
+    interned.index.Set(p_id, p_idx);
+    interned.ids.Push(p_id);
+  }
+  return p_idx;
+}
+
+Avida::PropertyID Avida::PropertyMap::InternedID(int p_idx)
+{
+  InternedPropertyIDs& interned = InternedPropertyIDsSingleton::Instance();
+  Apto::MutexAutoLock lock(interned.mutex);
+  assert(p_idx >= 0 && p_idx < interned.ids.GetSize());
+  return interned.ids[p_idx];
+}
+
+double Avida::PropertyMap::GetDouble(int p_idx) const { return Get(InternedID(p_idx)).DoubleValue(); }
+int Avida::PropertyMap::GetInt(int p_idx) const { return Get(InternedID(p_idx)).IntValue(); }
+
+
 // HashPropertyMap
 // --------------------------------------------------------------------------------------------------------------
 
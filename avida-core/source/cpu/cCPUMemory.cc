@@ -22,17 +22,53 @@
 
 #include "cCPUMemory.h"
 
+#include "cInstSet.h"
+#include "cNopLabelIndex.h"
+
 using namespace std;
 using namespace Avida;
 
-cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize())
+cCPUMemory::cCPUMemory(const cCPUMemory& in_memory)
+  : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize()), m_nop_index(NULL), m_nop_index_valid(false)
 {
   for (int i = 0; i < m_flag_array.GetSize(); i++) m_flag_array[i] = in_memory.m_flag_array[i];
 }
 
+cCPUMemory::~cCPUMemory()
+{
+  delete m_nop_index;
+}
+
+
+void cCPUMemory::SetInst(int pos, const Instruction& inst)
+{
+  assert(pos >= 0 && pos < m_active_size);
+  
+  // Swapping one plain instruction for another leaves every nop and label where it was
+  if (m_nop_index_valid) {
+    const cInstSet& inst_set = *m_nop_index->GetInstSet();
+    if (m_nop_index->IsNop(pos) || inst_set.IsNop(inst) || inst_set.IsLabel(m_seq[pos]) || inst_set.IsLabel(inst)) {
+      m_nop_index_valid = false;
+    }
+  }
+  m_seq[pos] = inst;
+}
+
+
+const cNopLabelIndex& cCPUMemory::GetNopLabelIndex(const cInstSet& inst_set) const
+{
+  if (!m_nop_index) m_nop_index = new cNopLabelIndex;
+  if (!m_nop_index_valid || m_nop_index->GetInstSet() != &inst_set) {
+    m_nop_index->Build(*this, inst_set);
+    m_nop_index_valid = true;
+  }
+  return *m_nop_index;
+}
+
 
 void cCPUMemory::adjustCapacity(int new_size)
 {
+  m_nop_index_valid = false;
   InstructionSequence::adjustCapacity(new_size);
   if (m_seq.GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq.GetSize()); 
 }
@@ -95,6 +131,7 @@ void cCPUMemory::Copy(int to, int from)
   assert(from >= 0);
   assert(from < m_seq.GetSize());
   
+  m_nop_index_valid = false;
   m_seq[to] = m_seq[from];
   m_flag_array[to] = m_flag_array[from];
 }
@@ -149,6 +186,7 @@ void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& geno
   else if (size_change < 0) Remove(pos, -size_change);
   
   // Now just copy everything over!
+  m_nop_index_valid = false;
   for (int i = 0; i < genome.GetSize(); i++) {
     m_seq[i + pos] = genome[i];
     m_flag_array[i + pos] = 0;
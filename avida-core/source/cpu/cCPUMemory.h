@@ -25,6 +25,9 @@
 
 #include "avida/core/InstructionSequence.h"
 
+class cInstSet;
+class cNopLabelIndex;
+
 
 class cCPUMemory : public Avida::InstructionSequence
 {
@@ -40,15 +43,30 @@ private:
   
   Apto::Array<unsigned char> m_flag_array;
 
+  // Built on demand by GetNopLabelIndex(); any modification of the memory marks it stale
+  mutable cNopLabelIndex* m_nop_index;
+  mutable bool m_nop_index_valid;
+
   void adjustCapacity(int new_size);
   void prepareInsert(int pos, int num_sites);
 
 public:
   cCPUMemory(const cCPUMemory& in_memory);
-  cCPUMemory(const InstructionSequence& in_genome) : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()) { ; }
-  explicit cCPUMemory(int size = 1)  : InstructionSequence(size), m_flag_array(size) { ClearFlags(); }
-  cCPUMemory(const Apto::String& in_string) : InstructionSequence(in_string), m_flag_array(in_string.GetSize()) { ; }
-  ~cCPUMemory() { ; }
+  cCPUMemory(const InstructionSequence& in_genome)
+    : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()), m_nop_index(NULL), m_nop_index_valid(false) { ; }
+  explicit cCPUMemory(int size = 1)
+    : InstructionSequence(size), m_flag_array(size), m_nop_index(NULL), m_nop_index_valid(false) { ClearFlags(); }
+  cCPUMemory(const Apto::String& in_string)
+    : InstructionSequence(in_string), m_flag_array(in_string.GetSize()), m_nop_index(NULL), m_nop_index_valid(false) { ; }
+  ~cCPUMemory();
+
+  // Writable access may change the instruction, so it marks the nop label index stale; read through a const
+  // reference where possible.  SetInst() leaves the index intact when no nop or 'label' is written or overwritten.
+  inline Avida::Instruction& operator[](int idx) { m_nop_index_valid = false; return InstructionSequence::operator[](idx); }
+  inline const Avida::Instruction& operator[](int idx) const { return InstructionSequence::operator[](idx); }
+  void SetInst(int pos, const Avida::Instruction& inst);
+
+  const cNopLabelIndex& GetNopLabelIndex(const cInstSet& inst_set) const;
 
   inline bool FlagCopied(int pos) const     { return (MASK_COPIED   & m_flag_array[pos]) != 0; }
   inline bool FlagMutated(int pos) const    { return (MASK_MUTATED  & m_flag_array[pos]) != 0; }
@@ -78,6 +96,7 @@ public:
 			m_seq[i].SetOp(0);
 			m_flag_array[i] = 0;
 		}
+		m_nop_index_valid = false;
 	}
   inline void ClearFlags() { m_flag_array.SetAll(0); }
   void Reset(int new_size);     // Reset size, clearing contents...
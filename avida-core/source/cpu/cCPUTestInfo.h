@@ -101,7 +101,10 @@ public:
   bool GetUseRandomInputs() const { return use_random_inputs; }
 	bool GetUseManualInputs() const { return use_manual_inputs; }
 	const Apto::Array<int>& GetTestCPUInputs() const { return used_inputs; }
-  HardwareTracerPtr GetTracer() { return m_tracer; }
+  HardwareTracerPtr GetTracer() const { return m_tracer; }
+  eTestCPUResourceMethod GetResourceMethod() const { return m_res_method; }
+  const cResourceHistory* GetResourceHistory() const { return m_res; }
+  int GetResourceUpdate() const { return m_res_update; }
 
 
   // Output Accessors
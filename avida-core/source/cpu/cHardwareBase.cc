@@ -25,6 +25,8 @@
 #include "avida/core/Feedback.h"
 #include "avida/core/WorldDriver.h"
 
+#include "apto/rng.h"
+
 #include "cAvidaContext.h"
 #include "cCodeLabel.h"
 #include "cCPUTestInfo.h"
@@ -39,6 +41,7 @@
 #include "cPopulationCell.h"
 #include "cStats.h"
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cWorld.h"
 #include "nHardware.h"
 
@@ -247,8 +250,8 @@ bool cHardwareBase::Divide_CheckViable(cAvidaContext& ctx, const int parent_size
     const double merit_base = phenotype.CalcSizeMerit();
     const double cur_fitness = merit_base * phenotype.GetCurBonus() / phenotype.GetTimeUsed();
     const double fitness_ratio = cur_fitness / phenotype.GetLastFitness();
-    const Apto::Array<int>& childtasks = phenotype.GetCurTaskCount();
-    const Apto::Array<int>& parenttasks = phenotype.GetLastTaskCount();
+    const tArraySlice<int>& childtasks = phenotype.GetCurTaskCount();
+    const tArraySlice<int>& parenttasks = phenotype.GetLastTaskCount();
     
     bool sterilize = false;
     
@@ -858,6 +861,39 @@ unsigned cHardwareBase::Divide_DoExactMutations(cAvidaContext& ctx, double mut_m
 }
 
 
+// Run the offspring through a pooled test CPU, or pull the result of an earlier identical test from the cache.  With the
+// cache enabled, every test draws from a random stream seeded by the genome and leaves the world's stream alone, so a
+// cached result is exactly what testing the genome again would give and the cache size never changes a run.
+static void testOffspring(cWorld* world, cAvidaContext& ctx, const Genome& offspring, cTestResultCache::sTestResult& result)
+{
+  cHardwareManager& hw_mgr = world->GetHardwareManager();
+  cTestResultCache& cache = hw_mgr.GetTestResultCache();
+
+  cCPUTestInfo test_info;
+  test_info.UseRandomInputs();
+  if (cache.Lookup(offspring, test_info, result)) return;
+
+  cTestCPU* testcpu = NULL;
+  if (cache.IsEnabled()) {
+    Apto::RNG::AvidaRNG rng(cache.GetSeed(offspring, test_info));
+    cAvidaContext genome_ctx((ctx.HasDriver()) ? &ctx.Driver() : NULL, rng);
+    if (ctx.GetWorkerMode()) genome_ctx.SetWorkerMode();
+    testcpu = hw_mgr.AcquireTestCPU(genome_ctx);
+    testcpu->TestGenome(genome_ctx, test_info, offspring);
+  } else {
+    testcpu = hw_mgr.AcquireTestCPU(ctx);
+    testcpu->TestGenome(ctx, test_info, offspring);
+  }
+  hw_mgr.ReleaseTestCPU(testcpu);
+
+  result.fitness = test_info.GetGenotypeFitness();
+  result.is_viable = test_info.IsViable();
+  result.max_depth = test_info.GetMaxDepth();
+  result.task_counts = test_info.GetTestPhenotype().GetLastTaskCount();
+  cache.Store(offspring, test_info, result);
+}
+
+
 // test whether the offspring creature contains an advantageous mutation.
 /*
  Return true iff only a reversion is performed -- returns false is sterilized regardless of whether or 
@@ -881,23 +917,20 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   if (phenotype.CopyTrue() == true) return false;
 	
   const double parent_fitness = m_organism->GetTestFitness(ctx);
-  const Apto::Array<int>& parenttasks = phenotype.GetCurTaskCount();
+  const tArraySlice<int>& parenttasks = phenotype.GetCurTaskCount();
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cTestResultCache::sTestResult test_result;
+  testOffspring(m_world, ctx, m_organism->OffspringGenome(), test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() == true) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
   if (child_fitness == 0.0) {
@@ -924,7 +957,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
     RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-    const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+    const Apto::Array<int>& childtasks = test_result.task_counts;
     bool del = false;
     bool added = false;
     for (int i=0; i<childtasks.GetSize(); i++)
@@ -949,7 +982,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -993,26 +1026,23 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   if (phenotype.CopyTrue() == true) return false;
 	
   const double parent_fitness = m_organism->GetTestFitness(ctx);
-  const Apto::Array<int>& parenttasks = phenotype.GetCurTaskCount();
+  const tArraySlice<int>& parenttasks = phenotype.GetCurTaskCount();
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cTestResultCache::sTestResult test_result;
+  testOffspring(m_world, ctx, m_organism->OffspringGenome(), test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() > 0) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
-  if (m_organism->GetSterilizeUnstable() > 1 && !test_info.IsViable()) {
+  if (m_organism->GetSterilizeUnstable() > 1 && !test_result.is_viable) {
     sterilize = true;
   }
   
@@ -1038,7 +1068,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
 	  RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-	  const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+	  const Apto::Array<int>& childtasks = test_result.task_counts;
 	  bool del = false;
 	  bool added = false;
 	  for (int i=0; i<childtasks.GetSize(); i++)
@@ -1063,7 +1093,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -1429,6 +1459,7 @@ void cHardwareBase::SetMiniTrace(const cString& filename)
 {
   m_tracer = HardwareTracerPtr(new cHardwareStatusPrinter(m_world->GetNewWorld(), (const char*)filename, true));
   m_minitrace = true;
+  BindSingleProcess();
 }
 
 void cHardwareBase::RecordMicroTrace(const Instruction& cur_inst)
@@ -1466,6 +1497,7 @@ void cHardwareBase::DeleteMiniTrace(bool print_reacs, bool repro_split)
     
     m_tracer = HardwareTracerPtr(NULL);
     m_minitrace = false;
+    BindSingleProcess();
   }
 }
 
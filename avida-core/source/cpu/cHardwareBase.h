@@ -111,6 +111,21 @@ protected:
 	static const unsigned int MASKOFF_LOWEST12       = 0xFFFFF000;
 	static const unsigned int MASKOFF_LOWEST8        = 0xFFFFFF00;
 	static const unsigned int MASKOFF_LOWEST4        = 0xFFFFFFF0;
+  
+  // --------  SingleProcess specialization  ---------
+  // Features that an execute loop compiled for a particular set must test for.  Hardware that supplies such loops binds
+  // the matching one in BindSingleProcess(), which is called again whenever any of these may have changed.  Settings
+  // that can change at run time without a rebind (NO_CPU_CYCLE_TIME) are read on every call instead.  cHardwareGP8 and
+  // cHardwareBCR are not specialized and keep their single general loop.
+  enum {
+    SP_COSTS = 0x01,            // Instruction costs or task switching penalties
+    SP_PROMOTERS = 0x02,        // Promoter model
+    SP_REGULATION = 0x04,       // Constitutive regulation
+    SP_TRACE = 0x08,            // Execution tracer attached
+    SP_THREAD_PARALLEL = 0x10,  // All threads executed each time slice
+    SP_PROB_FAIL = 0x20,        // Instruction set has instructions with a probability of failure
+    SP_ALL = 0x3F
+  };
 	
   cHardwareBase(); // @not_implemented
   cHardwareBase(const cHardwareBase&); // @not_implemented
@@ -141,11 +156,15 @@ public:
   
   // --------  Helper methods  --------
   virtual int GetType() const = 0;
+  // Hardware supporting speculative execution must flag every instruction that reads or alters resources, cells or
+  // neighbors as STALL or SHARED_STATE, since parallel updates run the rest on worker threads
   virtual bool SupportsSpeculative() const = 0;
   virtual void PrintStatus(std::ostream& fp) = 0;
   virtual void PrintMiniTraceStatus(cAvidaContext& ctx, std::ostream& fp) = 0;
   virtual void PrintMiniTraceSuccess(std::ostream& fp, const int exec_success) = 0;
-  void SetTrace(HardwareTracerPtr tracer) { m_tracer = tracer; }
+  void SetTrace(HardwareTracerPtr tracer) { m_tracer = tracer; BindSingleProcess(); }
+  virtual void BindSingleProcess() { ; }
+  bool IsTraced() const { if (m_tracer) return true; return (m_minitrace || m_microtrace || m_topnavtrace || m_reprotrace); }
   void SetMiniTrace(const cString& filename);
   void SetMicroTrace() { m_microtrace = true; } 
   void SetTopNavTrace(bool nav_trace) { m_topnavtrace = nav_trace; }
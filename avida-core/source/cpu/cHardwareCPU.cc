@@ -34,6 +34,7 @@
 #include "cHardwareManager.h"
 #include "cHardwareTracer.h"
 #include "cInstSet.h"
+#include "cNopLabelIndex.h"
 #include "cOrganism.h"
 #include "cOrgMessage.h"
 #include "cPhenotype.h"
@@ -109,10 +110,10 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("if-grt-X", &cHardwareCPU::Inst_IfGrX, INST_CLASS_CONDITIONAL),
     tInstLibEntry<tMethod>("if-equ-X", &cHardwareCPU::Inst_IfEquX, INST_CLASS_CONDITIONAL),
 		
-    tInstLibEntry<tMethod>("if-aboveResLevel", &cHardwareCPU::Inst_IfAboveResLevel, INST_CLASS_CONDITIONAL),
-    tInstLibEntry<tMethod>("if-aboveResLevel.end", &cHardwareCPU::Inst_IfAboveResLevelEnd, INST_CLASS_CONDITIONAL),
-    tInstLibEntry<tMethod>("if-notAboveResLevel", &cHardwareCPU::Inst_IfNotAboveResLevel, INST_CLASS_CONDITIONAL),
-    tInstLibEntry<tMethod>("if-notAboveResLevel.end", &cHardwareCPU::Inst_IfNotAboveResLevelEnd, INST_CLASS_CONDITIONAL),
+    tInstLibEntry<tMethod>("if-aboveResLevel", &cHardwareCPU::Inst_IfAboveResLevel, INST_CLASS_CONDITIONAL, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("if-aboveResLevel.end", &cHardwareCPU::Inst_IfAboveResLevelEnd, INST_CLASS_CONDITIONAL, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("if-notAboveResLevel", &cHardwareCPU::Inst_IfNotAboveResLevel, INST_CLASS_CONDITIONAL, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("if-notAboveResLevel.end", &cHardwareCPU::Inst_IfNotAboveResLevelEnd, INST_CLASS_CONDITIONAL, nInstFlag::SHARED_STATE),
     
     tInstLibEntry<tMethod>("if-germ", &cHardwareCPU::Inst_IfGerm),
     tInstLibEntry<tMethod>("if-soma", &cHardwareCPU::Inst_IfSoma),
@@ -258,24 +259,24 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("collect", &cHardwareCPU::Inst_Collect, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("collect-no-env-remove", &cHardwareCPU::Inst_CollectNoEnvRemove, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("destroy", &cHardwareCPU::Inst_Destroy, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
-    tInstLibEntry<tMethod>("nop-collect", &cHardwareCPU::Inst_NopCollect, INST_CLASS_ENVIRONMENT),
+    tInstLibEntry<tMethod>("nop-collect", &cHardwareCPU::Inst_NopCollect, INST_CLASS_ENVIRONMENT, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("collect-unit-prob", &cHardwareCPU::Inst_CollectUnitProbabilistic, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("collect-specific", &cHardwareCPU::Inst_CollectSpecific, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("collect-needed", &cHardwareCPU::Inst_CollectSpecificNeeded, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("collect-specific-ratio", &cHardwareCPU::Inst_CollectSpecificRatio, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
 
-    tInstLibEntry<tMethod>("donate-rnd", &cHardwareCPU::Inst_DonateRandom),
-    tInstLibEntry<tMethod>("donate-kin", &cHardwareCPU::Inst_DonateKin),
-    tInstLibEntry<tMethod>("donate-edt", &cHardwareCPU::Inst_DonateEditDist),
+    tInstLibEntry<tMethod>("donate-rnd", &cHardwareCPU::Inst_DonateRandom, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-kin", &cHardwareCPU::Inst_DonateKin, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-edt", &cHardwareCPU::Inst_DonateEditDist, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("get-faced-edit-dist", &cHardwareCPU::Inst_GetFacedEditDistance),
-    tInstLibEntry<tMethod>("donate-gbg",  &cHardwareCPU::Inst_DonateGreenBeardGene),
-    tInstLibEntry<tMethod>("donate-tgb",  &cHardwareCPU::Inst_DonateTrueGreenBeard),
-    tInstLibEntry<tMethod>("donate-shadedgb",  &cHardwareCPU::Inst_DonateShadedGreenBeard),
-    tInstLibEntry<tMethod>("donate-threshgb",  &cHardwareCPU::Inst_DonateThreshGreenBeard),
-    tInstLibEntry<tMethod>("donate-quantagb",  &cHardwareCPU::Inst_DonateQuantaThreshGreenBeard),
-    tInstLibEntry<tMethod>("donate-gbsl",  &cHardwareCPU::Inst_DonateGreenBeardSameLocus),
-    tInstLibEntry<tMethod>("donate-NUL", &cHardwareCPU::Inst_DonateNULL),
-    tInstLibEntry<tMethod>("donate-facing", &cHardwareCPU::Inst_DonateFacing),
+    tInstLibEntry<tMethod>("donate-gbg",  &cHardwareCPU::Inst_DonateGreenBeardGene, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-tgb",  &cHardwareCPU::Inst_DonateTrueGreenBeard, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-shadedgb",  &cHardwareCPU::Inst_DonateShadedGreenBeard, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-threshgb",  &cHardwareCPU::Inst_DonateThreshGreenBeard, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-quantagb",  &cHardwareCPU::Inst_DonateQuantaThreshGreenBeard, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-gbsl",  &cHardwareCPU::Inst_DonateGreenBeardSameLocus, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-NUL", &cHardwareCPU::Inst_DonateNULL, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("donate-facing", &cHardwareCPU::Inst_DonateFacing, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("receive-donated-energy", &cHardwareCPU::Inst_ReceiveDonatedEnergy, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("donate-energy", &cHardwareCPU::Inst_DonateEnergy, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("update-metabolic-rate", &cHardwareCPU::Inst_UpdateMetabolicRate, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
@@ -544,7 +545,7 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("terminate", &cHardwareCPU::Inst_Terminate, INST_CLASS_FLOW_CONTROL),
     tInstLibEntry<tMethod>("regulate", &cHardwareCPU::Inst_Regulate, INST_CLASS_FLOW_CONTROL),
     tInstLibEntry<tMethod>("regulate-sp", &cHardwareCPU::Inst_RegulateSpecificPromoters, INST_CLASS_FLOW_CONTROL),
-    tInstLibEntry<tMethod>("s-regulate", &cHardwareCPU::Inst_SenseRegulate, INST_CLASS_FLOW_CONTROL),
+    tInstLibEntry<tMethod>("s-regulate", &cHardwareCPU::Inst_SenseRegulate, INST_CLASS_FLOW_CONTROL, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("numberate", &cHardwareCPU::Inst_Numberate, INST_CLASS_DATA),
     tInstLibEntry<tMethod>("numberate-24", &cHardwareCPU::Inst_Numberate24, INST_CLASS_DATA),
     
@@ -619,15 +620,15 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("phero-off", &cHardwareCPU::Inst_PheroOff),
     tInstLibEntry<tMethod>("pherotoggle", &cHardwareCPU::Inst_PheroToggle),
     tInstLibEntry<tMethod>("sense-target", &cHardwareCPU::Inst_SenseTarget),
-    tInstLibEntry<tMethod>("sense-target-faced", &cHardwareCPU::Inst_SenseTargetFaced),
-    tInstLibEntry<tMethod>("sensef", &cHardwareCPU::Inst_SenseLog2Facing),
-    tInstLibEntry<tMethod>("sensef-unit", &cHardwareCPU::Inst_SenseUnitFacing),
-    tInstLibEntry<tMethod>("sensef-m100", &cHardwareCPU::Inst_SenseMult100Facing),
-    tInstLibEntry<tMethod>("sense-pheromone", &cHardwareCPU::Inst_SensePheromone),
-    tInstLibEntry<tMethod>("sense-pheromone-faced", &cHardwareCPU::Inst_SensePheromoneFaced),
-    tInstLibEntry<tMethod>("sense-pheromone-inDemeGlobal", &cHardwareCPU::Inst_SensePheromoneInDemeGlobal),
-    tInstLibEntry<tMethod>("sense-pheromone-global", &cHardwareCPU::Inst_SensePheromoneGlobal),
-    tInstLibEntry<tMethod>("sense-pheromone-global-defaultAX", &cHardwareCPU::Inst_SensePheromoneGlobal_defaultAX),
+    tInstLibEntry<tMethod>("sense-target-faced", &cHardwareCPU::Inst_SenseTargetFaced, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sensef", &cHardwareCPU::Inst_SenseLog2Facing, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sensef-unit", &cHardwareCPU::Inst_SenseUnitFacing, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sensef-m100", &cHardwareCPU::Inst_SenseMult100Facing, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sense-pheromone", &cHardwareCPU::Inst_SensePheromone, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sense-pheromone-faced", &cHardwareCPU::Inst_SensePheromoneFaced, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sense-pheromone-inDemeGlobal", &cHardwareCPU::Inst_SensePheromoneInDemeGlobal, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sense-pheromone-global", &cHardwareCPU::Inst_SensePheromoneGlobal, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("sense-pheromone-global-defaultAX", &cHardwareCPU::Inst_SensePheromoneGlobal_defaultAX, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("exploit", &cHardwareCPU::Inst_Exploit, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("exploit-forward5", &cHardwareCPU::Inst_ExploitForward5, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("exploit-forward3", &cHardwareCPU::Inst_ExploitForward3, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
@@ -638,8 +639,8 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("supermove", &cHardwareCPU::Inst_SuperMove, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("if-target", &cHardwareCPU::Inst_IfTarget),
     tInstLibEntry<tMethod>("if-not-target", &cHardwareCPU::Inst_IfNotTarget),
-    tInstLibEntry<tMethod>("if-pheromone", &cHardwareCPU::Inst_IfPheromone),
-    tInstLibEntry<tMethod>("if-not-pheromone", &cHardwareCPU::Inst_IfNotPheromone),
+    tInstLibEntry<tMethod>("if-pheromone", &cHardwareCPU::Inst_IfPheromone, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("if-not-pheromone", &cHardwareCPU::Inst_IfNotPheromone, INST_CLASS_OTHER, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("drop-pheromone", &cHardwareCPU::Inst_DropPheromone, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     
     // Opinion instructions.
@@ -661,8 +662,8 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
     tInstLibEntry<tMethod>("read-faced-cell-data", &cHardwareCPU::Inst_ReadFacedCellData, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("read-faced-cell-org-id", &cHardwareCPU::Inst_ReadFacedCellDataOrgID, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
     tInstLibEntry<tMethod>("read-faced-cell-freshness", &cHardwareCPU::Inst_ReadFacedCellDataFreshness, INST_CLASS_ENVIRONMENT, nInstFlag::STALL),
-    tInstLibEntry<tMethod>("mark-cell-with-id", &cHardwareCPU::Inst_MarkCellWithID, INST_CLASS_ENVIRONMENT),
-    tInstLibEntry<tMethod>("mark-cell-with-vitality", &cHardwareCPU::Inst_MarkCellWithVitality, INST_CLASS_ENVIRONMENT),
+    tInstLibEntry<tMethod>("mark-cell-with-id", &cHardwareCPU::Inst_MarkCellWithID, INST_CLASS_ENVIRONMENT, nInstFlag::SHARED_STATE),
+    tInstLibEntry<tMethod>("mark-cell-with-vitality", &cHardwareCPU::Inst_MarkCellWithVitality, INST_CLASS_ENVIRONMENT, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("get-res-stored", &cHardwareCPU::Inst_GetResStored, INST_CLASS_ENVIRONMENT),
     tInstLibEntry<tMethod>("get-id", &cHardwareCPU::Inst_GetID, INST_CLASS_ENVIRONMENT),
     tInstLibEntry<tMethod>("get-faced-vitality-diff", &cHardwareCPU::Inst_GetFacedVitalityDiff, INST_CLASS_ENVIRONMENT, nInstFlag::STALL), 
@@ -777,7 +778,6 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   m_epigenetic_state = false;
   
   m_thread_slicing_parallel = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1);
-  m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
   
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
@@ -792,6 +792,8 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   
   Reset(ctx);                            // Setup the rest of the hardware...
   internalReset();
+  
+  BindSingleProcess();
 }
 
 bool cHardwareCPU::checkNoMutList(cHeadCPU to)
@@ -902,12 +904,42 @@ void cHardwareCPU::cLocalThread::Reset(cHardwareBase* in_hardware, int in_id)
 void cHardwareCPU::SetupMiniTraceFileHeader(Avida::Output::File& df, const int gen_id, const Apto::String& genotype) { (void)df, (void)gen_id, (void)genotype; }
 
 
+// Select the SingleProcess() specialization for the features currently in use.  Specializations exist for the common
+// cases of no special features, tracing only, costs only and probabilistic failure only; anything else uses the
+// general loop that tests every feature at run time.
+
+void cHardwareCPU::BindSingleProcess()
+{
+  int features = 0;
+  if (m_has_any_costs) features |= SP_COSTS;
+  if (m_promoters_enabled) features |= SP_PROMOTERS;
+  if (m_constitutive_regulation) features |= SP_REGULATION;
+  if (m_tracer) features |= SP_TRACE;
+  if (m_thread_slicing_parallel) features |= SP_THREAD_PARALLEL;
+  if (m_inst_set->HasProbFail()) features |= SP_PROB_FAIL;
+  
+  switch (features) {
+    case 0:             m_single_process = &cHardwareCPU::singleProcess<0>; break;
+    case SP_TRACE:      m_single_process = &cHardwareCPU::singleProcess<SP_TRACE>; break;
+    case SP_COSTS:      m_single_process = &cHardwareCPU::singleProcess<SP_COSTS>; break;
+    case SP_PROB_FAIL:  m_single_process = &cHardwareCPU::singleProcess<SP_PROB_FAIL>; break;
+    default:            m_single_process = &cHardwareCPU::singleProcess<SP_ALL>; break;
+  }
+}
+
+
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
+//
+// FEATURES is the set of SP_* features this specialization supports; tests for any others are compiled out.
 
-bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
+template <int FEATURES> bool cHardwareCPU::singleProcess(cAvidaContext& ctx, bool speculative)
 {
-  assert(!speculative || (speculative && !m_thread_slicing_parallel));
+  const bool thread_slicing_parallel = (FEATURES & SP_THREAD_PARALLEL) && m_thread_slicing_parallel;
+  const bool promoters_enabled = (FEATURES & SP_PROMOTERS) && m_promoters_enabled;
+  const bool no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
+  
+  assert(!speculative || (speculative && !thread_slicing_parallel));
   
   int last_IP_pos = getIP().GetPosition();
   
@@ -923,17 +955,17 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
+  if (promoters_enabled && phenotype.GetCPUCyclesUsed() == 0) Inst_Terminate(ctx);
   
   // Count the cpu cycles used
   phenotype.IncCPUCyclesUsed();
-  if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
+  if (!no_cpu_cycle_time) phenotype.IncTimeUsed();
   
   int num_threads = m_threads.GetSize();
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  int num_inst_exec = m_thread_slicing_parallel ? num_threads : 1;
+  int num_inst_exec = thread_slicing_parallel ? num_threads : 1;
   
   //  bool isInterruptEnabled(false);
   //  if (m_world->GetConfig().ACTIVE_MESSAGES_ENABLED.Get() == 1)
@@ -953,7 +985,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
@@ -962,20 +994,20 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
       phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (!no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
       m_organism->SetRunning(false);
       return false;
     }
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    if ((FEATURES & SP_COSTS) && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     
     // Constitutive regulation applied here
-    if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+    if ((FEATURES & SP_REGULATION) && m_constitutive_regulation) Inst_SenseRegulate(ctx); 
     
     // If there are no active promoters and a certain mode is set, then don't execute any further instructions
-    if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    if (promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
     
     // Now execute the instruction...
     if (exec == true) {
@@ -985,7 +1017,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       const int time_cost = m_inst_set->GetAddlTimeCost(cur_inst);
       
       // Prob of exec (moved from SingleProcess_PayCosts so that we advance IP after a fail)
-      if (m_inst_set->GetProbFail(cur_inst) > 0.0) {
+      if ((FEATURES & SP_PROB_FAIL) && m_inst_set->GetProbFail(cur_inst) > 0.0) {
         exec = !( ctx.GetRandom().P(m_inst_set->GetProbFail(cur_inst)) );
       }
       
@@ -996,7 +1028,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       getIP().SetFlagExecuted();
       
       // Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
@@ -1016,7 +1048,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) Inst_Terminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() && (m_threads[m_cur_thread].GetPromoterInstExecuted() >= m_world->GetConfig().PROMOTER_INST_MAX.Get())) 
@@ -1217,81 +1249,21 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
 // to find search label's match inside another label.
 
 int cHardwareCPU::FindLabel_Forward(const cCodeLabel & search_label,
-                                    const InstructionSequence & search_genome, int pos)
+                                    const cCPUMemory& search_genome, int pos)
 {
   assert (pos < search_genome.GetSize() && pos >= 0);
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos += label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-    
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-             m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-        start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-             m_inst_set->IsNop( search_genome[end_pos] )) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        // pos = end_pos;
-        pos = label_size + offset;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
+  const cNopLabelIndex& nop_index = search_genome.GetNopLabelIndex(*m_inst_set);
+  const int label_size = search_label.GetSize();
+
+  // Find the first match starting at or after pos.  The scan this replaces stepped off the template it started on by
+  // label_size sites before looking, so a match filling the rest of the nop run at pos exactly is passed over.
+  int found = 0;
+  if (!nop_index.FindNopSequenceFrom(search_label, pos, found)) return -1;
+  if (found == pos && nop_index.GetRunEnd(pos) == pos + label_size) {
+    if (!nop_index.FindNopSequenceFrom(search_label, pos + 1, found)) return -1;
   }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
+
+  return found + label_size;
 }
 
 // Search backwards for search_label from _before_ position pos in the
@@ -1299,77 +1271,16 @@ int cHardwareCPU::FindLabel_Forward(const cCodeLabel & search_label,
 // to find search label's match inside another label.
 
 int cHardwareCPU::FindLabel_Backward(const cCodeLabel & search_label,
-                                     const InstructionSequence & search_genome, int pos)
+                                     const cCPUMemory& search_genome, int pos)
 {
   assert (pos < search_genome.GetSize());
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos -= label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-        start_pos--;
-      }
-      while (end_pos < search_start &&
-             m_inst_set->IsNop(search_genome[end_pos])) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod(search_genome[offset + matches])) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        pos = end_pos;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
+  const cNopLabelIndex& nop_index = search_genome.GetNopLabelIndex(*m_inst_set);
+
+  // Find the last match ending at or before pos, and return the end of the nop run holding it (cut off at pos)
+  int found = 0;
+  if (!nop_index.FindNopSequenceBefore(search_label, pos, found)) return -1;
+
+  return Apto::Min(nop_index.GetRunEnd(found), pos);
 }
 
 // Search for 'in_label' anywhere in the hardware.
@@ -1413,40 +1324,27 @@ void cHardwareCPU::FindLabelInMemory(const cCodeLabel& label, cHeadCPU& search_h
 {
   assert(label.GetSize() > 0); // Trying to find label of 0 size!
   
+  const cNopLabelIndex& nop_index = search_head.GetMemory().GetNopLabelIndex(*m_inst_set);
   
   while (search_head.InMemory()) {
     // If we are not in a label, jump to the next checkpoint...
-    if (!m_inst_set->IsNop(search_head.GetInst())) {
+    const int pos = search_head.GetPosition();
+    if (!nop_index.IsNop(pos)) {
       search_head.AbsJump(label.GetSize());
       continue;
     }
     
-    // Otherwise, rewind to the begining of this label...
-    
-    while (!(search_head.AtFront()) && m_inst_set->IsNop(search_head.GetInst(-1)))
-      search_head.AbsJump(-1);
-    
-    // Calculate the size of the label being checked, and make sure they
-    // are equal.
-    
-    int size = 0;
-    bool label_match = true;
-    do {
-      // Check if the nop matches
-      if (size < label.GetSize() && label[size] != m_inst_set->GetNopMod(search_head.GetInst()))
-        label_match = false;
-      
-      // Increment the current position and length calculation
-      search_head.AbsJump(1);
-      size++;
-      
-      // While still within memory and the instruction is a nop
-    } while (search_head.InMemory() && m_inst_set->IsNop(search_head.GetInst()));
+    // Otherwise, take the whole label we are in; search_head will point to the first non-nop instruction after the
+    // label, or the end of the memory space
+    const int label_start = nop_index.GetRunStart(pos);
+    const int size = nop_index.GetRunEnd(pos) - label_start;
+    search_head.AbsSet(label_start + size);
     
+    // Make sure the sizes are equal, and if the nops match return this position
     if (size != label.GetSize()) continue;
     
-    // temp_head will point to the first non-nop instruction after the label, or the end of the memory space
-    //   if this is a match, return this position
+    bool label_match = true;
+    for (int i = 0; i < size && label_match; i++) label_match = (label[i] == nop_index.GetNopMod(label_start + i));
     if (label_match) return;
   }
   
@@ -1895,7 +1793,7 @@ bool cHardwareCPU::Divide_MainRS(cAvidaContext& ctx, const int div_point,
     }
     else{
       mutations = Divide_DoMutations(ctx, mut_multiplier);
-      m_world->GetStats().IncResamplings();
+      if (!ctx.GetWorkerMode()) m_world->GetStats().IncResamplings();
     }
     
     fitTest = Divide_TestFitnessMeasures1(ctx);
@@ -1911,7 +1809,7 @@ bool cHardwareCPU::Divide_MainRS(cAvidaContext& ctx, const int div_point,
   //org could not be resampled beneath the hard cap -- it is then steraalized
   if (fitTest/*RScount == 11*/) {
     m_organism->GetPhenotype().ChildFertile() = false;
-    m_world->GetStats().IncFailedResamplings();
+    if (!ctx.GetWorkerMode()) m_world->GetStats().IncFailedResamplings();
   }
   
   if (m_world->GetConfig().DIVIDE_METHOD.Get() != DIVIDE_METHOD_OFFSPRING) {
@@ -1990,7 +1888,7 @@ bool cHardwareCPU::Divide_Main1RS(cAvidaContext& ctx, const int div_point,
   for (int i = 0; i < 100; i++) {
     if (i > 0) {
       mutations = Divide_DoExactMutations(ctx, mut_multiplier,1);
-      m_world->GetStats().IncResamplings();
+      if (!ctx.GetWorkerMode()) m_world->GetStats().IncResamplings();
     }
     
     fitTest = Divide_TestFitnessMeasures1(ctx);
@@ -2006,7 +1904,7 @@ bool cHardwareCPU::Divide_Main1RS(cAvidaContext& ctx, const int div_point,
   //org could not be resampled beneath the hard cap -- it is then steraalized
   if (fitTest/*RScount == 11*/) {
     m_organism->GetPhenotype().ChildFertile() = false;
-    m_world->GetStats().IncFailedResamplings();
+    if (!ctx.GetWorkerMode()) m_world->GetStats().IncFailedResamplings();
   }
   
   if (m_world->GetConfig().DIVIDE_METHOD.Get() != DIVIDE_METHOD_OFFSPRING) {
@@ -2086,7 +1984,7 @@ bool cHardwareCPU::Divide_Main2RS(cAvidaContext& ctx, const int div_point,
     }
     else{
       Divide_DoExactMutations(ctx, mut_multiplier,mutations);
-      m_world->GetStats().IncResamplings();
+      if (!ctx.GetWorkerMode()) m_world->GetStats().IncResamplings();
     }
     
     fitTest = Divide_TestFitnessMeasures(ctx);
@@ -2102,7 +2000,7 @@ bool cHardwareCPU::Divide_Main2RS(cAvidaContext& ctx, const int div_point,
   //org could not be resampled beneath the hard cap -- it is then steraalized
   if (fitTest/*RScount == 11*/) {
     m_organism->GetPhenotype().ChildFertile() = false;
-    m_world->GetStats().IncFailedResamplings();
+    if (!ctx.GetWorkerMode()) m_world->GetStats().IncFailedResamplings();
   }
   
   if (m_world->GetConfig().DIVIDE_METHOD.Get() != DIVIDE_METHOD_OFFSPRING) {
@@ -2343,7 +2241,6 @@ bool cHardwareCPU::Inst_IfAboveResLevel(cAvidaContext& ctx)
   const double resCrossoverLevel = 100;
   
   const cResourceLib& resLib = m_world->GetEnvironment().GetResourceLib();
-  const Apto::Array<double>& resource_count_array =  GetOrganism()->GetOrgInterface().GetResources(ctx);
   const cResourceCount& resource_count = m_world->GetPopulation().GetResourceCount();
   
   if (resource_count.GetSize() == 0) assert(false); // change to: return false;
@@ -2352,7 +2249,7 @@ bool cHardwareCPU::Inst_IfAboveResLevel(cAvidaContext& ctx)
   cResource* res = resLib.GetResource("pheromone");
   
   if (strncmp(resource_count.GetResName(res->GetID()), "pheromone", 9) == 0) {
-    pher_amount += resource_count_array[res->GetID()];
+    pher_amount += m_organism->GetOrgInterface().GetResourceVal(ctx, res->GetID());
   }
 	
   if (pher_amount > resCrossoverLevel) {
@@ -2368,7 +2265,6 @@ bool cHardwareCPU::Inst_IfAboveResLevelEnd(cAvidaContext& ctx)
   
   const cResourceLib& resLib = m_world->GetEnvironment().GetResourceLib();
   
-  const Apto::Array<double>& resource_count_array =  GetOrganism()->GetOrgInterface().GetResources(ctx);
   const cResourceCount& resource_count = m_world->GetPopulation().GetResourceCount();
 	
   if (resource_count.GetSize() == 0) assert(false); // change to: return false;
@@ -2377,7 +2273,7 @@ bool cHardwareCPU::Inst_IfAboveResLevelEnd(cAvidaContext& ctx)
   cResource* res = resLib.GetResource("pheromone");
   
   if (strncmp(resource_count.GetResName(res->GetID()), "pheromone", 9) == 0) {
-    pher_amount += resource_count_array[res->GetID()];
+    pher_amount += m_organism->GetOrgInterface().GetResourceVal(ctx, res->GetID());
   }
 	
   if (pher_amount > resCrossoverLevel) {
@@ -2393,7 +2289,6 @@ bool cHardwareCPU::Inst_IfNotAboveResLevel(cAvidaContext& ctx)
 	
   const cResourceLib& resLib = m_world->GetEnvironment().GetResourceLib();
   
-  const Apto::Array<double>& resource_count_array =  GetOrganism()->GetOrgInterface().GetResources(ctx);
   const cResourceCount& resource_count = m_world->GetPopulation().GetResourceCount();
   
   if (resource_count.GetSize() == 0) assert(false); // change to: return false;
@@ -2402,7 +2297,7 @@ bool cHardwareCPU::Inst_IfNotAboveResLevel(cAvidaContext& ctx)
   cResource* res = resLib.GetResource("pheromone");
   
   if (strncmp(resource_count.GetResName(res->GetID()), "pheromone", 9) == 0) {
-    pher_amount += resource_count_array[res->GetID()];
+    pher_amount += m_organism->GetOrgInterface().GetResourceVal(ctx, res->GetID());
   }
 	
   if (pher_amount <= resCrossoverLevel) {
@@ -2417,7 +2312,6 @@ bool cHardwareCPU::Inst_IfNotAboveResLevelEnd(cAvidaContext& ctx)
   const double resCrossoverLevel = 100;
   
   const cResourceLib& resLib = m_world->GetEnvironment().GetResourceLib();
-  const Apto::Array<double>& resource_count_array =  GetOrganism()->GetOrgInterface().GetResources(ctx);
   const cResourceCount& resource_count = m_world->GetPopulation().GetResourceCount();
   
   if (resource_count.GetSize() == 0) assert(false); // change to: return false;
@@ -2426,7 +2320,7 @@ bool cHardwareCPU::Inst_IfNotAboveResLevelEnd(cAvidaContext& ctx)
   cResource* res = resLib.GetResource("pheromone");
   
   if (strncmp(resource_count.GetResName(res->GetID()), "pheromone", 9) == 0) {
-    pher_amount += resource_count_array[res->GetID()];
+    pher_amount += m_organism->GetOrgInterface().GetResourceVal(ctx, res->GetID());
   }
   
   if (pher_amount <= resCrossoverLevel) {
@@ -3550,8 +3444,10 @@ bool cHardwareCPU::Inst_SenseQuorum(cAvidaContext& ctx) {
   //cout << GetRegister(FindModifiedRegister(REG_BX)) << endl;
   //cout << org_ratio << endl;
   
-  m_world->GetStats().IncQuorumThresholdUB(org_ratio);
-  m_world->GetStats().IncQuorumNum();
+  if (!ctx.GetWorkerMode()) {
+    m_world->GetStats().IncQuorumThresholdUB(org_ratio);
+    m_world->GetStats().IncQuorumNum();
+  }
   if ((int)(ratio*100) <=org_ratio){
     //trying out with a register instead
     GetRegister(FindModifiedRegister(REG_AX)) = true;
@@ -3624,8 +3520,10 @@ bool cHardwareCPU::Inst_NoisyQuorum(cAvidaContext& ctx) {
   //cout << GetRegister(FindModifiedRegister(REG_BX)) << endl;
   //cout << org_ratio << endl;
   
-  m_world->GetStats().IncQuorumThresholdUB(org_ratio);
-  m_world->GetStats().IncQuorumNum();
+  if (!ctx.GetWorkerMode()) {
+    m_world->GetStats().IncQuorumThresholdUB(org_ratio);
+    m_world->GetStats().IncQuorumNum();
+  }
   if ((int)(ratio*100*noise) <=org_ratio){
     GetRegister(FindModifiedRegister(REG_AX)) = true;
   } else GetRegister(FindModifiedRegister(REG_AX)) = false;
@@ -3645,7 +3543,7 @@ bool cHardwareCPU::Inst_SmartExplode(cAvidaContext& ctx)
     int distance = (int) m_world->GetConfig().KABOOM_HAMMING.Get();
     if ( ctx.GetRandom().P(percent_prob) ) m_organism->Kaboom(distance, ctx);
   } else {
-    m_world->GetStats().IncDontExplode();
+    if (!ctx.GetWorkerMode()) m_world->GetStats().IncDontExplode();
   }
   return true;
 }
@@ -3662,12 +3560,14 @@ bool cHardwareCPU::Inst_Lyse(cAvidaContext& ctx)
   }
   if (ctx.GetRandom().P(percent_prob)) { 
     m_organism->GetPhenotype().SetKaboomExecuted(true);
-    m_world->GetStats().IncKaboom();
-    m_world->GetStats().IncPercLyse(percent_prob);
-    cpu_cycles = m_organism->GetPhenotype().GetCPUCyclesUsed();
-    m_world->GetStats().IncSumCPUs(cpu_cycles);
+    if (!ctx.GetWorkerMode()) {
+      m_world->GetStats().IncKaboom();
+      m_world->GetStats().IncPercLyse(percent_prob);
+      cpu_cycles = m_organism->GetPhenotype().GetCPUCyclesUsed();
+      m_world->GetStats().IncSumCPUs(cpu_cycles);
+    }
   } else {
-    m_world->GetStats().IncDontExplode();
+    if (!ctx.GetWorkerMode()) m_world->GetStats().IncDontExplode();
   }
   return true;
 }
@@ -4075,7 +3975,7 @@ bool cHardwareCPU::Inst_RelinquishEnergyToFutureDeme(cAvidaContext& ctx)
   cDeme* deme = m_organism->GetOrgInterface().GetDeme();
   if (deme == NULL) return false;  // in test CPU
   deme->IncreaseTotalEnergyTestament(stored_energy);
-  m_world->GetStats().SumEnergyTestamentToFutureDeme().Add(stored_energy);
+  if (!ctx.GetWorkerMode()) m_world->GetStats().SumEnergyTestamentToFutureDeme().Add(stored_energy);
   m_organism->Die(ctx);
   return true;
 }
@@ -4101,7 +4001,7 @@ bool cHardwareCPU::Inst_RelinquishEnergyToNeighborOrganisms(cAvidaContext& ctx)
     m_organism->Rotate(ctx, 1);
   }
   
-  m_world->GetStats().SumEnergyTestamentToNeighborOrganisms().Add(stored_energy);
+  if (!ctx.GetWorkerMode()) m_world->GetStats().SumEnergyTestamentToNeighborOrganisms().Add(stored_energy);
   m_organism->Die(ctx);
   
   return true;
@@ -4113,7 +4013,7 @@ bool cHardwareCPU::Inst_RelinquishEnergyToOrganismsInDeme(cAvidaContext& ctx)
   // put stored energy into toBeApplied energy pool of neighbor organisms
   
   m_organism->DivideOrgTestamentAmongDeme(stored_energy);
-  m_world->GetStats().SumEnergyTestamentToDemeOrganisms().Add(stored_energy);
+  if (!ctx.GetWorkerMode()) m_world->GetStats().SumEnergyTestamentToDemeOrganisms().Add(stored_energy);
   m_organism->Die(ctx);
   return true;
 }
@@ -4294,8 +4194,8 @@ bool cHardwareCPU::DoSense(cAvidaContext& ctx, int conversion_method, double bas
 {
   // Returns the amount of a resource or resources 
   // specified by modifying NOPs into register BX
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx) +
-  m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx); 
+  cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
+  res_count.AppendDemeResources(m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx));
   
   // Arbitrarily set to BX since the conditional instructions use this directly.
   int reg_to_set = REG_BX;
@@ -4432,8 +4332,8 @@ bool cHardwareCPU::DoSenseResourceX(int reg_to_set, int cell_id, int resid, cAvi
 {
   assert(resid >= 0);
 
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx) +
-  m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx); 
+  cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
+  res_count.AppendDemeResources(m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx));
 
   // Make sure we have the resource requested
   if (resid >= res_count.GetSize()) return false;
@@ -4446,7 +4346,7 @@ bool cHardwareCPU::DoSenseResourceX(int reg_to_set, int cell_id, int resid, cAvi
 
 bool cHardwareCPU::Inst_SenseResourceID(cAvidaContext& ctx)
 {
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   int reg_to_set = FindModifiedRegister(REG_BX);  
   double max_resource = 0.0;    
   // if more than one resource is available, return the resource ID with the most available in this spot (note that, with global resources, the GLOBAL total will evaluated)
@@ -4461,11 +4361,10 @@ bool cHardwareCPU::Inst_SenseResourceID(cAvidaContext& ctx)
 
 bool cHardwareCPU::Inst_SenseOpinionResourceQuantity(cAvidaContext& ctx)
 {
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
   // check if this is a valid group
   if(m_organism->GetOrgInterface().HasOpinion(m_organism)) {
     int opinion = m_organism->GetOpinion().first;
-    int res_opinion = (int) (res_count[opinion] * 100 + 0.5);
+    int res_opinion = (int) (m_organism->GetOrgInterface().GetResourceVal(ctx, opinion) * 100 + 0.5);
     int reg_to_set = FindModifiedRegister(REG_BX);
     GetRegister(reg_to_set) = res_opinion;
   }
@@ -4485,7 +4384,7 @@ bool cHardwareCPU::Inst_SenseNextResLevel(cAvidaContext& ctx)
   if (m_world->GetConfig().USE_FORM_GROUPS.Get() != 2) return false;
   int opinion = m_organism->GetOpinion().first;
   
-  const int num_groups = m_organism->GetOrgInterface().GetResources(ctx).GetSize();
+  const int num_groups = m_organism->GetOrgInterface().GetResourceView(ctx).GetSize();
   if (num_groups <= 2) return false;
   
   // If not nop-modified, fails to execute.
@@ -4495,7 +4394,7 @@ bool cHardwareCPU::Inst_SenseNextResLevel(cAvidaContext& ctx)
   int register_value = GetRegister(nop_register);
   if (register_value == 0) return false;
   
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   if (opinion == (num_groups - 1)) {
     if (register_value > 0) GetRegister(REG_BX) = (int) (res_count[1] * 100 + 0.5);
     else if (register_value < 0) GetRegister(REG_BX) = (int) (res_count[opinion - 1] * 100 + 0.5);
@@ -4513,15 +4412,15 @@ bool cHardwareCPU::Inst_SenseNextResLevel(cAvidaContext& ctx)
 
 bool cHardwareCPU::Inst_SenseDiffFaced(cAvidaContext& ctx) 
 {
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
   if(m_organism->GetOrgInterface().HasOpinion(m_organism)) {
     int opinion = m_organism->GetOpinion().first;
     int reg_to_set = FindModifiedRegister(REG_BX);
-    double faced_res = m_organism->GetOrgInterface().GetFacedCellResources(ctx)[opinion];  
+    const double res_here = m_organism->GetOrgInterface().GetResourceVal(ctx, opinion);
+    double faced_res = m_organism->GetOrgInterface().GetFacedResourceVal(ctx, opinion);  
     // return % change
     int res_diff = 0;
-    if (res_count[opinion] == 0) res_diff = (int) faced_res;
-    else res_diff = (int) (((faced_res - res_count[opinion])/res_count[opinion]) * 100 + 0.5);
+    if (res_here == 0) res_diff = (int) faced_res;
+    else res_diff = (int) (((faced_res - res_here)/res_here) * 100 + 0.5);
     GetRegister(reg_to_set) = res_diff;
   }
   return true;
@@ -4577,7 +4476,7 @@ bool cHardwareCPU::Inst_SenseFacedHabitat(cAvidaContext& ctx)
  */
 int cHardwareCPU::FindModifiedResource(cAvidaContext& ctx, int& spec_id)
 {
-  int num_resources = m_organism->GetOrgInterface().GetResources(ctx).GetSize(); 
+  int num_resources = m_organism->GetOrgInterface().GetResourceView(ctx).GetSize(); 
   
   //if there are no resources, translation cannot be successful; return false
   if (num_resources <= 0)
@@ -4650,7 +4549,7 @@ bool cHardwareCPU::DoCollect(cAvidaContext& ctx, bool env_remove, bool internal_
 bool cHardwareCPU::DoActualCollect(cAvidaContext& ctx, int bin_used, bool env_remove, bool internal_add, bool probabilistic, bool unit, float nUnits)
 {
   // Set up res_change and max total
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   Apto::Array<double> res_change(res_count.GetSize());
   res_change.SetAll(0.0);
   double total = m_organism->GetRBinsTotal();
@@ -4843,8 +4742,8 @@ bool cHardwareCPU::Inst_CollectSpecificRatio(cAvidaContext& ctx)
 bool cHardwareCPU::Inst_IfResources(cAvidaContext& ctx)
 {
   // These are the current levels of resources at this cell:
-  const Apto::Array<double> resources = m_organism->GetOrgInterface().GetResources(ctx) +
-  m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx); 
+  cResourceView resources = m_organism->GetOrgInterface().GetResourceView(ctx);
+  resources.AppendDemeResources(m_organism->GetOrgInterface().GetDemeResources(m_organism->GetOrgInterface().GetDemeID(), ctx));
   
   // Now we loop through the different reactions, checking to see if their
   // required resources are below what's available.  If so, we skip ahead an
@@ -5119,7 +5018,7 @@ bool cHardwareCPU::Inst_DonateEditDist(cAvidaContext& ctx)
         neighbor_seq_p.DynamicCastFrom(neighbor_genome.Representation());
         const InstructionSequence& neighbor_seq = *neighbor_seq_p;
         
-        edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq);
+        edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq, max_dist);
       }
       if (edit_dist <= max_dist) {
         found = true;
@@ -6162,7 +6061,7 @@ void cHardwareCPU::DoResourceDonatePercent(cAvidaContext& ctx, const int to_cell
   assert(frac_resource_given >= 0);
   assert(frac_resource_given <= 1);
   
-  const Apto::Array<double> &resources = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView resources = m_organism->GetOrgInterface().GetResourceView(ctx);
   if (resource_id >= resources.GetSize()) return;
   
   const double amount = max(0.0, frac_resource_given * resources[resource_id]);
@@ -6180,8 +6079,8 @@ void cHardwareCPU::DoResourceDonateAmount(cAvidaContext& ctx, const int to_cell,
   assert(amount >= 0);
   assert(resource_id >= 0);
   
-  const Apto::Array<double> &src_resources = m_organism->GetOrgInterface().GetResources(ctx);
-  const Apto::Array<double> &dest_resources = m_world->GetPopulation().GetCellResources(to_cell, ctx);
+  const cResourceView src_resources = m_organism->GetOrgInterface().GetResourceView(ctx);
+  const cResourceView dest_resources = m_world->GetPopulation().GetCellResourceView(ctx, to_cell);
   
   assert(resource_id < src_resources.GetSize());
   assert(resource_id < dest_resources.GetSize());
@@ -6495,24 +6394,23 @@ bool cHardwareCPU::Inst_RotateUphill(cAvidaContext& ctx)
   
   if(m_organism->GetOrgInterface().HasOpinion(m_organism)) opinion = m_organism->GetOpinion().first; 
   
-  const Apto::Array<double> current_res = m_organism->GetOrgInterface().GetResources(ctx);
+  const double current_res = m_organism->GetOrgInterface().GetResourceVal(ctx, opinion);
   double max_res = 0;
   for(int i = 0; i < actualNeighborhoodSize; i++) {
     m_organism->Rotate(ctx, 1);
-    Apto::Array<double> faced_res = m_organism->GetOrgInterface().GetFacedCellResources(ctx);
-    if (faced_res[opinion] > max_res) max_res = faced_res[opinion];
+    const double faced_res = m_organism->GetOrgInterface().GetFacedResourceVal(ctx, opinion);
+    if (faced_res > max_res) max_res = faced_res;
   } 
   
-  if (max_res > current_res[opinion]) {
+  if (max_res > current_res) {
     for(int i = 0; i < actualNeighborhoodSize; i++) {
-      Apto::Array<double> faced_res = m_organism->GetOrgInterface().GetFacedCellResources(ctx);
-      if (faced_res[opinion] != max_res) m_organism->Rotate(ctx, 1);
+      if (m_organism->GetOrgInterface().GetFacedResourceVal(ctx, opinion) != max_res) m_organism->Rotate(ctx, 1);
     }
   }
   // return % change
   int res_diff = 0;
-  if (current_res[opinion] == 0) res_diff = (int) max_res;
-  else res_diff = (int) (((max_res - current_res[opinion])/current_res[opinion]) * 100 + 0.5);
+  if (current_res == 0) res_diff = (int) max_res;
+  else res_diff = (int) (((max_res - current_res)/current_res) * 100 + 0.5);
   int reg_to_set = FindModifiedRegister(REG_BX);
   GetRegister(reg_to_set) = res_diff;
   return true;
@@ -7673,8 +7571,8 @@ bool cHardwareCPU::Inst_Sleep(cAvidaContext& ctx)
   
   cPhenotype& phenotype = m_organism->GetPhenotype();
   if (m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 2) {
-    phenotype.RefreshEnergy();
-    phenotype.ApplyToEnergyStore();
+    phenotype.RefreshEnergy(ctx);
+    phenotype.ApplyToEnergyStore(ctx);
     double newMerit = phenotype.ConvertEnergyToMerit(phenotype.GetStoredEnergy() * phenotype.GetEnergyUsageRatio());
     m_organism->UpdateMerit(ctx, newMerit);
   }
@@ -7923,7 +7821,7 @@ bool cHardwareCPU::Inst_RegulateSpecificPromoters(cAvidaContext&)
 bool cHardwareCPU::Inst_SenseRegulate(cAvidaContext& ctx)
 {
   unsigned int bits = 0;
-  const Apto::Array<double> & res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   assert (res_count.GetSize() != 0);
   for (int i=0; i<m_world->GetConfig().PROMOTER_CODE_SIZE.Get(); i++) {
     int b = i % res_count.GetSize();
@@ -8283,7 +8181,7 @@ bool cHardwareCPU::SendMessage(cAvidaContext& ctx, int messageType)
  If a message is available, ?BX? is set to the message's label, and ~?BX? is set
  to its data.
  */
-bool cHardwareCPU::Inst_RetrieveMessage(cAvidaContext&) 
+bool cHardwareCPU::Inst_RetrieveMessage(cAvidaContext& ctx) 
 {
   std::pair<bool, cOrgMessage> retrieved = m_organism->RetrieveMessage();
   if (!retrieved.first) {
@@ -8295,7 +8193,7 @@ bool cHardwareCPU::Inst_RetrieveMessage(cAvidaContext&)
   
   GetRegister(label_reg) = retrieved.second.GetLabel();
   GetRegister(data_reg) = retrieved.second.GetData();
-  if(m_world->GetConfig().NET_LOG_RETMESSAGES.Get()) m_world->GetStats().LogRetMessage(retrieved.second);
+  if(m_world->GetConfig().NET_LOG_RETMESSAGES.Get() && !ctx.GetWorkerMode()) m_world->GetStats().LogRetMessage(retrieved.second);
   return true;
 }
 
@@ -8632,7 +8530,6 @@ bool cHardwareCPU::DoSensePheromoneGlobal(cAvidaContext& ctx, tRegisters REG_DEF
   int reg_to_set = FindModifiedRegister(REG_DEFAULT);
   
   const cResourceLib& resLib = m_world->GetEnvironment().GetResourceLib();
-  const Apto::Array<double>& resource_count_array = m_organism->GetOrgInterface().GetResources(ctx);
   const cResourceCount& resource_count = m_world->GetPopulation().GetResourceCount();
 	
   if (resource_count.GetSize() == 0) assert(false); // change to: return false;
@@ -8641,7 +8538,7 @@ bool cHardwareCPU::DoSensePheromoneGlobal(cAvidaContext& ctx, tRegisters REG_DEF
   cResource* res = resLib.GetResource("pheromone");
 	
   if (strncmp(resource_count.GetResName(res->GetID()), "pheromone", 9) == 0) {
-    pher_amount += resource_count_array[res->GetID()];
+    pher_amount += m_organism->GetOrgInterface().GetResourceVal(ctx, res->GetID());
   }
   
   GetRegister(reg_to_set) = static_cast<int>(floor(pher_amount + 0.5));
@@ -9887,7 +9784,7 @@ bool cHardwareCPU::Inst_DonateIfDonor(cAvidaContext& ctx)
   if (neighbor != NULL) {
     // check if the neighbor was a donor
     if (m_organism->IsDonor(neighbor->GetID())) {
-      m_world->GetStats().IncDonateToDonor();
+      if (!ctx.GetWorkerMode()) m_world->GetStats().IncDonateToDonor();
       Inst_DonateFacingRawMaterialsOtherSpecies(ctx);	
     }
   }
@@ -10468,7 +10365,7 @@ bool cHardwareCPU::Inst_NumberNextGroup(cAvidaContext& ctx)
   if (m_world->GetConfig().USE_FORM_GROUPS.Get() != 2) return false;
   int opinion = m_organism->GetOpinion().first;
   
-  const int num_groups = m_organism->GetOrgInterface().GetResources(ctx).GetSize();
+  const int num_groups = m_organism->GetOrgInterface().GetResourceView(ctx).GetSize();
   if (num_groups <= 2) return false;
   
   // If not nop-modified, fails to execute.
@@ -10509,7 +10406,7 @@ bool cHardwareCPU::Inst_NumberMTNextGroup(cAvidaContext& ctx)
   if (m_world->GetConfig().USE_FORM_GROUPS.Get() != 2) return false;
   int opinion = m_organism->GetOpinion().first;
   
-  const int num_groups = m_organism->GetOrgInterface().GetResources(ctx).GetSize();
+  const int num_groups = m_organism->GetOrgInterface().GetResourceView(ctx).GetSize();
   if (num_groups <= 2) return false;
   
   // If not nop-modified, fails to execute.
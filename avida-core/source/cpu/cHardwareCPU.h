@@ -120,7 +120,6 @@ protected:
     bool m_spec_die:1;
 
     bool m_thread_slicing_parallel:1;
-    bool m_no_cpu_cycle_time:1;
 
     bool m_promoters_enabled:1;
     bool m_constitutive_regulation:1;
@@ -153,6 +152,11 @@ protected:
   // Epigenetic State -->
 
 
+  // SingleProcess() dispatches through m_single_process to the singleProcess() specialization for this organism
+  typedef bool (cHardwareCPU::*tSingleProcess)(cAvidaContext& ctx, bool speculative);
+  tSingleProcess m_single_process;
+
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   
   // --------  Stack Manipulation...  --------
@@ -173,8 +177,8 @@ protected:
   cCodeLabel& GetLabel() { return m_threads[m_cur_thread].next_label; }
   void ReadLabel(int max_size=cCodeLabel::MAX_LENGTH);
   cHeadCPU FindLabel(int direction);
-  int FindLabel_Forward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
-  int FindLabel_Backward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
+  int FindLabel_Forward(const cCodeLabel & search_label, const cCPUMemory& search_genome, int pos);
+  int FindLabel_Backward(const cCodeLabel & search_label, const cCPUMemory& search_genome, int pos);
   cHeadCPU FindLabel(const cCodeLabel & in_label, int direction);
   void FindLabelInMemory(const cCodeLabel& label, cHeadCPU& search_head);
 
@@ -241,7 +245,8 @@ public:
   static tInstLib<tMethod>* GetInstLib() { return s_inst_slib; }
   static cString GetDefaultInstFilename() { return "instset-heads.cfg"; }
 
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
+  void BindSingleProcess();
   void ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst);
 
 
@@ -33,6 +33,7 @@
 #include "cHardwareManager.h"
 #include "cHardwareTracer.h"
 #include "cInstSet.h"
+#include "cNopLabelIndex.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cPopulation.h"
@@ -143,7 +144,7 @@ tInstLib<cHardwareExperimental::tMethod>* cHardwareExperimental::initInstLib(voi
     tInstLibEntry<tMethod>("if-less-cons-24", &cHardwareExperimental::Inst_IfLessConsensus24, INST_CLASS_CONDITIONAL, 0, "Execute next instruction if Count(?BX[0:23]?) < Count(?CX[0:23]?), else skip it"),
     
     tInstLibEntry<tMethod>("if-stk-gtr", &cHardwareExperimental::Inst_IfStackGreater, INST_CLASS_CONDITIONAL, 0, "Execute next instruction if the top of the current stack > inactive stack, else skip it"),
-    tInstLibEntry<tMethod>("if-nest", &cHardwareExperimental::Inst_IfNest, INST_CLASS_CONDITIONAL, 0, "Execute next instruction if the organism is on the nest/den, else skip it"),
+    tInstLibEntry<tMethod>("if-nest", &cHardwareExperimental::Inst_IfNest, INST_CLASS_CONDITIONAL, nInstFlag::SHARED_STATE, "Execute next instruction if the organism is on the nest/den, else skip it"),
     
     // Core ALU Operations
     tInstLibEntry<tMethod>("pop", &cHardwareExperimental::Inst_Pop, INST_CLASS_DATA, 0, "Remove top number from stack and place into ?BX?"),
@@ -238,7 +239,7 @@ tInstLib<cHardwareExperimental::tMethod>* cHardwareExperimental::initInstLib(voi
     tInstLibEntry<tMethod>("term-cons-24", &cHardwareExperimental::Inst_TerminateConsensus24, INST_CLASS_FLOW_CONTROL),
     tInstLibEntry<tMethod>("regulate", &cHardwareExperimental::Inst_Regulate, INST_CLASS_FLOW_CONTROL),
     tInstLibEntry<tMethod>("regulate-sp", &cHardwareExperimental::Inst_RegulateSpecificPromoters, INST_CLASS_FLOW_CONTROL),
-    tInstLibEntry<tMethod>("s-regulate", &cHardwareExperimental::Inst_SenseRegulate, INST_CLASS_FLOW_CONTROL),
+    tInstLibEntry<tMethod>("s-regulate", &cHardwareExperimental::Inst_SenseRegulate, INST_CLASS_FLOW_CONTROL, nInstFlag::SHARED_STATE),
     tInstLibEntry<tMethod>("numberate", &cHardwareExperimental::Inst_Numberate, INST_CLASS_DATA),
     tInstLibEntry<tMethod>("numberate-24", &cHardwareExperimental::Inst_Numberate24, INST_CLASS_DATA),
     tInstLibEntry<tMethod>("bit-cons", &cHardwareExperimental::Inst_BitConsensus, INST_CLASS_DATA),
@@ -441,7 +442,6 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
   m_spec_die = false;
   
   m_thread_slicing_parallel = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1);
-  m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
   
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   if (m_promoters_enabled) {
@@ -459,6 +459,8 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
   m_memory = in_seq;  // Initialize memory...
   m_use_avatar = m_world->GetConfig().USE_AVATARS.Get();
   Reset(ctx);                            // Setup the rest of the hardware...
+  
+  BindSingleProcess();
 }
 
 
@@ -556,12 +558,40 @@ void cHardwareExperimental::cLocalThread::Reset(cHardwareExperimental* in_hardwa
 }
 
 
+// Select the SingleProcess() specialization for the features currently in use (see cHardwareCPU::BindSingleProcess).
+
+void cHardwareExperimental::BindSingleProcess()
+{
+  int features = 0;
+  if (m_has_any_costs) features |= SP_COSTS;
+  if (m_promoters_enabled) features |= SP_PROMOTERS;
+  if (m_promoters_enabled && m_constitutive_regulation) features |= SP_REGULATION;
+  if (m_tracer) features |= SP_TRACE;
+  if (m_thread_slicing_parallel) features |= SP_THREAD_PARALLEL;
+  if (m_inst_set->HasProbFail()) features |= SP_PROB_FAIL;
+  
+  switch (features) {
+    case 0:             m_single_process = &cHardwareExperimental::singleProcess<0>; break;
+    case SP_TRACE:      m_single_process = &cHardwareExperimental::singleProcess<SP_TRACE>; break;
+    case SP_COSTS:      m_single_process = &cHardwareExperimental::singleProcess<SP_COSTS>; break;
+    case SP_PROB_FAIL:  m_single_process = &cHardwareExperimental::singleProcess<SP_PROB_FAIL>; break;
+    default:            m_single_process = &cHardwareExperimental::singleProcess<SP_ALL>; break;
+  }
+}
+
+
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
+//
+// FEATURES is the set of SP_* features this specialization supports; tests for any others are compiled out.
 
-bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
+template <int FEATURES> bool cHardwareExperimental::singleProcess(cAvidaContext& ctx, bool speculative)
 {
-  assert(!speculative || (speculative && !m_thread_slicing_parallel));
+  const bool thread_slicing_parallel = (FEATURES & SP_THREAD_PARALLEL) && m_thread_slicing_parallel;
+  const bool promoters_enabled = (FEATURES & SP_PROMOTERS) && m_promoters_enabled;
+  const bool no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
+  
+  assert(!speculative || (speculative && !thread_slicing_parallel));
   
   // Mark this organism as running...
   m_organism->SetRunning(true);
@@ -575,15 +605,15 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) PromoterTerminate(ctx);
+  if (promoters_enabled && phenotype.GetCPUCyclesUsed() == 0) PromoterTerminate(ctx);
   
   m_cycle_count++;
   phenotype.IncCPUCyclesUsed();
-  if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
+  if (!no_cpu_cycle_time) phenotype.IncTimeUsed();
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  const int num_inst_exec = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1) ? m_threads.GetSize() : 1;
+  const int num_inst_exec = thread_slicing_parallel ? m_threads.GetSize() : 1;
   
   int num_active = 0;
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -614,7 +644,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       <<  " cell: " << m_organism->GetOrgInterface().GetAVCellID() << endl; */
 
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
@@ -623,13 +653,13 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
       phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (!no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
       m_organism->SetRunning(false);
       return false;
     }
     
     // Print the short form status of this CPU at each step... 
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
@@ -638,12 +668,12 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     // record any failure due to costs being paid
     // before we try to execute the instruction, is this org currently paying precosts for it
     bool on_pause = IsPayingActiveCost(ctx, m_cur_thread);
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
+    if ((FEATURES & SP_COSTS) && m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
     if (!exec) exec_success = -1;
 
-    if (m_promoters_enabled) {
+    if (promoters_enabled) {
       // Constitutive regulation applied here
-      if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+      if ((FEATURES & SP_REGULATION) && m_constitutive_regulation) Inst_SenseRegulate(ctx); 
       
       // If there are no active promoters and a certain mode is set, then don't execute any further instructions
       if (m_no_active_promoter_halt && m_promoter_index == -1) exec = false;
@@ -658,13 +688,13 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       const int addl_time_cost = m_inst_set->GetAddlTimeCost(cur_inst);
       
       // Prob of exec (moved from SingleProcess_PayCosts so that we advance IP after a fail)
-      if ( m_inst_set->GetProbFail(cur_inst) > 0.0 ) {
+      if ((FEATURES & SP_PROB_FAIL) && m_inst_set->GetProbFail(cur_inst) > 0.0) {
         exec = !( ctx.GetRandom().P(m_inst_set->GetProbFail(cur_inst)) );
         rand_fail = !exec;
       }
       
       //Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
@@ -676,7 +706,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       // Check if the instruction just executed caused premature death, break out of execution if so
       if (phenotype.GetToDelete()) {
-        if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+        if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
         break;
       }
       
@@ -688,7 +718,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(addl_time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) PromoterTerminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() &&
@@ -698,7 +728,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
     }
     // if using mini traces, report success or failure of execution
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
     
     bool do_record = false;
     // record exec failed if the org just now started paying precosts
@@ -972,42 +1002,21 @@ cHeadCPU cHardwareExperimental::FindLabelStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
+  // Find the first 'label' instruction followed by a matching label pattern, can be substring of 'label'ed target
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
   cCPUMemory& memory = m_memory;
-  int pos = 0;
+  int label_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindLabelStart(search_label, label_start)) return ip; // not found
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsLabel(memory[pos])) { // starting label found
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          size_matched++; // Increment size matched so that it includes the label instruction
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        return cHeadCPU(this, pos - 1, ip.GetMemSpace());
-      }
-      
-      continue; 
-    }
-    pos++;
+  if (mark_executed) {
+    const int size_matched = search_label.GetSize() + 1; // Include the label instruction itself
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(label_start + i);
   }
   
-  // Return start point if not found
-  return ip;
+  // Return Head pointed at last NOP of label sequence
+  return cHeadCPU(this, label_start + search_label.GetSize(), ip.GetMemSpace());
 }
 
 cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
@@ -1018,38 +1027,20 @@ cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
+  // Find the first sequence of NOPs matching the label pattern, can be substring of the sequence
+  // - must match all NOPs in search_label
+  // - extra NOPs in the sequence are ignored
   cCPUMemory& memory = m_memory;
-  int pos = 0;
+  int seq_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindNopSequenceStart(search_label, seq_start)) return ip; // not found
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsNop(memory[pos])) { // start of sequence found
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        return cHeadCPU(this, pos - 1, ip.GetMemSpace());
-      }
-    }
-    pos++;
+  if (mark_executed) {
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+    for (int i = 0; i < search_label.GetSize() && i < max; i++) memory.SetFlagExecuted(seq_start + i);
   }
   
-  // Return start point if not found
-  return ip;
+  // Return Head pointed at last NOP of label sequence
+  return cHeadCPU(this, seq_start + search_label.GetSize() - 1, ip.GetMemSpace());
 }
 
 
@@ -1061,46 +1052,23 @@ cHeadCPU cHardwareExperimental::FindLabelForward(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cHeadCPU pos(ip);
-  pos++;
+  // Find the next 'label' instruction followed by a matching label pattern, can be substring of 'label'ed target
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
+  const cCPUMemory& memory = ip.GetMemory();
+  int label_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindLabelForward(search_label, ip.GetPosition(), label_start)) return ip;
   
-  while (pos.GetPosition() != ip.GetPosition()) {
-    if (m_inst_set->IsLabel(pos.GetInst())) { // starting label found
-      const int label_start = pos.GetPosition();
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.GetPosition();
-        
-        if (mark_executed) {
-          pos.Set(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        return cHeadCPU(this, found_pos, ip.GetMemSpace());
-      }
-      
-      continue; 
-    }
-    pos++;
+  const int found_pos = (label_start + search_label.GetSize()) % memory.GetSize();
+  
+  if (mark_executed) {
+    cHeadCPU pos(this, label_start, ip.GetMemSpace());
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < search_label.GetSize() && i < max; i++, pos++) pos.SetFlagExecuted();
   }
   
-  // Return start point if not found
-  return ip;
+  // Return Head pointed at last NOP of label sequence
+  return cHeadCPU(this, found_pos, ip.GetMemSpace());
 }
 
 cHeadCPU cHardwareExperimental::FindLabelBackward(bool mark_executed)
@@ -1115,6 +1083,8 @@ cHeadCPU cHardwareExperimental::FindLabelBackward(bool mark_executed)
   cHeadCPU pos(ip);
   lpos--;
   
+  // pos starts at the search origin, so this loop never runs and the search always falls back to the start
+  // point.  Existing configurations rely on that, so there is no nop label index lookup here to keep in step.
   while (pos.GetPosition() != ip.GetPosition()) {
     if (m_inst_set->IsLabel(lpos.GetInst())) { // starting label found
       pos.Set(lpos.GetPosition());
@@ -1162,45 +1132,23 @@ cHeadCPU cHardwareExperimental::FindNopSequenceForward(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cHeadCPU pos(ip);
-  pos++;
+  // Find the next sequence of NOPs matching the label pattern, can be substring of the sequence
+  // - must match all NOPs in search_label
+  // - extra NOPs in the sequence are ignored
+  const cCPUMemory& memory = ip.GetMemory();
+  int seq_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindNopSequenceForward(search_label, ip.GetPosition(), seq_start)) return ip;
   
-  while (pos.GetPosition() != ip.GetPosition()) {
-    if (m_inst_set->IsNop(pos.GetInst())) { // starting label found
-      const int label_start = pos.GetPosition();
-      
-      // Check for direct matched nop sequence, can be substring of target
-      // - must match all NOPs in search_label
-      // - extra NOPs in target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.GetPosition();
-        
-        if (mark_executed) {
-          pos.Set(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        return cHeadCPU(this, found_pos, ip.GetMemSpace());
-      }
-    }
-    
-    if (pos.GetPosition() == ip.GetPosition()) break;
-    pos++;
+  const int found_pos = (seq_start + search_label.GetSize() - 1) % memory.GetSize();
+  
+  if (mark_executed) {
+    cHeadCPU pos(this, seq_start, ip.GetMemSpace());
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+    for (int i = 0; i < search_label.GetSize() && i < max; i++, pos++) pos.SetFlagExecuted();
   }
   
-  // Return start point if not found
-  return ip;
+  // Return Head pointed at last NOP of label sequence
+  return cHeadCPU(this, found_pos, ip.GetMemSpace());
 }
 
 
@@ -1216,6 +1164,7 @@ cHeadCPU cHardwareExperimental::FindNopSequenceBackward(bool mark_executed)
   cHeadCPU pos(ip);
   lpos--;
   
+  // Never runs, pos starts at the search origin (see FindLabelBackward())
   while (pos.GetPosition() != ip.GetPosition()) {
     if (m_inst_set->IsNop(pos.GetInst())) { // starting label found
       pos.Set(lpos.GetPosition());
@@ -2749,7 +2698,7 @@ bool cHardwareExperimental::Inst_RegulateSpecificPromoters(cAvidaContext&)
 bool cHardwareExperimental::Inst_SenseRegulate(cAvidaContext& ctx)
 {
   unsigned int bits = 0;
-  const Apto::Array<double> & res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   assert (res_count.GetSize() != 0);
   for (int i=0; i<m_world->GetConfig().PROMOTER_CODE_SIZE.Get(); i++)
   {
@@ -5153,7 +5102,7 @@ bool cHardwareExperimental::SendMessage(cAvidaContext& ctx, int messageType)
  If a message is available, ?BX? is set to the message's label, and ~?BX? is set
  to its data.
  */
-bool cHardwareExperimental::Inst_RetrieveMessage(cAvidaContext&)
+bool cHardwareExperimental::Inst_RetrieveMessage(cAvidaContext& ctx)
 {
   std::pair<bool, cOrgMessage> retrieved = m_organism->RetrieveMessage();
   if (!retrieved.first) {
@@ -5166,7 +5115,7 @@ bool cHardwareExperimental::Inst_RetrieveMessage(cAvidaContext&)
   setInternalValue(label_reg, retrieved.second.GetLabel(), false, false, true);
   setInternalValue(data_reg, retrieved.second.GetData(), false, false, true);
   
-  if(m_world->GetConfig().NET_LOG_RETMESSAGES.Get()) m_world->GetStats().LogRetMessage(retrieved.second);
+  if(m_world->GetConfig().NET_LOG_RETMESSAGES.Get() && !ctx.GetWorkerMode()) m_world->GetStats().LogRetMessage(retrieved.second);
   return true;
 }
 
@@ -6481,7 +6430,7 @@ bool cHardwareExperimental::Inst_SetGuard(cAvidaContext& ctx)
   if (set_ok){
     m_organism->SetGuard();
     m_organism->IncGuard();
-  } else m_world->GetStats().IncGuardFail();
+  } else if (!ctx.GetWorkerMode()) m_world->GetStats().IncGuardFail();
   setInternalValue(FindModifiedRegister(rBX), (int) m_organism->IsGuard(), true);
   return set_ok;
 }
@@ -6490,7 +6439,7 @@ bool cHardwareExperimental::Inst_SetGuardOnce(cAvidaContext& ctx)
 {
   bool set_ok = false;
   if (!m_organism->IsGuard()) set_ok = Inst_SetGuard(ctx);
-  else m_world->GetStats().IncGuardFail();
+  else if (!ctx.GetWorkerMode()) m_world->GetStats().IncGuardFail();
   setInternalValue(FindModifiedRegister(rBX), set_ok, true);    
   return set_ok;  
 }
@@ -212,7 +212,6 @@ private:
     bool m_spec_die:1;
     
     bool m_thread_slicing_parallel:1;
-    bool m_no_cpu_cycle_time:1;
     
     bool m_promoters_enabled:1;
     bool m_constitutive_regulation:1;
@@ -225,6 +224,10 @@ private:
     unsigned int m_waiting_threads:4;
   };
   
+  // SingleProcess() dispatches through m_single_process to the singleProcess() specialization for this organism
+  typedef bool (cHardwareExperimental::*tSingleProcess)(cAvidaContext& ctx, bool speculative);
+  tSingleProcess m_single_process;
+  
   
   // Promoter model
   int m_promoter_index;       // site to begin looking for the next active promoter from
@@ -245,7 +248,8 @@ public:
   
   
   // --------  Core Execution Methods  --------
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
+  void BindSingleProcess();
   void ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst);
 
   
@@ -307,6 +311,7 @@ public:
 private:
   
   // --------  Core Execution Methods  --------
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   void internalReset();
   void internalResetOnFailedDivide();
@@ -32,6 +32,7 @@
 #include "cHardwareManager.h"
 #include "cHardwareTracer.h"
 #include "cInstSet.h"
+#include "cNopLabelIndex.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cPopulation.h"
@@ -243,8 +244,6 @@ cHardwareGP8::cHardwareGP8(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   
   m_spec_die = false;
   
-  m_no_cpu_cycle_time = m_world->GetConfig().NO_CPU_CYCLE_TIME.Get();
-  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
   m_juv_enabled = (m_world->GetConfig().JUV_PERIOD.Get() > 0);
@@ -416,7 +415,7 @@ bool cHardwareGP8::SingleProcess(cAvidaContext& ctx, bool speculative)
     // Update cycle counts
     m_cycle_count++;
     phenotype.IncCPUCyclesUsed();
-    if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
+    if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
 
     // Wake any stalled threads
     for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -806,7 +805,7 @@ void cHardwareGP8::PrintMiniTraceStatus(cAvidaContext& ctx, ostream& fp)
   cString next_name(GetInstSet().GetName(getIP().GetInst()));
   fp << next_name << " ";
   // any trailing nops (up to NUM_REGISTERS)
-  cCPUMemory& memory = getIP().MemSpaceIsGene() ? m_genes[getIP().MemSpaceIndex()].memory : m_mem_array[getIP().MemSpaceIndex()];
+  const cCPUMemory& memory = getIP().MemSpaceIsGene() ? m_genes[getIP().MemSpaceIndex()].memory : m_mem_array[getIP().MemSpaceIndex()];
   int pos = getIP().Position();
   Apto::Array<int, Apto::Smart> seq;
   seq.Resize(0);
@@ -843,43 +842,25 @@ void cHardwareGP8::FindLabelStart(Head& head, Head& default_pos, bool mark_execu
     return;
   }
   
+  // Find the first 'label' instruction followed by a matching label pattern, can be substring of 'label'ed target
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
   cCPUMemory& memory = head.GetMemory();
-  int pos = 0;
+  int label_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindLabelStart(search_label, label_start)) {
+    // Return start point if not found
+    head.Set(default_pos);
+    return;
+  }
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsLabel(memory[pos])) { // starting label found
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          size_matched++; // Increment size matched so that it includes the label instruction
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        head.SetPosition(pos - 1);
-        return;
-      }
-      
-      continue; 
-    }
-    pos++;
+  if (mark_executed) {
+    const int size_matched = search_label.GetSize() + 1; // Include the label instruction itself
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(label_start + i);
   }
   
-  // Return start point if not found
-  head.Set(default_pos);
+  // Return Head pointed at last NOP of label sequence
+  head.SetPosition(label_start + search_label.GetSize());
 }
 
 void cHardwareGP8::FindNopSequenceStart(Head& head, Head& default_pos, bool mark_executed)
@@ -892,39 +873,24 @@ void cHardwareGP8::FindNopSequenceStart(Head& head, Head& default_pos, bool mark
     return;
   }
   
+  // Find the first sequence of NOPs matching the label pattern, can be substring of the sequence
+  // - must match all NOPs in search_label
+  // - extra NOPs in the sequence are ignored
   cCPUMemory& memory = head.GetMemory();
-  int pos = 0;
+  int seq_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindNopSequenceStart(search_label, seq_start)) {
+    // Return start point if not found
+    head.Set(default_pos);
+    return;
+  }
   
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsNop(memory[pos])) { // start of sequence found
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        head.SetPosition(pos - 1);
-        return;
-      }
-    }
-    pos++;
+  if (mark_executed) {
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+    for (int i = 0; i < search_label.GetSize() && i < max; i++) memory.SetFlagExecuted(seq_start + i);
   }
   
-  // Return start point if not found
-  head.Set(default_pos);
+  // Return Head pointed at last NOP of label sequence
+  head.SetPosition(seq_start + search_label.GetSize() - 1);
 }
 
 
@@ -940,47 +906,28 @@ void cHardwareGP8::FindLabelForward(Head& head, Head& default_pos, bool mark_exe
   
   head.Adjust();
   
-  Head pos(head);
-  pos++;
+  // Find the next 'label' instruction followed by a matching label pattern, can be substring of 'label'ed target
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
+  const cCPUMemory& memory = head.GetMemory();
+  int label_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindLabelForward(search_label, head.Position(), label_start)) {
+    // Return start point if not found
+    head.Set(default_pos);
+    return;
+  }
   
-  while (pos.Position() != head.Position()) {
-    if (m_inst_set->IsLabel(pos.GetInst())) { // starting label found
-      const int label_start = pos.Position();
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.Position() != head.Position()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.Position();
-        
-        if (mark_executed) {
-          pos.SetPosition(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        head.SetPosition(found_pos);
-        return;
-      }
-      
-      continue; 
-    }
-    pos++;
+  const int found_pos = (label_start + search_label.GetSize()) % memory.GetSize();
+  
+  if (mark_executed) {
+    Head pos(head);
+    pos.SetPosition(label_start);
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < search_label.GetSize() && i < max; i++, pos++) pos.SetFlagExecuted();
   }
   
-  // Return start point if not found
-  head.Set(default_pos);
+  // Return Head pointed at last NOP of label sequence
+  head.SetPosition(found_pos);
 }
 
 void cHardwareGP8::FindLabelBackward(Head& head, Head& default_pos, bool mark_executed)
@@ -999,6 +946,7 @@ void cHardwareGP8::FindLabelBackward(Head& head, Head& default_pos, bool mark_ex
   Head pos(head);
   lpos--;
   
+  // Never runs, pos starts at the search origin (see cHardwareExperimental::FindLabelBackward())
   while (pos.Position() != head.Position()) {
     if (m_inst_set->IsLabel(lpos.GetInst())) { // starting label found
       pos.SetPosition(lpos.Position());
@@ -1051,46 +999,28 @@ void cHardwareGP8::FindNopSequenceForward(Head& head, Head& default_pos, bool ma
   
   head.Adjust();
   
-  Head pos(head);
-  pos++;
+  // Find the next sequence of NOPs matching the label pattern, can be substring of the sequence
+  // - must match all NOPs in search_label
+  // - extra NOPs in the sequence are ignored
+  const cCPUMemory& memory = head.GetMemory();
+  int seq_start = 0;
+  if (!memory.GetNopLabelIndex(*m_inst_set).FindNopSequenceForward(search_label, head.Position(), seq_start)) {
+    // Return start point if not found
+    head.Set(default_pos);
+    return;
+  }
   
-  while (pos.Position() != head.Position()) {
-    if (m_inst_set->IsNop(pos.GetInst())) { // starting label found
-      const int label_start = pos.Position();
-      
-      // Check for direct matched nop sequence, can be substring of target
-      // - must match all NOPs in search_label
-      // - extra NOPs in target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.Position() != head.Position()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.Position();
-        
-        if (mark_executed) {
-          pos.SetPosition(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        head.SetPosition(found_pos);
-        return;
-      }
-    }
-    
-    if (pos.Position() == head.Position()) break;
-    pos++;
+  const int found_pos = (seq_start + search_label.GetSize() - 1) % memory.GetSize();
+  
+  if (mark_executed) {
+    Head pos(head);
+    pos.SetPosition(seq_start);
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
+    for (int i = 0; i < search_label.GetSize() && i < max; i++, pos++) pos.SetFlagExecuted();
   }
   
-  // Return start point if not found
-  head.Set(default_pos);
+  // Return Head pointed at last NOP of label sequence
+  head.SetPosition(found_pos);
 }
 
 
@@ -1110,6 +1040,7 @@ void cHardwareGP8::FindNopSequenceBackward(Head& head, Head& default_pos, bool m
   Head pos(head);
   lpos--;
   
+  // Never runs, pos starts at the search origin (see cHardwareExperimental::FindLabelBackward())
   while (pos.Position() != head.Position()) {
     if (m_inst_set->IsNop(pos.GetInst())) { // starting label found
       pos.SetPosition(lpos.Position());
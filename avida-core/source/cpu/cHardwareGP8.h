@@ -117,6 +117,8 @@ private:
       { m_hw = hw; m_pos = pos; m_ms = ms; m_is_gene = is_gene; }
     
     inline cCPUMemory& GetMemory() { return (m_is_gene) ? m_hw->m_genes[m_ms].memory : m_hw->m_mem_array[m_ms]; }
+    inline const cCPUMemory& GetMemory() const
+      { return (m_is_gene) ? m_hw->m_genes[m_ms].memory : m_hw->m_mem_array[m_ms]; }
     
     inline void Adjust();
     
@@ -135,12 +137,12 @@ private:
     
     inline void Advance() { m_pos++; Adjust(); }
     
-    inline const Instruction& GetInst() { return GetMemory()[m_pos]; }
-    inline const Instruction& GetInst(int offset) { return GetMemory()[m_pos + offset]; }
-    inline Instruction NextInst();
-    inline Instruction PrevInst();
+    inline const Instruction& GetInst() const { return GetMemory()[m_pos]; }
+    inline const Instruction& GetInst(int offset) const { return GetMemory()[m_pos + offset]; }
+    inline Instruction NextInst() const;
+    inline Instruction PrevInst() const;
     
-    inline void SetInst(const Instruction& value) { GetMemory()[m_pos] = value; }
+    inline void SetInst(const Instruction& value) { GetMemory().SetInst(m_pos, value); }
     inline void InsertInst(const Instruction& inst) { GetMemory().Insert(m_pos, inst); }
     inline void RemoveInst() { GetMemory().Remove(m_pos); }
     
@@ -166,9 +168,9 @@ private:
     inline bool operator!=(const Head& rhs) const { return !operator==(rhs); }
     
     // Bool Tests...
-    inline bool AtFront() { return (m_pos == 0); }
-    inline bool AtEnd() { return (m_pos + 1 == GetMemory().GetSize()); }
-    inline bool InMemory() { return (m_pos >= 0 && m_pos < GetMemory().GetSize()); }
+    inline bool AtFront() const { return (m_pos == 0); }
+    inline bool AtEnd() const { return (m_pos + 1 == GetMemory().GetSize()); }
+    inline bool InMemory() const { return (m_pos >= 0 && m_pos < GetMemory().GetSize()); }
   };
   
   
@@ -291,7 +293,6 @@ private:
     bool m_spec_die:1;
     bool m_hw_reset:1;
     
-    bool m_no_cpu_cycle_time:1;
     bool m_slip_read_head:1;
     bool m_juv_enabled:1;
   };
@@ -726,12 +727,12 @@ inline bool cHardwareGP8::Head::operator==(const Head& rhs) const
   return m_hw == rhs.m_hw && m_pos == rhs.m_pos && m_ms == rhs.m_ms && m_is_gene == rhs.m_is_gene;
 }
 
-inline Instruction cHardwareGP8::Head::PrevInst()
+inline Instruction cHardwareGP8::Head::PrevInst() const
 {
   return (AtFront()) ? GetMemory()[GetMemory().GetSize() - 1] : GetMemory()[m_pos - 1];
 }
 
-inline Instruction cHardwareGP8::Head::NextInst()
+inline Instruction cHardwareGP8::Head::NextInst() const
 {
   return (AtEnd()) ? m_hw->GetInstSet().GetInstError() : GetMemory()[m_pos + 1];
 }
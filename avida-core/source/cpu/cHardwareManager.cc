@@ -48,11 +48,38 @@ cHardwareManager::cHardwareManager(cWorld* world)
   cString filename = world->GetConfig().INST_SET.Get();
   m_is_name_map.Set("(default)", 0);
 
+  m_test_results.SetCapacity(world->GetConfig().TEST_ON_DIVIDE_CACHE_SIZE.Get());
 }
 
 cHardwareManager::~cHardwareManager()
 {
   for (int i = 0; i < m_inst_sets.GetSize(); i++) delete m_inst_sets[i];
+  for (int i = 0; i < m_test_cpu_pool.GetSize(); i++) delete m_test_cpu_pool[i];
+}
+
+
+cTestCPU* cHardwareManager::AcquireTestCPU(cAvidaContext& ctx)
+{
+  {
+    Apto::MutexAutoLock lock(m_test_cpu_mutex);
+    const int num_idle = m_test_cpu_pool.GetSize();
+    if (num_idle > 0) {
+      cTestCPU* testcpu = m_test_cpu_pool[num_idle - 1];
+      m_test_cpu_pool.Resize(num_idle - 1);
+      return testcpu;
+    }
+  }
+  
+  // Resources and inputs are reinitialized at the start of every test, so a fresh CPU is only needed when none are idle
+  return new cTestCPU(ctx, m_world);
+}
+
+void cHardwareManager::ReleaseTestCPU(cTestCPU* testcpu)
+{
+  testcpu->SetSoloRes(-1, 0.0);
+  
+  Apto::MutexAutoLock lock(m_test_cpu_mutex);
+  m_test_cpu_pool.Push(testcpu);
 }
 
 
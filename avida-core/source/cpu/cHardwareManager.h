@@ -23,6 +23,9 @@
 #define cHardwareManager_h
 
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
+
+#include "apto/core/Mutex.h"
 
 namespace Avida {
   class Genome;
@@ -47,6 +50,10 @@ private:
   Apto::Array<cInstSet*> m_inst_sets;
   Apto::Map<Apto::String, int> m_is_name_map;
 
+  Apto::Mutex m_test_cpu_mutex;
+  Apto::Array<cTestCPU*> m_test_cpu_pool;  // Idle test CPUs available to AcquireTestCPU()
+  cTestResultCache m_test_results;
+
   
   cHardwareManager(); // @not_implemented
   cHardwareManager(const cHardwareManager&); // @not_implemented
@@ -66,6 +73,12 @@ public:
   
   cHardwareBase* Create(cAvidaContext& ctx, cOrganism* org, const Genome& mg);
   inline cTestCPU* CreateTestCPU(cAvidaContext& ctx) { return new cTestCPU(ctx, m_world); }
+  
+  // Pooled test CPUs for frequent short-lived tests; every acquired CPU must be handed back with ReleaseTestCPU()
+  cTestCPU* AcquireTestCPU(cAvidaContext& ctx);
+  void ReleaseTestCPU(cTestCPU* testcpu);
+  
+  cTestResultCache& GetTestResultCache() { return m_test_results; }
 
   inline bool IsInstSet(const Apto::String& name) const { return m_is_name_map.Has(name); }
   
@@ -27,6 +27,7 @@
 #include "cEnvironment.h"
 #include "cInstLib.h"
 #include "cInstSet.h"
+#include "cNopLabelIndex.h"
 #include "cHardwareManager.h"
 #include "cHardwareTracer.h"
 #include "cOrganism.h"
@@ -452,158 +453,37 @@ cHeadCPU cHardwareTransSMT::FindLabel(int direction)
 // memory.  Return the first line _after_ the the found label.  It is okay
 // to find search label's match inside another label.
 int cHardwareTransSMT::FindLabel_Forward(const cCodeLabel& search_label,
-                                         const InstructionSequence& search_genome, int pos)
+                                         const cCPUMemory& search_genome, int pos)
 {
   assert (pos < search_genome.GetSize() && pos >= 0);
-	
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-	
-  // Move off the template we are on.
-  pos += label_size;
-	
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-		
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-		
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-			
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-						 m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-				start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-						 m_inst_set->IsNop( search_genome[end_pos] )) {
-				end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-			
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-				
-				// Test the number of matches for this offset.
-				int matches;
-				for (matches = 0; matches < label_size; matches++) {
-					if (search_label[matches] !=
-							m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-						break;
-					}
-				}
-				
-				// If we have found it, break out of this loop!
-				if (matches == label_size) {
-					found_label = true;
-					break;
-				}
-      }
-			
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-			
-      if (found_label == true) {
-				// pos = end_pos;
-				pos = label_size + offset;
-				break;
-      }
-			
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-		
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
+  const cNopLabelIndex& nop_index = search_genome.GetNopLabelIndex(*m_inst_set);
+  const int label_size = search_label.GetSize();
+
+  // Find the first match starting at or after pos.  The scan this replaces stepped off the template it started on by
+  // label_size sites before looking, so a match filling the rest of the nop run at pos exactly is passed over.
+  int found = 0;
+  if (!nop_index.FindNopSequenceFrom(search_label, pos, found)) return -1;
+  if (found == pos && nop_index.GetRunEnd(pos) == pos + label_size) {
+    if (!nop_index.FindNopSequenceFrom(search_label, pos + 1, found)) return -1;
   }
-	
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-	
-  return pos;
+
+  return found + label_size;
 }
 
 // Search backwards for search_label from _before_ position pos in the
 // memory.  Return the first line _after_ the the found label.  It is okay
 // to find search label's match inside another label.
 int cHardwareTransSMT::FindLabel_Backward(const cCodeLabel & search_label,
-                                          const InstructionSequence & search_genome, int pos)
+                                          const cCPUMemory& search_genome, int pos)
 {
   assert (pos < search_genome.GetSize());
-	
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-	
-  // Move off the template we are on.
-  pos -= label_size;
-	
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-		
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-			
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-				start_pos--;
-      }
-      while (end_pos < search_start &&
-						 m_inst_set->IsNop(search_genome[end_pos])) {
-				end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-			
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-				
-				// Test the number of matches for this offset.
-				int matches;
-				for (matches = 0; matches < label_size; matches++) {
-					if (search_label[matches] !=
-							m_inst_set->GetNopMod(search_genome[offset + matches])) {
-						break;
-					}
-				}
-				
-				// If we have found it, break out of this loop!
-				if (matches == label_size) {
-					found_label = true;
-					break;
-				}
-      }
-			
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-			
-      if (found_label == true) {
-				pos = end_pos;
-				break;
-      }
-			
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-		
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-	
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-	
-  return pos;
+  const cNopLabelIndex& nop_index = search_genome.GetNopLabelIndex(*m_inst_set);
+
+  // Find the last match ending at or before pos, and return the end of the nop run holding it (cut off at pos)
+  int found = 0;
+  if (!nop_index.FindNopSequenceBefore(search_label, pos, found)) return -1;
+
+  return Apto::Min(nop_index.GetRunEnd(found), pos);
 }
 
 // Search for 'in_label' anywhere in the hardware.
@@ -755,7 +635,7 @@ bool cHardwareTransSMT::ParasiteInfectHost(Systematics::UnitPtr bu)
  */
 int cHardwareTransSMT::FindModifiedResource(cAvidaContext& ctx, int& spec_id)
 {
-  int num_resources = m_organism->GetOrgInterface().GetResources(ctx).GetSize(); 
+  int num_resources = m_organism->GetOrgInterface().GetResourceView(ctx).GetSize(); 
   
   //if there are no resources, translation cannot be successful; return false
   if (num_resources <= 0)
@@ -827,7 +707,7 @@ bool cHardwareTransSMT::DoCollect(cAvidaContext& ctx, bool env_remove, bool inte
 bool cHardwareTransSMT::DoActualCollect(cAvidaContext& ctx, int bin_used, bool env_remove, bool internal_add, bool probabilistic, bool unit)
 {
   // Set up res_change and max total
-  const Apto::Array<double> res_count = m_organism->GetOrgInterface().GetResources(ctx);
+  const cResourceView res_count = m_organism->GetOrgInterface().GetResourceView(ctx);
   Apto::Array<double> res_change(res_count.GetSize());
   res_change.SetAll(0.0);
   double total = m_organism->GetRBinsTotal();
@@ -83,7 +83,7 @@ public:
   inline Instruction GetPrevInst() const;
   inline Instruction GetNextInst() const;
 
-  inline void SetInst(const Instruction& value) { GetMemory()[m_position] = value; }
+  inline void SetInst(const Instruction& value) { GetMemory().SetInst(m_position, value); }
   inline void InsertInst(const Instruction& inst) { GetMemory().Insert(m_position, inst); }
   inline void RemoveInst() { GetMemory().Remove(m_position); }
 
@@ -32,6 +32,7 @@ namespace nInstFlag {
   const unsigned int PROMOTER = 0x20;
   const unsigned int TERMINATOR = 0x40;
   const unsigned int IMMEDIATE_VALUE = 0x80;
+  const unsigned int SHARED_STATE = 0x100;  // Alters or reads state that other organisms may change, without stalling
 }
 
 enum InstructionClass {
@@ -86,6 +87,7 @@ public:
   inline bool ShouldStall() const { return (m_flags & nInstFlag::STALL) != 0; }
   inline bool ShouldSleep() const { return (m_flags & nInstFlag::SLEEP) != 0; }
   inline bool IsImmediateValue() const { return (m_flags & nInstFlag::IMMEDIATE_VALUE) != 0; }
+  inline bool UsesSharedState() const { return (m_flags & nInstFlag::SHARED_STATE) != 0; }
 };
 
 #endif
@@ -53,6 +53,8 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_has_choosy_female_costs(_in.m_has_choosy_female_costs)
   , m_has_post_costs(_in.m_has_post_costs)
   , m_has_bonus_costs(_in.m_has_bonus_costs)
+  , m_has_prob_fail(_in.m_has_prob_fail)
+  , m_has_shared_state(_in.m_has_shared_state)
 {
   m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
 }
@@ -74,6 +76,8 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_has_choosy_female_costs = _in.m_has_choosy_female_costs;
   m_has_post_costs = _in.m_has_post_costs;
   m_has_bonus_costs = _in.m_has_bonus_costs;
+  m_has_prob_fail = _in.m_has_prob_fail;
+  m_has_shared_state = _in.m_has_shared_state;
 
   m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
   return *this;
@@ -250,6 +254,8 @@ bool cInstSet::LoadWithStringList(const cStringList& sl, cUserFeedback* feedback
     if (m_lib_name_map[inst_id].choosy_female_cost) m_has_choosy_female_costs = true;
     if (m_lib_name_map[inst_id].post_cost > 1) m_has_post_costs = true;
     if (m_lib_name_map[inst_id].bonus_cost) m_has_bonus_costs = true;
+    if (m_lib_name_map[inst_id].prob_fail > 0.0) m_has_prob_fail = true;
+    if ((*m_inst_lib)[fun_id].UsesSharedState()) m_has_shared_state = true;
     
     // Parse the instruction code
     cString inst_code = args->GetString(0);
@@ -0,0 +1,223 @@
+/*
+ *  cNopLabelIndex.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cNopLabelIndex.h"
+
+#include "cCodeLabel.h"
+#include "cInstSet.h"
+
+
+const Apto::Array<int> cNopLabelIndex::s_no_sites;
+
+
+void cNopLabelIndex::Build(const InstructionSequence& seq, const cInstSet& inst_set)
+{
+  m_inst_set = &inst_set;
+  m_size = seq.GetSize();
+
+  m_nop_mod.Resize(m_size);
+  m_run_start.Resize(m_size);
+  m_run_end.Resize(m_size);
+  for (int i = 0; i < m_nop_sites.GetSize(); i++) {
+    m_nop_sites[i].Resize(0);
+    m_label_sites[i].Resize(0);
+  }
+
+  for (int i = 0; i < m_size; i++) {
+    if (!inst_set.IsNop(seq[i])) {
+      m_nop_mod[i] = -1;
+      continue;
+    }
+
+    const int nop_mod = inst_set.GetNopMod(seq[i]);
+    if (nop_mod >= m_nop_sites.GetSize()) {
+      m_nop_sites.Resize(nop_mod + 1);
+      m_label_sites.Resize(nop_mod + 1);
+    }
+    m_nop_mod[i] = nop_mod;
+    m_nop_sites[nop_mod].Push(i);
+    m_run_start[i] = (i > 0 && m_nop_mod[i - 1] >= 0) ? m_run_start[i - 1] : i;
+  }
+
+  for (int i = m_size - 1; i >= 0; i--) {
+    if (m_nop_mod[i] < 0) continue;
+    m_run_end[i] = (i + 1 < m_size && m_nop_mod[i + 1] >= 0) ? m_run_end[i + 1] : i + 1;
+  }
+
+  // Labels are matched cyclically by the forward searches, so the site after the last one is the first
+  for (int i = 0; i < m_size; i++) {
+    if (!inst_set.IsLabel(seq[i])) continue;
+    const int next_mod = m_nop_mod[(i + 1 < m_size) ? i + 1 : 0];
+    if (next_mod >= 0) m_label_sites[next_mod].Push(i);
+  }
+}
+
+
+// Number of leading nops of label matched by the sites starting at pos, examining at most limit sites (wrapping)
+int cNopLabelIndex::matchLength(const cCodeLabel& label, int pos, int limit) const
+{
+  const int label_size = label.GetSize();
+  int matched = 0;
+  while (matched < label_size && matched < limit && m_nop_mod[pos] == label[matched]) {
+    matched++;
+    if (++pos == m_size) pos = 0;
+  }
+  return matched;
+}
+
+
+// Binary search for the index of the first site after pos
+int cNopLabelIndex::firstSiteAfter(const Apto::Array<int>& sites, int pos)
+{
+  int lo = 0;
+  int hi = sites.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (sites[mid] <= pos) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+
+bool cNopLabelIndex::FindLabelStart(const cCodeLabel& label, int& found) const
+{
+  assert(label.GetSize() > 0);
+  const Apto::Array<int>& sites = sitesFor(m_label_sites, label[0]);
+
+  // A failed match resumes the scan at the first site that did not match
+  int resume = 0;
+  for (int i = 0; i < sites.GetSize(); i++) {
+    const int site = sites[i];
+    if (site < resume) continue;
+
+    const int matched = matchLength(label, site + 1, m_size - site - 1);
+    if (matched == label.GetSize()) {
+      found = site;
+      return true;
+    }
+    resume = site + 1 + matched;
+  }
+
+  return false;
+}
+
+
+bool cNopLabelIndex::FindNopSequenceStart(const cCodeLabel& label, int& found) const
+{
+  assert(label.GetSize() > 0);
+  const Apto::Array<int>& sites = sitesFor(m_nop_sites, label[0]);
+
+  // A failed match resumes the scan just past the first site that did not match
+  int resume = 0;
+  for (int i = 0; i < sites.GetSize(); i++) {
+    const int site = sites[i];
+    if (site < resume) continue;
+
+    const int matched = matchLength(label, site, m_size - site);
+    if (matched == label.GetSize()) {
+      found = site;
+      return true;
+    }
+    resume = site + matched + 1;
+  }
+
+  return false;
+}
+
+
+bool cNopLabelIndex::FindLabelForward(const cCodeLabel& label, int from, int& found) const
+{
+  return findForward(sitesFor(m_label_sites, label[0]), label, from, 1, found);
+}
+
+
+bool cNopLabelIndex::FindNopSequenceForward(const cCodeLabel& label, int from, int& found) const
+{
+  return findForward(sitesFor(m_nop_sites, label[0]), label, from, 0, found);
+}
+
+
+// Visit sites in scan order, measured as offsets after 'from'.  'lead' is the number of sites (the 'label'
+// instruction, if any) preceding the nops matched against label.  Either way a failed match at offset d resumes the
+// scan at offset d + 1 + matched, and matching never reaches 'from' itself.
+bool cNopLabelIndex::findForward(const Apto::Array<int>& sites, const cCodeLabel& label, int from, int lead,
+                                 int& found) const
+{
+  assert(label.GetSize() > 0);
+  assert(from >= 0 && from < m_size);
+
+  const int num_sites = sites.GetSize();
+  if (num_sites == 0) return false;
+
+  const int lo = firstSiteAfter(sites, from);
+  int resume = 1;
+  for (int i = 0; i < num_sites; i++) {
+    const int site = sites[(lo + i < num_sites) ? lo + i : lo + i - num_sites];
+    const int offset = (site > from) ? site - from : site - from + m_size;
+    if (offset == m_size || offset < resume) continue;
+
+    int pos = site + lead;
+    if (pos >= m_size) pos -= m_size;
+    const int matched = matchLength(label, pos, m_size - offset - lead);
+    if (matched == label.GetSize()) {
+      found = site;
+      return true;
+    }
+    resume = offset + 1 + matched;
+  }
+
+  return false;
+}
+
+
+bool cNopLabelIndex::FindNopSequenceFrom(const cCodeLabel& label, int from, int& found) const
+{
+  assert(label.GetSize() > 0);
+  const Apto::Array<int>& sites = sitesFor(m_nop_sites, label[0]);
+
+  for (int i = firstSiteAfter(sites, from - 1); i < sites.GetSize(); i++) {
+    const int site = sites[i];
+    if (matchLength(label, site, m_size - site) == label.GetSize()) {
+      found = site;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+bool cNopLabelIndex::FindNopSequenceBefore(const cCodeLabel& label, int end, int& found) const
+{
+  assert(label.GetSize() > 0);
+  assert(end <= m_size);
+  const Apto::Array<int>& sites = sitesFor(m_nop_sites, label[0]);
+
+  for (int i = firstSiteAfter(sites, end - label.GetSize()) - 1; i >= 0; i--) {
+    const int site = sites[i];
+    if (matchLength(label, site, end - site) == label.GetSize()) {
+      found = site;
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,92 @@
+/*
+ *  cNopLabelIndex.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cNopLabelIndex_h
+#define cNopLabelIndex_h
+
+#include "apto/core.h"
+#include "avida/core/InstructionSequence.h"
+
+class cCodeLabel;
+class cInstSet;
+
+using namespace Avida;
+
+
+// cNopLabelIndex - index of the nops and 'label' instructions in a memory space, used by label and template searches.
+//
+// For every site the index records the nop modifier (or -1 for non-nops) and the bounds of the nop run containing it.
+// For every nop modifier it keeps the ascending positions of the nops with that modifier, and of the 'label'
+// instructions immediately followed (cyclically) by such a nop.  Searches only visit the sites whose first nop
+// matches the first nop of the search label, but otherwise reproduce the original scan exactly, including which sites
+// are skipped after a partial match.
+//
+// Built and owned by cCPUMemory (see cCPUMemory::GetNopLabelIndex()), which rebuilds it after any modification.
+
+class cNopLabelIndex
+{
+private:
+  const cInstSet* m_inst_set;
+  int m_size;
+
+  Apto::Array<int> m_nop_mod;                       // Nop modifier of each site, or -1
+  Apto::Array<int> m_run_start;                     // First site of the nop run containing each nop site
+  Apto::Array<int> m_run_end;                       // One past the last site of the nop run containing each nop site
+  Apto::Array<Apto::Array<int> > m_nop_sites;       // Nop modifier -> ascending nop positions
+  Apto::Array<Apto::Array<int> > m_label_sites;     // Nop modifier -> ascending positions of labels leading that nop
+
+  static const Apto::Array<int> s_no_sites;
+
+  const Apto::Array<int>& sitesFor(const Apto::Array<Apto::Array<int> >& sites, int nop_mod) const
+    { return (nop_mod >= 0 && nop_mod < sites.GetSize()) ? sites[nop_mod] : s_no_sites; }
+  int matchLength(const cCodeLabel& label, int pos, int limit) const;
+  static int firstSiteAfter(const Apto::Array<int>& sites, int pos);
+  bool findForward(const Apto::Array<int>& sites, const cCodeLabel& label, int from, int lead, int& found) const;
+
+  cNopLabelIndex(const cNopLabelIndex&); // @not_implemented
+  cNopLabelIndex& operator=(const cNopLabelIndex&); // @not_implemented
+
+public:
+  cNopLabelIndex() : m_inst_set(NULL), m_size(0) { ; }
+
+  void Build(const InstructionSequence& seq, const cInstSet& inst_set);
+  const cInstSet* GetInstSet() const { return m_inst_set; }
+
+  bool IsNop(int pos) const { return m_nop_mod[pos] >= 0; }
+  int GetNopMod(int pos) const { return m_nop_mod[pos]; }
+  int GetRunStart(int pos) const { assert(IsNop(pos)); return m_run_start[pos]; }
+  int GetRunEnd(int pos) const { assert(IsNop(pos)); return m_run_end[pos]; }
+
+  // Searches for a 'label' instruction followed by the nops of label (extra nops are ignored), or for a bare nop
+  // sequence matching label.  The Start variants scan from the beginning of memory without wrapping; the Forward
+  // variants scan cyclically from the site after 'from', stopping short of 'from'.  On success, 'found' is set to the
+  // position of the 'label' instruction, or of the first nop of the sequence.
+  bool FindLabelStart(const cCodeLabel& label, int& found) const;
+  bool FindNopSequenceStart(const cCodeLabel& label, int& found) const;
+  bool FindLabelForward(const cCodeLabel& label, int from, int& found) const;
+  bool FindNopSequenceForward(const cCodeLabel& label, int from, int& found) const;
+
+  // Plain nop sequence matches without wrapping, for the cHardwareCPU style searches: the first whose first nop is at
+  // or after 'from', or the last that ends at or before 'end'.  'found' is set to the position of the first nop.
+  bool FindNopSequenceFrom(const cCodeLabel& label, int from, int& found) const;
+  bool FindNopSequenceBefore(const cCodeLabel& label, int end, int& found) const;
+};
+
+#endif
@@ -391,8 +391,8 @@ void cTestCPU::PrintGenome(cAvidaContext& ctx, const Genome& genome, cString fil
   df->WriteComment("Tasks Performed:");
   
   const cEnvironment& env = m_world->GetEnvironment();
-  const Apto::Array<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
-  const Apto::Array<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
+  const tArraySlice<int>& task_count = test_info.GetTestPhenotype().GetLastTaskCount();
+  const tArraySlice<double>& task_qual = test_info.GetTestPhenotype().GetLastTaskQuality();
   for (int i = 0; i < task_count.GetSize(); i++) {
     df->WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
                           task_count[i], task_qual[i]));
@@ -402,8 +402,8 @@ void cTestCPU::PrintGenome(cAvidaContext& ctx, const Genome& genome, cString fil
   if(m_world->GetConfig().USE_RESOURCE_BINS.Get())  {
   	df->WriteComment("Tasks Performed Using Internal Resources:");
   	
-  	const Apto::Array<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
-  	const Apto::Array<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
+  	const tArraySlice<int>& internal_task_count = test_info.GetTestPhenotype().GetLastInternalTaskCount();
+  	const tArraySlice<double>& internal_task_qual = test_info.GetTestPhenotype().GetLastInternalTaskQuality();
   	
   	for (int i = 0; i < task_count.GetSize(); i++) {
   		df->WriteComment(c.Set("%s %d (%f)", static_cast<const char*>(env.GetTask(i).GetName()),
@@ -64,6 +64,11 @@ double cTestCPUInterface::GetResourceVal(cAvidaContext& ctx, int res_id)
   return m_testcpu->GetResourceVal(ctx, res_id);
 }
 
+cResourceView cTestCPUInterface::GetResourceView(cAvidaContext& ctx)
+{
+  return cResourceView(m_testcpu->GetResources(ctx));
+}
+
 const Apto::Array<double>& cTestCPUInterface::GetFacedCellResources(cAvidaContext& ctx)
 {
   return m_testcpu->GetFacedCellResources(ctx); 
@@ -103,6 +103,7 @@ public:
   const Apto::Array<int>& GetInputs() const;
   const Apto::Array<double>& GetResources(cAvidaContext& ctx); 
   double GetResourceVal(cAvidaContext& ctx, int res_id);
+  cResourceView GetResourceView(cAvidaContext& ctx);
   const Apto::Array<double>& GetFacedCellResources(cAvidaContext& ctx); 
   double GetFacedResourceVal(cAvidaContext& ctx, int res_id);
   const Apto::Array<double>& GetDemeResources(int deme_id, cAvidaContext& ctx); 
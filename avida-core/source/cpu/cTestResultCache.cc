@@ -0,0 +1,177 @@
+/*
+ *  cTestResultCache.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cTestResultCache.h"
+
+#include "avida/core/InstructionSequence.h"
+
+#include "cCPUTestInfo.h"
+
+
+static inline bool isCacheable(const cCPUTestInfo& settings)
+{
+  // Manual inputs, tracing, and externally supplied resource histories all carry state that is not part of the key
+  return !settings.GetUseManualInputs() && !settings.GetResourceHistory() && !settings.GetTracer();
+}
+
+
+unsigned long long cTestResultCache::hashKey(const Genome& genome, const cCPUTestInfo& settings)
+{
+  // 64-bit FNV-1a over the test settings, the hardware type, the instruction set and the genome contents
+  unsigned long long hash = 14695981039346656037ULL;
+  const int words[] = { settings.GetGenerationTests(), settings.GetUseRandomInputs(), settings.GetResourceMethod(),
+    settings.GetResourceUpdate(), genome.HardwareType() };
+  for (unsigned int i = 0; i < sizeof(words) / sizeof(int); i++) {
+    hash ^= (unsigned long long)words[i];
+    hash *= 1099511628211ULL;
+  }
+
+  const Apto::String inst_set = genome.Properties().Get("instset").StringValue();
+  for (int i = 0; i < inst_set.GetSize(); i++) {
+    hash ^= (unsigned long long)(unsigned char)inst_set[i];
+    hash *= 1099511628211ULL;
+  }
+
+  ConstInstructionSequencePtr seq;
+  seq.DynamicCastFrom(genome.Representation());
+  if (seq) {
+    for (int i = 0; i < seq->GetSize(); i++) {
+      hash ^= (unsigned long long)(*seq)[i].GetOp();
+      hash *= 1099511628211ULL;
+    }
+    hash ^= (unsigned long long)seq->GetSize();
+    hash *= 1099511628211ULL;
+  } else {
+    const Apto::String rep = genome.Representation()->AsString();
+    for (int i = 0; i < rep.GetSize(); i++) {
+      hash ^= (unsigned long long)(unsigned char)rep[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+
+  return hash;
+}
+
+
+int cTestResultCache::GetSeed(const Genome& genome, const cCPUTestInfo& settings) const
+{
+  return (int)(hashKey(genome, settings) % 0x7fffffffULL);
+}
+
+
+void cTestResultCache::SetCapacity(int capacity)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  m_capacity = (capacity > 0) ? capacity : 0;
+  m_entries.ResizeClear(m_capacity);
+  m_index.Clear();
+  m_size = 0;
+  m_next = 0;
+}
+
+
+bool cTestResultCache::Lookup(const Genome& genome, const cCPUTestInfo& settings, sTestResult& result)
+{
+  if (m_capacity == 0 || !isCacheable(settings)) return false;
+
+  const unsigned long long key = hashKey(genome, settings);
+
+  Apto::MutexAutoLock lock(m_mutex);
+  int slot = -1;
+  if (m_index.Get(key, slot) && *m_entries[slot].genome == genome) {
+    result = m_entries[slot].result;
+    m_hits++;
+    return true;
+  }
+
+  m_misses++;
+  return false;
+}
+
+
+void cTestResultCache::Store(const Genome& genome, const cCPUTestInfo& settings, const sTestResult& result)
+{
+  if (m_capacity == 0 || !isCacheable(settings)) return;
+
+  const unsigned long long key = hashKey(genome, settings);
+  GenomePtr stored_genome(new Genome(genome));
+
+  Apto::MutexAutoLock lock(m_mutex);
+
+  // A colliding key (or a concurrent store of the same genome) simply takes over the existing slot
+  int slot = -1;
+  if (!m_index.Get(key, slot)) {
+    if (m_size < m_capacity) {
+      slot = m_size++;
+    } else {
+      slot = m_next;
+      m_index.Remove(m_entries[slot].key);
+      m_next = (m_next + 1) % m_capacity;
+    }
+    m_index.Set(key, slot);
+  }
+
+  sEntry& entry = m_entries[slot];
+  entry.key = key;
+  entry.genome = stored_genome;
+  entry.result = result;
+}
+
+
+void cTestResultCache::Clear()
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  for (int i = 0; i < m_size; i++) m_entries[i].genome = GenomePtr(NULL);
+  m_index.Clear();
+  m_size = 0;
+  m_next = 0;
+}
+
+
+int cTestResultCache::GetSize() const
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  return m_size;
+}
+
+int cTestResultCache::GetHits() const
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  return m_hits;
+}
+
+int cTestResultCache::GetMisses() const
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  return m_misses;
+}
+
+void cTestResultCache::ResetCounts()
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  m_hits = 0;
+  m_misses = 0;
+}
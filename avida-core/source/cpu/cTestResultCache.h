@@ -0,0 +1,93 @@
+/*
+ *  cTestResultCache.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cTestResultCache_h
+#define cTestResultCache_h
+
+#include "apto/core.h"
+#include "apto/core/Mutex.h"
+#include "avida/core/Genome.h"
+
+class cCPUTestInfo;
+
+using namespace Avida;
+
+
+// cTestResultCache - bounded memo of test CPU results, keyed on the genome and the test settings used.
+//
+// Used by the test-on-divide reversion/sterilization checks, where most mutated offspring are duplicates of genomes
+// that have already been tested.  Entries are replaced first-in first-out once the cache is full.  The full genome is
+// kept with each entry, so a fingerprint collision is a miss rather than a wrong answer.  All methods are thread safe.
+
+class cTestResultCache
+{
+public:
+  struct sTestResult
+  {
+    double fitness;
+    bool is_viable;
+    int max_depth;
+    Apto::Array<int> task_counts;  // Last task counts of the tested organism
+
+    sTestResult() : fitness(0.0), is_viable(false), max_depth(0) { ; }
+  };
+
+private:
+  struct sEntry
+  {
+    unsigned long long key;
+    GenomePtr genome;
+    sTestResult result;
+  };
+
+  mutable Apto::Mutex m_mutex;
+  Apto::Array<sEntry> m_entries;
+  Apto::Map<unsigned long long, int> m_index;  // key -> slot in m_entries
+  int m_capacity;
+  int m_size;
+  int m_next;                                  // Next slot to fill (and evict once full)
+  int m_hits;
+  int m_misses;
+
+  static unsigned long long hashKey(const Genome& genome, const cCPUTestInfo& settings);
+
+  cTestResultCache(const cTestResultCache&); // @not_implemented
+  cTestResultCache& operator=(const cTestResultCache&); // @not_implemented
+
+public:
+  cTestResultCache() : m_capacity(0), m_size(0), m_next(0), m_hits(0), m_misses(0) { ; }
+
+  // A capacity of zero disables the cache entirely; Lookup() then always misses without counting
+  void SetCapacity(int capacity);
+  bool IsEnabled() const { return m_capacity > 0; }
+
+  bool Lookup(const Genome& genome, const cCPUTestInfo& settings, sTestResult& result);
+  int GetSeed(const Genome& genome, const cCPUTestInfo& settings) const;  // Random seed for testing this genome
+  void Store(const Genome& genome, const cCPUTestInfo& settings, const sTestResult& result);
+  void Clear();
+
+  int GetCapacity() const { return m_capacity; }
+  int GetSize() const;
+  int GetHits() const;
+  int GetMisses() const;
+  void ResetCounts();
+};
+
+#endif
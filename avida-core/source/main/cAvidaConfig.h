@@ -282,6 +282,12 @@ public:
   CONFIG_ADD_VAR(VERBOSITY, int, 1, "0 = No output at all\n1 = Normal output\n2 = Verbose output, detailing progress\n3 = High level of details, as available\n4 = Print Debug Information, as applicable");
   CONFIG_ADD_VAR(RANDOM_SEED, int, -1, "Random number seed (<0 for based on time)");
   CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms)");
+  CONFIG_ADD_VAR(PARALLEL_UPDATE_THREADS, int, 0, "Number of worker threads used to pre-execute organisms each update\n(0 or 1 = disabled; requires that speculative execution be possible and\n that no instructions affect other organisms without stalling;\n the update's schedule is drawn when it begins, so merit changes and\n offspring take effect in the next update)");
+  CONFIG_ADD_VAR(TIME_SLICE_QUANTUM, int, 1, "Maximum number of instructions executed each time an organism is scheduled\n(ends early on divide, death or instructions that interact with other cells;\n requires that speculative execution be possible)");
+  CONFIG_ADD_VAR(RESOURCE_UPDATE_THREADS, int, 0, "Number of worker threads used to update spatial resources\n(0 or 1 = disabled; results are identical to the serial update)");
+  CONFIG_ADD_VAR(RESOURCE_TILE_MIN_CELLS, int, 16384, "Smallest spatial resource grid whose diffusion is split into row bands\nacross the resource update threads");
+  CONFIG_ADD_VAR(GENOME_TEST_THREADS, int, 0, "Number of worker threads that test genotypes in the background\n(0 = test each genotype on first use; otherwise test RNG draws come from per-genotype streams)");
+  CONFIG_ADD_VAR(GENOME_TEST_THRESHOLD, int, 3, "Genotype abundance at which a background test is queued");
   CONFIG_ADD_VAR(POPULATION_CAP, int, 0, "Carrying capacity in number of organisms (use 0 for no cap)");
   CONFIG_ADD_VAR(POP_CAP_ELDEST, int, 0, "Carrying capacity in number of organisms (use 0 for no cap). Will kill oldest organism in population, but still use birth method to place new offspring."); 
   
@@ -311,6 +317,7 @@ public:
   CONFIG_ADD_VAR(COPY_DEL_PROB, double, 0.0, "Deletion rate (per copy)");
   CONFIG_ADD_VAR(COPY_UNIFORM_PROB, double, 0.0, "Uniform mutation probability (per copy)\n- Randomly apply insertion, deletion or substition mutation");
   CONFIG_ADD_VAR(COPY_SLIP_PROB, double, 0.0, "Slip rate (per copy)");
+  CONFIG_ADD_VAR(COPY_MUT_SKIP_AHEAD, bool, 0, "Sample per-copy mutations by counting down geometric skip lengths\n(one random draw per mutation instead of per copy; changes the random number stream)");
   
   CONFIG_ADD_VAR(POINT_MUT_PROB, double, 0.0, "Point (Cosmic-Ray) substitution rate (per-location per update)");
   CONFIG_ADD_VAR(POINT_INS_PROB, double, 0.0, "Point (Cosmic-Ray) insertion rate (per-location per update)");
@@ -536,12 +543,13 @@ public:
   CONFIG_ADD_ALIAS(FAIL_IMPLICIT);
   CONFIG_ADD_VAR(NEUTRAL_MAX,double, 0.0, "Percent benifical change from parent fitness to be considered neutral.");
   CONFIG_ADD_VAR(NEUTRAL_MIN,double, 0.0, "Percent deleterious change from parent fitness to be considered neutral.");
+  CONFIG_ADD_VAR(TEST_ON_DIVIDE_CACHE_SIZE, int, 0, "Number of offspring test results remembered for reversion/sterilization (0 = test every offspring).\nWhen enabled, each genome is tested with inputs drawn from its own random stream,\nso runs differ from uncached ones but not between cache sizes.");
 
   
   // -------- Time Slicing config options --------
   CONFIG_ADD_GROUP(TIME_GROUP, "Time Slicing");
   CONFIG_ADD_VAR(AVE_TIME_SLICE, int, 30, "Average number of CPU-cycles per org per update");
-  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members");
+  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members\n5 = PROBABILISTIC_INTEGRATED: CPU cycles distributed randomly, then deterministicly, proportional to merit\n6 = BATCHED_PROBABILISTIC: as PROBABILISTIC, but each update's cycles are drawn at once and executed in per-organism blocks");
   CONFIG_ADD_VAR(BASE_MERIT_METHOD, int, 4, "How should merit be initialized?\n0 = Constant (merit independent of size)\n1 = Merit proportional to copied size\n2 = Merit prop. to executed size\n3 = Merit prop. to full size\n4 = Merit prop. to min of executed or copied size\n5 = Merit prop. to sqrt of the minimum size\n6 = Merit prop. to num times MERIT_BONUS_INST is in genome.");
   CONFIG_ADD_VAR(BASE_CONST_MERIT, int, 100, "Base merit valse for BASE_MERIT_METHOD 0");
   CONFIG_ADD_VAR(MERIT_BONUS_INST, int, 0, "Instruction ID to count for BASE_MERIT_METHOD 6"); 
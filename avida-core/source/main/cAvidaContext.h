@@ -39,11 +39,12 @@ private:
 
   bool m_analyze;
   bool m_testing;
+  bool m_worker;
   bool m_org_faults;
   
 public:
-  cAvidaContext(Avida::WorldDriver* driver, Apto::Random& rng) : m_driver(driver), m_rng(&rng), m_analyze(false), m_testing(false), m_org_faults(false) { ; }
-  cAvidaContext(Avida::WorldDriver* driver, Apto::Random* rng) : m_driver(driver), m_rng(rng), m_analyze(false), m_testing(false), m_org_faults(false) { ; }
+  cAvidaContext(Avida::WorldDriver* driver, Apto::Random& rng) : m_driver(driver), m_rng(&rng), m_analyze(false), m_testing(false), m_worker(false), m_org_faults(false) { ; }
+  cAvidaContext(Avida::WorldDriver* driver, Apto::Random* rng) : m_driver(driver), m_rng(rng), m_analyze(false), m_testing(false), m_worker(false), m_org_faults(false) { ; }
   ~cAvidaContext() { ; }
   
   Avida::WorldDriver& Driver() { return *m_driver; }
@@ -61,6 +62,11 @@ public:
   void ClearTestMode() { m_testing = false; }  //      when we're running a genotype through a test-cpu
   bool GetTestMode()   { return m_testing; }   //      versus when we're not when dealing with reactions rewards.
 
+  // Contexts owned by background worker threads, which must leave shared statistics alone
+  void SetWorkerMode() { m_worker = true; }
+  void ClearWorkerMode() { m_worker = false; }
+  bool GetWorkerMode() { return m_worker; }
+
   void EnableOrgFaultReporting() { m_org_faults = true; }
   void DisableOrgFaultReporting() { m_org_faults = false; }
   bool OrgFaultReporting() { return m_org_faults; }
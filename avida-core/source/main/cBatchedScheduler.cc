@@ -0,0 +1,100 @@
+/*
+ *  cBatchedScheduler.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBatchedScheduler.h"
+
+
+cBatchedScheduler::cBatchedScheduler(int num_entries, Apto::SmartPtr<Apto::Random> rng)
+  : m_rng(rng), m_priority(num_entries), m_pending_next(0)
+{
+  m_priority.SetAll(0.0);
+}
+
+
+cBatchedScheduler::~cBatchedScheduler()
+{
+}
+
+
+int cBatchedScheduler::Next()
+{
+  while (true) {
+    if (m_pending_next == m_pending.GetSize()) {
+      const int num_cycles = Allocate(m_priority.GetSize(), m_block);
+      if (num_cycles == 0) return -1;
+      
+      m_pending.Resize(num_cycles);
+      int cycle = 0;
+      for (int entry_id = 0; entry_id < m_block.GetSize(); entry_id++) {
+        for (int i = 0; i < m_block[entry_id]; i++) m_pending[cycle++] = entry_id;
+      }
+      Shuffle(m_pending);
+      m_pending_next = 0;
+    }
+    
+    const int entry_id = m_pending[m_pending_next++];
+    if (m_priority[entry_id] > 0.0) return entry_id;
+  }
+}
+
+
+int cBatchedScheduler::Allocate(int num_cycles, Apto::Array<int>& cycles)
+{
+  cycles.ResizeClear(m_priority.GetSize());
+  cycles.SetAll(0);
+  
+  double total = 0.0;
+  int last_entry = -1;
+  for (int entry_id = 0; entry_id < m_priority.GetSize(); entry_id++) {
+    if (m_priority[entry_id] <= 0.0) continue;
+    total += m_priority[entry_id];
+    last_entry = entry_id;
+  }
+  if (last_entry < 0 || num_cycles <= 0) return 0;
+  
+  // Each entry takes a binomial share of the cycles left over by the entries before it, with success probability
+  // equal to its share of the priority that remains; the last entry receives whatever is left
+  int remaining = num_cycles;
+  for (int entry_id = 0; entry_id < last_entry && remaining > 0; entry_id++) {
+    const double priority = m_priority[entry_id];
+    if (priority <= 0.0) continue;
+    
+    const double share = priority / total;
+    int drawn = (share < 1.0) ? (int)m_rng->GetRandBinomial(remaining, share) : remaining;
+    if (drawn > remaining) drawn = remaining;
+    cycles[entry_id] = drawn;
+    remaining -= drawn;
+    total -= priority;
+  }
+  cycles[last_entry] += remaining;
+  
+  return num_cycles;
+}
+
+
+void cBatchedScheduler::Shuffle(Apto::Array<int>& entries)
+{
+  for (int i = entries.GetSize() - 1; i > 0; i--) {
+    const int j = m_rng->GetInt(i + 1);
+    const int tmp = entries[i];
+    entries[i] = entries[j];
+    entries[j] = tmp;
+  }
+}
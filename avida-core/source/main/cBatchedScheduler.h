@@ -0,0 +1,68 @@
+/*
+ *  cBatchedScheduler.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBatchedScheduler_h
+#define cBatchedScheduler_h
+
+#include "apto/core.h"
+#include "apto/scheduler.h"
+
+
+// cBatchedScheduler - merit proportional CPU cycle allocation, drawn a block of cycles at a time.
+//
+// Over any span in which priorities do not change, the number of cycles each entry receives out of n probabilistic
+// draws is multinomial in the entries' shares of the total priority.  Allocate() samples that directly as a chain of
+// conditional binomials, one draw per entry with non-zero priority, in place of Apto::Scheduler::Probabilistic's
+// weighted tree descent per cycle.  AdjustPriority() is O(1), and adjustments take effect with the next block.
+//
+// Next() serves single cycles, for drivers that schedule one step at a time, from shuffled blocks of one cycle per
+// entry.  Cycles drawn for an entry whose priority has since dropped to zero are skipped.
+
+class cBatchedScheduler : public Apto::PriorityScheduler
+{
+private:
+  Apto::SmartPtr<Apto::Random> m_rng;
+  Apto::Array<double> m_priority;
+  
+  Apto::Array<int> m_block;     // Cycles per entry of the block being served by Next()
+  Apto::Array<int> m_pending;   // Entry of each cycle of the block, in the order they are served
+  int m_pending_next;
+  
+  
+  cBatchedScheduler(); // @not_implemented
+  cBatchedScheduler(const cBatchedScheduler&); // @not_implemented
+  cBatchedScheduler& operator=(const cBatchedScheduler&); // @not_implemented
+  
+public:
+  cBatchedScheduler(int num_entries, Apto::SmartPtr<Apto::Random> rng);
+  ~cBatchedScheduler();
+  
+  void AdjustPriority(int entry_id, double priority) { m_priority[entry_id] = priority; }
+  int Next();
+  
+  // Distribute num_cycles over the entries in proportion to their current priorities, returning the number of cycles
+  // handed out (zero if every entry has zero priority, num_cycles otherwise)
+  int Allocate(int num_cycles, Apto::Array<int>& cycles);
+  
+  // Randomly permute the order of a list of entries using the scheduler's random number stream
+  void Shuffle(Apto::Array<int>& entries);
+};
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ *  cConnectionTable.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cConnectionTable.h"
+
+#include "cPopulationCell.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+void cConnectionTable::ResizeClear(int num_cells, int initial_capacity)
+{
+  m_start.ResizeClear(num_cells);
+  m_size.ResizeClear(num_cells);
+  m_capacity.ResizeClear(num_cells);
+  m_facing.ResizeClear(num_cells);
+  m_neighbors.ResizeClear(num_cells * initial_capacity);
+
+  for (int i = 0; i < num_cells; i++) {
+    m_start[i] = i * initial_capacity;
+    m_size[i] = 0;
+    m_capacity[i] = initial_capacity;
+    m_facing[i] = 0;
+  }
+  m_used = num_cells * initial_capacity;
+
+  clearNeighborhoods();
+  m_visit_mark.ResizeClear(num_cells);
+  m_visit_mark.SetAll(0);
+  m_visit_stamp = 0;
+}
+
+
+void cConnectionTable::Compact()
+{
+  int total = 0;
+  for (int i = 0; i < m_size.GetSize(); i++) total += m_size[i];
+
+  Apto::Array<cPopulationCell*> packed(total);
+  int offset = 0;
+  for (int i = 0; i < m_size.GetSize(); i++) {
+    for (int j = 0; j < m_size[i]; j++) packed[offset + j] = m_neighbors[m_start[i] + j];
+    m_start[i] = offset;
+    m_capacity[i] = m_size[i];
+    offset += m_size[i];
+  }
+
+  m_neighbors = packed;
+  m_used = total;
+}
+
+
+void cConnectionTable::growRun(int cell_id)
+{
+  const int new_capacity = Apto::Max(2 * m_capacity[cell_id], 4);
+  if (m_used + new_capacity > m_neighbors.GetSize()) {
+    m_neighbors.Resize(m_used + new_capacity + m_used / 8);
+  }
+
+  // Abandon the old run and move this cell's neighbors to fresh space at the end of the table
+  const int old_start = m_start[cell_id];
+  for (int i = 0; i < m_size[cell_id]; i++) m_neighbors[m_used + i] = m_neighbors[old_start + i];
+  m_start[cell_id] = m_used;
+  m_capacity[cell_id] = new_capacity;
+  m_used += new_capacity;
+}
+
+
+void cConnectionTable::PushFront(int cell_id, cPopulationCell* neighbor)
+{
+  if (m_size[cell_id] == m_capacity[cell_id]) growRun(cell_id);
+
+  // Insert just before the faced entry, which makes the new neighbor the one faced
+  cPopulationCell** run = &m_neighbors[m_start[cell_id]];
+  const int facing = m_facing[cell_id];
+  for (int i = m_size[cell_id]; i > facing; i--) run[i] = run[i - 1];
+  run[facing] = neighbor;
+  m_size[cell_id]++;
+
+  clearNeighborhoods();
+}
+
+
+void cConnectionTable::PushRear(int cell_id, cPopulationCell* neighbor)
+{
+  const bool was_empty = (m_size[cell_id] == 0);
+  PushFront(cell_id, neighbor);
+
+  // Stepping the facing past the new entry leaves it last in facing order
+  if (!was_empty) m_facing[cell_id]++;
+}
+
+
+bool cConnectionTable::Remove(int cell_id, cPopulationCell* neighbor)
+{
+  const int pos = Find(cell_id, neighbor);
+  if (pos < 0) return false;
+
+  const int size = m_size[cell_id];
+  int idx = m_facing[cell_id] + pos;
+  if (idx >= size) idx -= size;
+
+  cPopulationCell** run = &m_neighbors[m_start[cell_id]];
+  for (int i = idx; i < size - 1; i++) run[i] = run[i + 1];
+  m_size[cell_id]--;
+
+  // Keep facing the same neighbor, or the one following it if it was the one removed
+  if (idx < m_facing[cell_id]) m_facing[cell_id]--;
+  if (m_facing[cell_id] >= m_size[cell_id]) m_facing[cell_id] = 0;
+
+  clearNeighborhoods();
+  return true;
+}
+
+
+int cConnectionTable::Find(int cell_id, const cPopulationCell* neighbor) const
+{
+  const int size = m_size[cell_id];
+  for (int pos = 0; pos < size; pos++) {
+    if (Get(cell_id, pos) == neighbor) return pos;
+  }
+  return -1;
+}
+
+
+static bool lessCellID(const cPopulationCell* a, const cPopulationCell* b)
+{
+  return a->GetID() < b->GetID();
+}
+
+// Neighborhoods are published to readers that take no lock: a pointer is stored with release ordering only once what
+// it points to is complete, and loaded with acquire ordering before it is followed.
+template <typename T> static inline T* loadPublished(T* const* ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+template <typename T> static inline void publish(T** ptr, T* value) { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+
+
+cConnectionTable::sRadiusTable::sRadiusTable(int in_radius, int num_cells, sRadiusTable* in_next)
+  : radius(in_radius), cells(num_cells), next(in_next)
+{
+  cells.SetAll(NULL);
+}
+
+cConnectionTable::sRadiusTable::~sRadiusTable()
+{
+  for (int i = 0; i < cells.GetSize(); i++) delete cells[i];
+}
+
+
+void cConnectionTable::clearNeighborhoods()
+{
+  // Rewiring never overlaps with readers, so the tables can simply be dropped
+  Apto::MutexAutoLock lock(m_radius_mutex);
+  while (m_radius_tables) {
+    sRadiusTable* table = m_radius_tables;
+    m_radius_tables = table->next;
+    delete table;
+  }
+}
+
+
+cConnectionTable::sRadiusTable* cConnectionTable::findRadiusTable(int radius) const
+{
+  for (sRadiusTable* table = loadPublished(&m_radius_tables); table; table = table->next) {
+    if (table->radius == radius) return table;
+  }
+  return NULL;
+}
+
+
+cNeighborhood cConnectionTable::GetNeighborhood(int cell_id, int radius) const
+{
+  assert(radius >= 1);
+
+  sRadiusTable* table = findRadiusTable(radius);
+  Apto::Array<cPopulationCell*>* cells = (table) ? loadPublished(&table->cells[cell_id]) : NULL;
+
+  if (!cells) {
+    Apto::MutexAutoLock lock(m_radius_mutex);
+
+    // Another thread may have added the table or built the neighborhood while this one waited
+    table = findRadiusTable(radius);
+    if (!table) {
+      table = new sRadiusTable(radius, m_size.GetSize(), m_radius_tables);
+      publish(&m_radius_tables, table);
+    }
+    cells = table->cells[cell_id];
+    if (!cells) {
+      cells = buildNeighborhood(cell_id, radius);
+      publish(&table->cells[cell_id], cells);
+    }
+  }
+
+  return cNeighborhood(*cells, 0, cells->GetSize());
+}
+
+
+Apto::Array<cPopulationCell*>* cConnectionTable::buildNeighborhood(int cell_id, int radius) const
+{
+  // Breadth first search out to radius, marking cells as they are reached so that each is listed once
+  if (++m_visit_stamp == 0) {
+    m_visit_mark.SetAll(0);
+    m_visit_stamp = 1;
+  }
+  m_visit_mark[cell_id] = m_visit_stamp;
+
+  Apto::Array<cPopulationCell*>* found_ptr = new Apto::Array<cPopulationCell*>;
+  Apto::Array<cPopulationCell*>& found = *found_ptr;
+
+  // The first level is the cell's own neighbors, each later level the unvisited neighbors of the one before
+  int level_begin = 0;
+  int level_end = 0;
+  for (int depth = 0; depth < radius; depth++) {
+    const int num_sources = (depth == 0) ? 1 : level_end - level_begin;
+    if (num_sources == 0) break;
+    for (int i = 0; i < num_sources; i++) {
+      const int cur_id = (depth == 0) ? cell_id : found[level_begin + i]->GetID();
+      for (int j = 0; j < m_size[cur_id]; j++) {
+        cPopulationCell* neighbor = m_neighbors[m_start[cur_id] + j];
+        const int neighbor_id = neighbor->GetID();
+        if (m_visit_mark[neighbor_id] == m_visit_stamp) continue;
+        m_visit_mark[neighbor_id] = m_visit_stamp;
+        found.Push(neighbor);
+      }
+    }
+    level_begin = level_end;
+    level_end = found.GetSize();
+  }
+
+  // List everything reached in cell id order
+  if (found.GetSize() > 1) std::sort(&found[0], &found[0] + found.GetSize(), lessCellID);
+
+  return found_ptr;
+}
@@ -0,0 +1,166 @@
+/*
+ *  cConnectionTable.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cConnectionTable_h
+#define cConnectionTable_h
+
+#include "apto/core.h"
+#include "apto/core/Mutex.h"
+
+class cNeighborhood;
+class cPopulationCell;
+
+
+// cConnectionTable - neighbor lists for every cell of a population, stored compressed-sparse-row style.
+//
+// Each cell owns a contiguous run of m_neighbors, so walking a neighborhood touches adjacent memory instead of
+// chasing list nodes.  A cell's facing is an index into its run; rotating only changes that index.  Runs are given
+// slack while the topology is being built and are packed tight by Compact().  Adding a neighbor to a full run moves
+// the run to the end of the table, so rewiring at runtime (ConnectCells, SeverGridRow, ...) remains cheap.
+//
+// The table also caches the neighborhoods used by multi-hop queries (see GetNeighborhood).  A cell's neighborhood at a
+// radius is built the first time it is asked for, under a lock, and published so that later requests read it without
+// locking; any number of threads may query the table at once.  Only the cells and radii actually asked for are built.
+// Neighborhoods are discarded whenever a connection is added or removed, which must not happen while other threads
+// are reading the table.
+
+class cConnectionTable
+{
+  friend class cNeighborhood;
+
+private:
+  Apto::Array<cPopulationCell*> m_neighbors;
+  Apto::Array<int> m_start;     // Offset of each cell's run within m_neighbors
+  Apto::Array<int> m_size;      // Number of neighbors of each cell
+  Apto::Array<int> m_capacity;  // Length of each cell's run
+  Apto::Array<int> m_facing;    // Position within the run of the cell currently faced
+  int m_used;                   // Entries of m_neighbors handed out to runs
+
+  // Neighborhoods at one radius, NULL for cells not yet asked for.  Tables form a list, newest radius first; the list
+  // head and each cell's entry are only ever set once per cache lifetime, after what they point to is complete.
+  struct sRadiusTable
+  {
+    int radius;
+    Apto::Array<Apto::Array<cPopulationCell*>*> cells;
+    sRadiusTable* next;
+
+    sRadiusTable(int in_radius, int num_cells, sRadiusTable* in_next);
+    ~sRadiusTable();
+  };
+  mutable Apto::Mutex m_radius_mutex;
+  mutable sRadiusTable* m_radius_tables;
+  mutable Apto::Array<int> m_visit_mark;
+  mutable int m_visit_stamp;
+
+  void growRun(int cell_id);
+  void clearNeighborhoods();
+  sRadiusTable* findRadiusTable(int radius) const;
+  Apto::Array<cPopulationCell*>* buildNeighborhood(int cell_id, int radius) const;
+
+  cConnectionTable(const cConnectionTable&); // @not_implemented
+  cConnectionTable& operator=(const cConnectionTable&); // @not_implemented
+
+public:
+  cConnectionTable() : m_used(0), m_radius_tables(NULL), m_visit_stamp(0) { ; }
+  ~cConnectionTable() { clearNeighborhoods(); }
+
+  void ResizeClear(int num_cells, int initial_capacity);
+  void Compact();
+
+  inline int GetSize(int cell_id) const { return m_size[cell_id]; }
+
+  // pos is relative to the facing: position 0 is the faced cell
+  inline cPopulationCell* Get(int cell_id, int pos) const
+  {
+    int idx = m_facing[cell_id] + pos;
+    if (idx >= m_size[cell_id]) idx -= m_size[cell_id];
+    return m_neighbors[m_start[cell_id] + idx];
+  }
+  inline void Rotate(int cell_id, int steps)
+  {
+    const int size = m_size[cell_id];
+    if (size == 0) return;
+    int facing = (m_facing[cell_id] + steps) % size;
+    if (facing < 0) facing += size;
+    m_facing[cell_id] = facing;
+  }
+
+  void PushFront(int cell_id, cPopulationCell* neighbor);
+  void PushRear(int cell_id, cPopulationCell* neighbor);
+  bool Remove(int cell_id, cPopulationCell* neighbor);
+  int Find(int cell_id, const cPopulationCell* neighbor) const;
+
+  // Cells at most radius connections away from cell_id.  The cell itself is never listed, even when a path through the
+  // connections leads back to it.
+  cNeighborhood GetNeighborhood(int cell_id, int radius) const;
+};
+
+
+// cNeighborhood - cells within a given number of connections of a cell, ordered by cell id.
+//
+// Neighborhoods are views of the cache held by the cConnectionTable that produced them, and remain valid until the
+// connections of that table change.
+
+class cNeighborhood
+{
+private:
+  const Apto::Array<cPopulationCell*>* m_cells;
+  int m_start;
+  int m_size;
+
+public:
+  cNeighborhood(const Apto::Array<cPopulationCell*>& cells, int start, int size)
+    : m_cells(&cells), m_start(start), m_size(size) { ; }
+
+  inline int GetSize() const { return m_size; }
+  inline cPopulationCell* Get(int idx) const { return (*m_cells)[m_start + idx]; }
+};
+
+
+// cConnectionList - view of a single cell's neighbors within a cConnectionTable.
+//
+// Presents the circular list interface that the facing code is written against: GetFirst() is the faced cell,
+// GetPos() counts from there, and CircNext()/CircPrev() rotate the facing.
+
+class cConnectionList
+{
+private:
+  cConnectionTable* m_table;
+  int m_cell_id;
+
+public:
+  cConnectionList(cConnectionTable* table, int cell_id) : m_table(table), m_cell_id(cell_id) { ; }
+
+  inline int GetSize() const { return m_table->GetSize(m_cell_id); }
+  inline cPopulationCell* GetFirst() const { return (GetSize() > 0) ? m_table->Get(m_cell_id, 0) : NULL; }
+  inline cPopulationCell* GetPos(int pos) const { return (pos < GetSize()) ? m_table->Get(m_cell_id, pos) : NULL; }
+  inline cPopulationCell* FindPtr(cPopulationCell* cell) const { return (m_table->Find(m_cell_id, cell) >= 0) ? cell : NULL; }
+  inline int FindPosPtr(const cPopulationCell* cell) const { return m_table->Find(m_cell_id, cell); }
+
+  inline void CircNext() { m_table->Rotate(m_cell_id, 1); }
+  inline void CircPrev() { m_table->Rotate(m_cell_id, -1); }
+  inline void Rotate(int steps) { m_table->Rotate(m_cell_id, steps); }
+
+  inline void Push(cPopulationCell* cell) { m_table->PushFront(m_cell_id, cell); }
+  inline void PushRear(cPopulationCell* cell) { m_table->PushRear(m_cell_id, cell); }
+  inline cPopulationCell* Remove(cPopulationCell* cell) { return (m_table->Remove(m_cell_id, cell)) ? cell : NULL; }
+};
+
+#endif
@@ -1285,7 +1285,8 @@ void cDeme::DoDemeOutput(cAvidaContext& ctx, int value)
   Apto::Array<double> rbins_in;
 
   // The environment, evaluates if a task and if a resulting reaction were completed
-  bool found = env.TestOutput(ctx, result, taskctx, m_task_count, m_reaction_count, res_in, rbins_in);
+  bool found = env.TestOutput(ctx, result, taskctx, tArraySlice<int>(m_task_count), tArraySlice<int>(m_reaction_count),
+                              res_in, rbins_in);
 
   // No task completed, end here
   if (found == false) {
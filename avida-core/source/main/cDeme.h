@@ -274,7 +274,6 @@ public:
   void GiveBackCellEnergy(int absolute_cell_id, double value, cAvidaContext& ctx); 
   void SetupDemeRes(int id, cResource * res, int verbosity, cWorld* world);                 
   void UpdateDemeRes(cAvidaContext& ctx) { deme_resource_count.GetResources(ctx); } 
-  void Update(double time_step) { deme_resource_count.Update(time_step); }
   int GetRelativeCellID(int absolute_cell_id) const { return absolute_cell_id % GetSize(); } //!< assumes all demes are the same size
   int GetAbsoluteCellID(int relative_cell_id) const { return relative_cell_id + (_id * GetSize()); } //!< assumes all demes are the same size
 	
@@ -299,6 +298,8 @@ public:
   
   void IncTimeUsed(double merit) 
     { time_used++; cur_normalized_time_used += 1.0/merit/(double)cur_org_count; }
+  void IncTimeUsed(double merit, int num_steps)
+    { time_used += num_steps; cur_normalized_time_used += (double)num_steps/merit/(double)cur_org_count; }
   int GetTimeUsed() { return time_used; }
   int GetGestationTime() { return gestation_time; }
   double GetNormalizedTimeUsed() { return cur_normalized_time_used; }
@@ -53,7 +53,7 @@ using namespace Avida;
 
 cEnvironment::cEnvironment(cWorld* world) : m_world(world) , m_tasklib(world),
 m_input_size(INPUT_SIZE_DEFAULT), m_output_size(OUTPUT_SIZE_DEFAULT), m_true_rand(false),
-m_use_specific_inputs(false), m_specific_inputs(), m_mask(0), m_hammers(false), m_paths(false)
+m_use_specific_inputs(false), m_specific_inputs(), m_mask(0), m_hammers(false), m_paths(false), m_reaction_tables_size(-1)
 {
   mut_rates.Setup(world);
   if (m_world->GetConfig().DEFAULT_GROUP.Get() != -1) possible_group_ids.insert(m_world->GetConfig().DEFAULT_GROUP.Get());
@@ -1154,8 +1154,14 @@ bool cEnvironment::LoadLine(cString line, Feedback& feedback)
 
   bool load_ok = true;
   if (type == "RESOURCE") load_ok = LoadResource(line, feedback);
-  else if (type == "REACTION") load_ok = LoadReaction(line, feedback);
-  else if (type == "SET_ACTIVE") load_ok = LoadSetActive(line, feedback);
+  else if (type == "REACTION") {
+    load_ok = LoadReaction(line, feedback);
+    BuildReactionTables();
+  }
+  else if (type == "SET_ACTIVE") {
+    load_ok = LoadSetActive(line, feedback);
+    BuildReactionTables();
+  }
   else if (type == "CELL") load_ok = LoadCell(line, feedback);
   else if (type == "GRID") load_ok = LoadStateGrid(line, feedback);
   else if (type == "GRADIENT_RESOURCE") load_ok = LoadGradientResource(line, feedback); 
@@ -1211,6 +1217,33 @@ bool cEnvironment::Load(const cString& filename, const cString& working_dir, Fee
 }
 
 
+void cEnvironment::BuildReactionTables()
+{
+  const int num_reactions = reaction_lib.GetSize();
+  m_logic_reactions.ResizeClear(cTaskEntry::NUM_LOGIC_IDS + 1);
+  for (int logic_id = -1; logic_id < cTaskEntry::NUM_LOGIC_IDS; logic_id++) {
+    Apto::Array<int>& candidates = m_logic_reactions[logic_id + 1];
+    candidates.Resize(0);
+    for (int i = 0; i < num_reactions; i++) {
+      cReaction* cur_reaction = reaction_lib.GetReaction(i);
+      cTaskEntry* cur_task = cur_reaction->GetTask();
+      
+      // Phenotypic plasticity bonuses may force a task to be marked even when it is not performed, so any such
+      // reaction must always be examined
+      bool logic_only = (cur_task != NULL && cur_task->IsLogicTask());
+      tLWConstListIterator<cReactionProcess> proc_it(cur_reaction->GetProcesses());
+      const cReactionProcess* cur_proc = NULL;
+      while (logic_only && (cur_proc = proc_it.Next()) != NULL) {
+        if (cur_proc->GetPhenPlastBonusMethod() != DEFAULT) logic_only = false;
+      }
+      
+      if (cur_reaction->GetActive() && (!logic_only || cur_task->MatchesLogicId(logic_id))) candidates.Push(i);
+    }
+  }
+  m_reaction_tables_size = num_reactions;
+}
+
+
 void cEnvironment::SetupInputs(cAvidaContext& ctx, Apto::Array<int>& input_array, bool random) const
 {
   input_array.Resize(m_input_size);
@@ -1274,9 +1307,9 @@ bool cEnvironment::TestInput(cReactionResult&, const tBuffer<int>&, const tBuffe
 
 
 bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
-                              cTaskContext& taskctx, const Apto::Array<int>& task_count,
-                              Apto::Array<int>& reaction_count,
-                              const Apto::Array<double>& resource_count,
+                              cTaskContext& taskctx, const tArraySlice<int>& task_count,
+                              tArraySlice<int> reaction_count,
+                              const cResourceView& resource_count,
                               const Apto::Array<double>& rbins_count,
                               bool is_parasite, cContextPhenotype* context_phenotype) const
 {
@@ -1287,11 +1320,21 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
     skipProcessing = true;
 
   // Do setup for reaction tests...
+  taskctx.SetRecordStats(!ctx.GetWorkerMode());
   m_tasklib.SetupTests(taskctx);
+  const int logic_id = taskctx.GetLogicId();
 
-  // Loop through all reactions to see if any have been triggered...
+  // Jump straight to the active reactions that can possibly be triggered by this logic id
   const int num_reactions = reaction_lib.GetSize();
-  for (int i = 0; i < num_reactions; i++) {
+  const bool use_tables = (m_reaction_tables_size == num_reactions);
+  const Apto::Array<int>* candidates = (use_tables) ? &m_logic_reactions[(logic_id >= 0) ? logic_id + 1 : 0] : NULL;
+  const int num_tests = (use_tables) ? candidates->GetSize() : num_reactions;
+
+  if (context_phenotype != 0) context_phenotype->SetupCounts(task_count.GetSize(), num_reactions);
+
+  // Loop through all reactions to see if any have been triggered...
+  for (int test = 0; test < num_tests; test++) {
+    const int i = (use_tables) ? (*candidates)[test] : test;
     cReaction* cur_reaction = reaction_lib.GetReaction(i);
     assert(cur_reaction != NULL);
 
@@ -1315,18 +1358,6 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
     }
 
     if (context_phenotype != 0) {
-      Apto::Array<int> blank_tasks;
-      Apto::Array<int> blank_reactions;
-      blank_tasks.ResizeClear(task_count.GetSize());
-      for(int count=0;count<task_count.GetSize();count++) {
-        blank_tasks[count] = 0;
-      }
-      blank_reactions.ResizeClear(this->GetReactionLib().GetSize());
-      for(int count=0;count<reaction_count.GetSize();count++) {
-        blank_reactions[count] = 0;
-      }
-      context_phenotype->AddTaskCounts(blank_tasks.GetSize(), blank_tasks);
-      context_phenotype->AddReactionCounts(blank_reactions.GetSize(), blank_reactions);
       int context_task_count = context_phenotype->GetTaskCounts()[task_id];
       if (TestContextRequisites(cur_reaction, context_task_count, context_phenotype->GetReactionCounts(), on_divide) == false) {
         if (!skipProcessing) {  // for those parasites again
@@ -1335,7 +1366,8 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
       }
     }
 
-    const double task_quality = m_tasklib.TestOutput(taskctx);
+    const double task_quality =
+      (cur_task->IsLogicTask()) ? (cur_task->MatchesLogicId(logic_id) ? 1.0 : 0.0) : m_tasklib.TestOutput(taskctx);
     assert(task_quality >= 0.0);
 
     // If this task wasn't performed, move on to the next one.
@@ -1368,7 +1400,7 @@ bool cEnvironment::TestOutput(cAvidaContext& ctx, cReactionResult& result,
 }
 
 bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_reaction,
-                                  int task_count, const Apto::Array<int>& reaction_count, const bool on_divide, bool is_parasite) const
+                                  int task_count, const tArraySlice<int>& reaction_count, const bool on_divide, bool is_parasite) const
 {
   const tList<cReactionRequisite>& req_list = cur_reaction->GetRequisites();
   const int num_reqs = req_list.GetSize();
@@ -1388,7 +1420,7 @@ bool cEnvironment::TestRequisites(cTaskContext& taskctx, const cReaction* cur_re
     
     if (taskctx.GetOrganism()) {
       // Have all reactions been met?
-      const Apto::Array<int>& stolen_reactions = taskctx.GetOrganism()->GetPhenotype().GetStolenReactionCount();
+      const tArraySlice<int>& stolen_reactions = taskctx.GetOrganism()->GetPhenotype().GetStolenReactionCount();
       tLWConstListIterator<cReaction> reaction_it(cur_req->GetReactions());
       while (reaction_it.Next() != NULL) {
         int react_id = reaction_it.Get()->GetID();
@@ -1563,7 +1595,7 @@ double cEnvironment::GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskct
 
 
 void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list,
-                               const Apto::Array<double>& resource_count, const Apto::Array<double>& rbins_count,
+                               const cResourceView& resource_count, const Apto::Array<double>& rbins_count,
                                const double task_quality, const double task_probability, const int task_count,
                                const int reaction_id, cReactionResult& result, cTaskContext& taskctx) const
 {
@@ -1619,14 +1651,15 @@ void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>
     } else {
       // Otherwise we're using a finite resource
       const int res_id = in_resource->GetID();
+      const double available = resource_count[res_id];
 
       // check to see if the value of this resource was set to 0 for this cell
-      if (resource_count[res_id]==0) {
+      if (available == 0) {
         consumed = 0;
       } else {
-        assert(resource_count[res_id] >= 0);
+        assert(available >= 0);
         assert(result.GetConsumed(res_id) >= 0);
-        consumed = resource_count[res_id] - result.GetConsumed(res_id);
+        consumed = available - result.GetConsumed(res_id);
         consumed *= cur_process->GetMaxFraction();
         assert(consumed >= 0.0);
       }
@@ -1669,7 +1702,7 @@ void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>
       if (consumed == 0.0) continue;
 
       // Can't consume more resource than what's available.
-      if (!using_rbins) consumed = std::min(consumed, resource_count[res_id]);
+      if (!using_rbins) consumed = std::min(consumed, available);
       else consumed = std::min(consumed, rbins_count[res_id]);
 
       // Mark in the results the resource consumed.
@@ -1723,9 +1756,10 @@ void cEnvironment::DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>
         {
 	  const int res_id = in_resource->GetID();
           assert(cur_process->GetMaxFraction() != 0);
-          assert(resource_count[res_id] != 0);
-          // double reward = cur_process->GetValue() * resource_count[res_id] / (resource_count[res_id] + cur_process->GetMaxFraction());
-          double reward = cur_process->GetValue() * resource_count[res_id] / (resource_count[res_id] + cur_process->GetKsubM());
+          const double available = resource_count[res_id];
+          assert(available != 0);
+          // double reward = cur_process->GetValue() * available / (available + cur_process->GetMaxFraction());
+          double reward = cur_process->GetValue() * available / (available + cur_process->GetKsubM());
           result.AddBonus( reward , reaction_id);
           break;
         }
@@ -1924,6 +1958,7 @@ bool cEnvironment::SetReactionTask(const cString& name, const cString& task)
     if (m_tasklib.GetTask(i).GetName() == task)
     {
       found_reaction->SetTask( m_tasklib.GetTaskReference(i) );
+      BuildReactionTables();
       return true;
     }
   }
@@ -29,8 +29,10 @@
 #include "cMutationRates.h"
 #include "cReactionLib.h"
 #include "cResourceLib.h"
+#include "cResourceView.h"
 #include "cString.h"
 #include "cTaskLib.h"
+#include "tArraySlice.h"
 #include "tList.h"
 
 #include <set>
@@ -83,6 +85,12 @@ private:
   bool m_hammers;
   bool m_paths;
   
+  // Active reactions to examine in TestOutput, indexed by logic id + 1 (slot 0 is for inconsistent outputs).
+  // Reactions triggered by pure logic tasks appear only under the logic ids that satisfy them; all others appear
+  // everywhere.
+  Apto::Array<Apto::Array<int> > m_logic_reactions;
+  int m_reaction_tables_size;  // Number of reactions m_logic_reactions was built for
+  
   cEnvironment(); // @not_implemented
   cEnvironment(const cEnvironment&); // @not_implemented
   cEnvironment& operator=(const cEnvironment&); // @not_implemented
@@ -105,8 +113,8 @@ public:
                  const tBuffer<int>& outputs, const Apto::Array<double>& resource_count) const;
 
   bool TestOutput(cAvidaContext& ctx, cReactionResult& result, cTaskContext& taskctx,
-                  const Apto::Array<int>& task_count, Apto::Array<int>& reaction_count,
-                  const Apto::Array<double>& resource_count, const Apto::Array<double>& rbins_count,
+                  const tArraySlice<int>& task_count, tArraySlice<int> reaction_count,
+                  const cResourceView& resource_count, const Apto::Array<double>& rbins_count,
                   bool is_parasite=false, cContextPhenotype* context_phenotype = 0) const;
 
   // Accessors
@@ -183,16 +191,17 @@ private:
   bool LoadSetActive(cString desc, Feedback& feedback);
   
   bool LoadGradientResource(cString desc, Feedback& feedback);
+  void BuildReactionTables();
   double GetTaskProbability(cAvidaContext& ctx, cTaskContext& taskctx,
 
                             const tList<cReactionProcess>& req_proc, bool& force_mark_task) const;
   
   bool TestRequisites(cTaskContext& taskctx, const cReaction* cur_reaction, int task_count,
-                      const Apto::Array<int>& reaction_count, const bool on_divide = false, bool is_parasite=false) const;
+                      const tArraySlice<int>& reaction_count, const bool on_divide = false, bool is_parasite=false) const;
   bool TestContextRequisites(const cReaction* cur_reaction, int task_count, 
                       const Apto::Array<int>& reaction_count, const bool on_divide = false) const;
   void DoProcesses(cAvidaContext& ctx, const tList<cReactionProcess>& process_list, 
-                   const Apto::Array<double>& resource_count, const Apto::Array<double>& rbin_count,
+                   const cResourceView& resource_count, const Apto::Array<double>& rbin_count,
                    const double task_quality, const double task_probability,
                    const int task_count, const int reaction_id, 
                    cReactionResult& result, cTaskContext& taskctx) const;
@@ -25,6 +25,7 @@
 #include "avida/Avida.h"
 
 #include "cActionLibrary.h"
+#include "cHardwareManager.h"
 #include "cInitFile.h"
 #include "cStats.h"
 #include "cString.h"
@@ -149,6 +150,13 @@ double cEventList::GetTriggerValue(eTriggerType trigger) const
 }
 
 
+// Events other than output may change the environment or configuration, so cached test results can no longer be trusted
+void cEventList::InvalidateTestResults(const cEventListEntry* entry)
+{
+  if (!entry->GetName().IsSubstring("Print", 0)) m_world->GetHardwareManager().GetTestResultCache().Clear();
+}
+
+
 void cEventList::Process(cAvidaContext& ctx)
 {
   double t_val = 0; // trigger value
@@ -163,6 +171,7 @@ void cEventList::Process(cAvidaContext& ctx)
     // IMMEDIATE Events always happen and are always deleted
     if (entry->GetTrigger() == IMMEDIATE) {
       entry->GetAction()->Process(ctx);
+      InvalidateTestResults(entry);
       Delete(entry);
     } else if (entry->GetTrigger() != BIRTHS_INTERRUPT) {
       //BIRTHS_INTERRUPT occur outside of update boundaries
@@ -177,6 +186,7 @@ void cEventList::Process(cAvidaContext& ctx)
 
         // Process the Action
         entry->GetAction()->Process(ctx);
+        InvalidateTestResults(entry);
         
         // Handle Interval Adjustment
         if (entry->GetInterval() == TRIGGER_ALL) {
@@ -233,6 +243,7 @@ void cEventList::ProcessInterrupt(cAvidaContext& ctx)
 				
 				// Process the Action
 				entry->GetAction()->Process(ctx);
+				InvalidateTestResults(entry);
 				
 				// Handle Interval Adjustment
 				if (entry->GetInterval() == TRIGGER_ALL) {
@@ -84,6 +84,7 @@ private:
   void SyncEvent(cEventListEntry* event);
   double GetTriggerValue(eTriggerType trigger) const;
   void Delete(cEventListEntry* entry);
+  void InvalidateTestResults(const cEventListEntry* entry);
   
   cEventList(); // @not_implemented
   cEventList(const cEventList&); // @not_implemented
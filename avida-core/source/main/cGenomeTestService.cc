@@ -0,0 +1,178 @@
+/*
+ *  cGenomeTestService.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cGenomeTestService.h"
+
+#include "apto/rng.h"
+
+#include "cAvidaContext.h"
+#include "cWorld.h"
+
+#include <cassert>
+
+using namespace Avida::Systematics;
+
+
+cGenomeTestService::cGenomeTestService(cWorld* world, int num_workers)
+: m_world(world), m_terminate(false)
+{
+  if (num_workers < 1) num_workers = 1;
+  m_workers.Resize(num_workers);
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i] = new Worker(this);
+    m_workers[i]->Start();
+  }
+}
+
+cGenomeTestService::~cGenomeTestService()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+
+  // Workers drain the queue before honoring the terminate flag, so no pending metrics are left unfilled
+  m_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+
+  for (int i = 0; i < m_submitted.GetSize(); i++) {
+    m_submitted[i]->metrics->m_pending = false;
+    delete m_submitted[i];
+  }
+}
+
+
+void cGenomeTestService::Submit(GenomeTestMetricsPtr metrics, const Genome& genome, int seed)
+{
+  collect();
+
+  sJob* job = new sJob(metrics, genome, seed);
+  metrics->m_pending = true;
+  m_submitted.Push(job);
+
+  m_mutex.Lock();
+  m_queue.PushRear(job);
+  m_mutex.Unlock(); // should unlock prior to signaling condition variable
+  m_cond.Signal();
+}
+
+
+bool cGenomeTestService::IsReady(GenomeTestMetrics* metrics)
+{
+  if (!metrics->m_pending) return true;
+
+  m_mutex.Lock();
+  const bool done = metrics->m_done;
+  m_mutex.Unlock();
+
+  if (done) collect();
+  return done;
+}
+
+
+void cGenomeTestService::Wait(GenomeTestMetrics* metrics)
+{
+  if (!metrics->m_pending) return;
+
+  sJob* job = NULL;
+  for (int i = 0; i < m_submitted.GetSize(); i++) {
+    if (m_submitted[i]->metrics.Get() == metrics) {
+      job = m_submitted[i];
+      break;
+    }
+  }
+  assert(job);
+
+  // A test no worker has started yet is taken off the queue and run right here, rather than waiting behind the rest
+  m_mutex.Lock();
+  const bool queued = (m_queue.Remove(job) != NULL);
+  m_mutex.Unlock();
+
+  if (queued) {
+    Apto::RNG::AvidaRNG rng(job->seed);
+    cAvidaContext ctx(&m_world->GetDriver(), rng);
+    ctx.SetWorkerMode();
+    runJob(ctx, job);
+  } else {
+    m_mutex.Lock();
+    while (!metrics->m_done) m_done_cond.Wait(m_mutex);
+    m_mutex.Unlock();
+  }
+
+  collect();
+}
+
+
+void cGenomeTestService::runJob(cAvidaContext& ctx, sJob* job)
+{
+  job->metrics->evaluate(m_world, ctx, job->genome);
+
+  m_mutex.Lock();
+  job->metrics->m_done = true;
+  job->done = true;
+  m_mutex.Unlock();
+  m_done_cond.Broadcast();
+}
+
+
+// Release the jobs that workers have finished with.  Runs on the submitting thread, which is the only one that
+// touches the jobs' smart pointers.
+void cGenomeTestService::collect()
+{
+  m_mutex.Lock();
+  int num_kept = 0;
+  for (int i = 0; i < m_submitted.GetSize(); i++) {
+    if (m_submitted[i]->done) {
+      m_submitted[i]->metrics->m_pending = false;
+      delete m_submitted[i];
+    } else {
+      m_submitted[num_kept++] = m_submitted[i];
+    }
+  }
+  m_submitted.Resize(num_kept);
+  m_mutex.Unlock();
+}
+
+
+void cGenomeTestService::Worker::Run()
+{
+  Apto::RNG::AvidaRNG rng;
+  cAvidaContext ctx(&m_service->m_world->GetDriver(), rng);
+  ctx.SetWorkerMode();
+
+  while (1) {
+    m_service->m_mutex.Lock();
+    while (!m_service->m_terminate && m_service->m_queue.GetSize() == 0) {
+      m_service->m_cond.Wait(m_service->m_mutex);
+    }
+    if (m_service->m_queue.GetSize() == 0) {
+      m_service->m_mutex.Unlock();
+      break;
+    }
+    sJob* job = m_service->m_queue.Pop();
+    m_service->m_mutex.Unlock();
+
+    rng.ResetSeed(job->seed);
+    m_service->runJob(ctx, job);
+  }
+}
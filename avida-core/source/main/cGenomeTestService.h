@@ -0,0 +1,105 @@
+/*
+ *  cGenomeTestService.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cGenomeTestService_h
+#define cGenomeTestService_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+#include "avida/core/Genome.h"
+#include "avida/private/systematics/GenomeTestMetrics.h"
+
+#include "tList.h"
+
+class cAvidaContext;
+class cWorld;
+
+using namespace Avida;
+
+
+// cGenomeTestService - background evaluation of GenomeTestMetrics on a set of worker threads.
+//
+// Genotypes are submitted as they become abundant enough to be worth testing, and the (initially pending) metrics
+// object is attached to the group straight away.  Each worker owns its own cAvidaContext; its RNG is reseeded from the
+// genotype ID before every test, so a genotype's metrics do not depend on which thread tested it or when.  Worker
+// contexts are flagged so that the tests leave the shared cStats counters untouched.
+//
+// Only the submitting (main) thread ever copies or releases the smart pointers held by jobs; workers see the metrics
+// and genome through the job alone and signal completion under the service mutex.
+
+class cGenomeTestService
+{
+private:
+  struct sJob
+  {
+    Systematics::GenomeTestMetricsPtr metrics;
+    Genome genome;
+    int seed;
+    bool done;
+
+    sJob(Systematics::GenomeTestMetricsPtr in_metrics, const Genome& in_genome, int in_seed)
+      : metrics(in_metrics), genome(in_genome), seed(in_seed), done(false) { ; }
+  };
+
+  class Worker : public Apto::Thread
+  {
+  private:
+    cGenomeTestService* m_service;
+
+    void Run();
+
+  public:
+    Worker(cGenomeTestService* service) : m_service(service) { ; }
+  };
+  friend class Worker;
+
+
+  cWorld* m_world;
+  Apto::Array<Worker*> m_workers;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;       // Signaled when jobs are queued or the service is shutting down
+  Apto::ConditionVariable m_done_cond;  // Broadcast whenever a job completes
+
+  tList<sJob> m_queue;                  // Jobs waiting for a worker
+  Apto::Array<sJob*> m_submitted;       // Jobs not yet collected; only touched by the submitting thread
+  volatile bool m_terminate;
+
+  void runJob(cAvidaContext& ctx, sJob* job);
+  void collect();
+
+
+  cGenomeTestService(); // @not_implemented
+  cGenomeTestService(const cGenomeTestService&); // @not_implemented
+  cGenomeTestService& operator=(const cGenomeTestService&); // @not_implemented
+
+public:
+  cGenomeTestService(cWorld* world, int num_workers);
+  ~cGenomeTestService(); // finishes every queued test before returning
+
+  int GetNumWorkers() const { return m_workers.GetSize(); }
+  int GetNumOutstanding() const { return m_submitted.GetSize(); }
+
+  void Submit(Systematics::GenomeTestMetricsPtr metrics, const Genome& genome, int seed);
+  bool IsReady(Systematics::GenomeTestMetrics* metrics);
+  void Wait(Systematics::GenomeTestMetrics* metrics); // runs the test on the calling thread if no worker has it yet
+};
+
+#endif
@@ -128,6 +128,7 @@ public:
   ~cGradientCount();
 
   void UpdateCount(cAvidaContext& ctx);
+  bool HasIndependentUpdate() const { return false; }
   void StateAll();
   
   void SetGradInitialPlat(double plat_val) { m_initial_plat = plat_val; m_initial = true; }
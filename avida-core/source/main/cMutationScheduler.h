@@ -0,0 +1,70 @@
+/*
+ *  cMutationScheduler.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cMutationScheduler_h
+#define cMutationScheduler_h
+
+#include "cAvidaContext.h"
+
+#include <climits>
+#include <cmath>
+
+
+// cMutationScheduler - per-organism skip-ahead sampling of the per-copy mutation tests.
+//
+// Rather than drawing a Bernoulli trial on every copied instruction, the number of trials until the next event of each
+// type is drawn once from the matching geometric distribution and then counted down.  Successive calls are therefore
+// distributed exactly as independent P(prob) tests, but cost one RNG draw per event rather than one per copy.  When the
+// probability passed in changes (e.g. meta-mutation of the copy rate) the pending countdown is discarded and redrawn,
+// which is valid because the geometric distribution is memoryless.
+
+class cMutationScheduler
+{
+public:
+  enum eCopyTest { COPY_MUT = 0, COPY_INS, COPY_DEL, COPY_UNIFORM, COPY_SLIP, NUM_COPY_TESTS };
+
+private:
+  int m_skip[NUM_COPY_TESTS];     // Trials remaining before the next event; -1 when a new draw is needed
+  double m_prob[NUM_COPY_TESTS];  // Probability the current countdown was drawn with
+
+  static inline int drawSkip(cAvidaContext& ctx, double prob)
+  {
+    if (prob >= 1.0) return 0;
+    const double skip = std::floor(std::log(1.0 - ctx.GetRandom().GetDouble()) / std::log(1.0 - prob));
+    return (skip < (double)INT_MAX) ? (int)skip : INT_MAX;
+  }
+
+public:
+  cMutationScheduler() { Reset(); }
+
+  void Reset() { for (int i = 0; i < NUM_COPY_TESTS; i++) { m_skip[i] = -1; m_prob[i] = 0.0; } }
+
+  inline bool Test(cAvidaContext& ctx, eCopyTest type, double prob)
+  {
+    if (prob == 0.0) return false;
+    if (m_skip[type] < 0 || m_prob[type] != prob) {
+      m_prob[type] = prob;
+      m_skip[type] = drawSkip(ctx, prob);
+    }
+    return (m_skip[type]-- == 0);
+  }
+};
+
+#endif
@@ -45,6 +45,7 @@ class cOrgMessage;
 class cOrgSinkMessage;
 class cPopulationCell;
 class cResourceCount;
+class cResourceView;
 class cString;
 
 using namespace Avida;
@@ -110,6 +111,7 @@ public:
   virtual const Apto::Array<int>& GetInputs() const = 0;
   virtual const Apto::Array<double>& GetResources(cAvidaContext& ctx) = 0; 
   virtual double GetResourceVal(cAvidaContext& ctx, int res_id) = 0;
+  virtual cResourceView GetResourceView(cAvidaContext& ctx) = 0;
   virtual const Apto::Array<double>& GetFacedCellResources(cAvidaContext& ctx) = 0; 
   virtual double GetFacedResourceVal(cAvidaContext& ctx, int res_id) = 0;
   virtual const Apto::Array<double>& GetDemeResources(int deme_id, cAvidaContext& ctx) = 0; 
@@ -79,6 +79,8 @@ public:
   virtual ~OrgPropRetrievalContainer() { ; }
   
   virtual const Property& Get(cOrganism*, const cOrganism::OrgPropertyMap*) const = 0;
+  virtual double GetDouble(cOrganism*) const = 0;
+  virtual int GetInt(cOrganism*) const = 0;
 };
 
 
@@ -100,6 +102,16 @@ public:
   {
     return prop_map->SetTempProp(m_prop_id, (org->*m_fun)());
   }
+  
+  double GetDouble(cOrganism* org) const { return propAsDouble((org->*m_fun)()); }
+  int GetInt(cOrganism* org) const { return propAsInt((org->*m_fun)()); }
+  
+private:
+  static inline double propAsDouble(double value) { return value; }
+  static inline double propAsDouble(const Apto::String& value) { return Apto::StrAs(value); }
+  static inline int propAsInt(int value) { return value; }
+  static inline int propAsInt(double value) { return static_cast<int>(value); }
+  static inline int propAsInt(const Apto::String& value) { return Apto::StrAs(value); }
 };
 
 
@@ -109,6 +121,21 @@ public:
 struct OrgGlobalPropMap
 {
   Apto::Map<Apto::String, OrgPropRetrievalContainer*> prop_map;
+  Apto::Array<OrgPropRetrievalContainer*> interned;     // PropertyMap::Intern() index -> container, NULL if not ours
+  
+  void Define(const Apto::String& prop_id, OrgPropRetrievalContainer* container)
+  {
+    prop_map.Set(prop_id, container);
+    
+    const int p_idx = PropertyMap::Intern(prop_id);
+    while (interned.GetSize() <= p_idx) interned.Push(NULL);
+    interned[p_idx] = container;
+  }
+  
+  inline OrgPropRetrievalContainer* Find(int p_idx) const
+  {
+    return (p_idx >= 0 && p_idx < interned.GetSize()) ? interned[p_idx] : NULL;
+  }
   
   ~OrgGlobalPropMap()
   {
@@ -127,7 +154,7 @@ typedef Apto::SingletonHolder<OrgGlobalPropMap, Apto::CreateWithNew, Apto::Destr
 void cOrganism::Initialize()
 {
 #define DEFINE_PROP(NAME, TYPE, FUNCTION, DESC) s_prop_desc_map.Set(s_prop_name_ ## NAME, DESC); \
-  OrgGlobalPropMapSingleton::Instance().prop_map.Set(s_prop_name_ ## NAME, new OrgPropOfType<TYPE>(s_prop_name_ ## NAME, &cOrganism::FUNCTION));
+  OrgGlobalPropMapSingleton::Instance().Define(s_prop_name_ ## NAME, new OrgPropOfType<TYPE>(s_prop_name_ ## NAME, &cOrganism::FUNCTION));
   DEFINE_PROP(genome, Apto::String, getGenomeString, "Genome");
   DEFINE_PROP(src_transmission_type, int, getSrcTransmissionType, "Source Transmission Type");
   DEFINE_PROP(age, int, getAge, "Age");
@@ -150,6 +177,7 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
   , m_phenotype(world, parent_generation, world->GetHardwareManager().GetInstSet(genome.Properties().Get(s_ext_prop_name_instset).StringValue()).GetNumNops())
   , m_src(src)
   , m_initial_genome(genome)
+  , m_skip_ahead_muts(world->GetConfig().COPY_MUT_SKIP_AHEAD.Get())
   , m_interface(NULL)
   , m_lineage_label(-1)
   , m_lineage(NULL)
@@ -218,7 +246,7 @@ void cOrganism::initialize(cAvidaContext& ctx)
 {
   m_phenotype.SetInstSetSize(m_hardware->GetInstSet().GetSize());
   const_cast<Genome&>(m_initial_genome).Properties().SetValue(s_ext_prop_name_instset,(const char*)m_hardware->GetInstSet().GetInstSetName());
-  m_phenotype.SetGroupAttackInstSetSize(m_world->GetStats().GetGroupAttackInsts(m_hardware->GetInstSet().GetInstSetName()).GetSize());
+  m_phenotype.SetGroupAttackInstSetSize(m_world->GetStats().GetNumGroupAttackInsts(m_hardware->GetInstSet().GetInstSetName()));
   
   if (m_world->GetConfig().DEATH_METHOD.Get() > DEATH_METHOD_OFF) {
     m_max_executed = m_world->GetConfig().AGE_LIMIT.Get();
@@ -412,7 +440,7 @@ void cOrganism::doOutput(cAvidaContext& ctx,
                          cContextPhenotype* context_phenotype)
 {  
   const int deme_id = m_interface->GetDemeID();
-  const Apto::Array<double> & global_resource_count = m_interface->GetResources(ctx);
+  cResourceView resource_view = m_interface->GetResourceView(ctx);
   const Apto::Array<double> & deme_resource_count = m_interface->GetDemeResources(deme_id, ctx);
   const Apto::Array< Apto::Array<int> > & cell_id_lists = m_interface->GetCellIdLists();
   
@@ -446,7 +474,7 @@ void cOrganism::doOutput(cAvidaContext& ctx,
   // Do the testing of tasks performed...
   
   
-  Apto::Array<double> global_res_change(global_resource_count.GetSize());
+  Apto::Array<double> global_res_change(resource_view.GetSize());
   global_res_change.SetAll(0.0);
   Apto::Array<double> deme_res_change(deme_resource_count.GetSize());
   deme_res_change.SetAll(0.0);
@@ -458,31 +486,14 @@ void cOrganism::doOutput(cAvidaContext& ctx,
   cTaskContext taskctx(this, input_buffer, output_buffer, other_input_list, other_output_list,
                        m_hardware->GetExtendedMemory(), on_divide, received_messages_point);
   
-  //combine global and deme resource counts
-  Apto::Array<double> globalAndDeme_resource_count = global_resource_count + deme_resource_count;
+  //combine global and deme resource counts, only the levels of resources a reaction consumes are ever read
+  resource_view.AppendDemeResources(deme_resource_count);
   Apto::Array<double> globalAndDeme_res_change = global_res_change + deme_res_change;
   
   // set any resource amount to 0 if a cell cannot access this resource
-  int cell_id=GetCellID();
-  if (cell_id_lists.GetSize())
-  {
-    for (int i=0; i<cell_id_lists.GetSize(); i++)
-    {
-      // if cell_id_lists have been set then we have to check if this cell is in the list
-      if (cell_id_lists[i].GetSize()) {
-        int j;
-        for (j=0; j<cell_id_lists[i].GetSize(); j++)
-        {
-          if (cell_id==cell_id_lists[i][j])
-            break;
-        }
-        if (j==cell_id_lists[i].GetSize())
-          globalAndDeme_resource_count[i]=0;
-      }
-    }
-  }
+  if (cell_id_lists.GetSize()) resource_view.RestrictToCellLists(cell_id_lists, GetCellID());
   
-  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, globalAndDeme_resource_count, 
+  bool task_completed = m_phenotype.TestOutput(ctx, taskctx, resource_view, 
                                                m_phenotype.GetCurRBinsAvail(), globalAndDeme_res_change, 
                                                insts_triggered, is_parasite, context_phenotype);
   
@@ -497,8 +508,8 @@ void cOrganism::doOutput(cAvidaContext& ctx,
   for (int i = 0; i < deme_res_change.GetSize(); i++) deme_res_change[i] = globalAndDeme_res_change[i + global_res_change.GetSize()];
   
   if(m_world->GetConfig().ENERGY_ENABLED.Get() && m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 1 && task_completed) {
-    m_phenotype.RefreshEnergy();
-    m_phenotype.ApplyToEnergyStore();
+    m_phenotype.RefreshEnergy(ctx);
+    m_phenotype.ApplyToEnergyStore(ctx);
     double newMerit = m_phenotype.ConvertEnergyToMerit(m_phenotype.GetStoredEnergy() * m_phenotype.GetEnergyUsageRatio());
     m_interface->UpdateMerit(ctx, newMerit);
     if(GetPhenotype().GetMerit().GetDouble() == 0.0) {
@@ -616,8 +627,8 @@ void cOrganism::doAVOutput(cAvidaContext& ctx,
 //  deme_res_change = avatarAndDeme_res_change.Subset(avatar_res_change.GetSize(), avatarAndDeme_res_change.GetSize());
   
   if(m_world->GetConfig().ENERGY_ENABLED.Get() && m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 1 && task_completed) {
-    m_phenotype.RefreshEnergy();
-    m_phenotype.ApplyToEnergyStore();
+    m_phenotype.RefreshEnergy(ctx);
+    m_phenotype.ApplyToEnergyStore(ctx);
     double newMerit = m_phenotype.ConvertEnergyToMerit(m_phenotype.GetStoredEnergy() * m_phenotype.GetEnergyUsageRatio());
 		m_interface->UpdateMerit(ctx, newMerit);
 		if(GetPhenotype().GetMerit().GetDouble() == 0.0) {
@@ -867,7 +878,7 @@ bool cOrganism::Divide_CheckViable(cAvidaContext& ctx)
     }
     
     if (toFail) {
-      const Apto::Array<int>& stolenReactions = m_phenotype.GetStolenReactionCount();
+      const tArraySlice<int>& stolenReactions = m_phenotype.GetStolenReactionCount();
       for (int i = 0; i < stolenReactions.GetSize(); i++)
       {
         if (stolenReactions[i] > 0) toFail = false;
@@ -1295,7 +1306,7 @@ void cOrganism::SendFlash(cAvidaContext& ctx) {
   
   // Flash not lost; continue.
   m_interface->SendFlash();
-  m_world->GetStats().SentFlash(*this);
+  if (!ctx.GetWorkerMode()) m_world->GetStats().SentFlash(*this);
   DoOutput(ctx);
 }
 
@@ -1641,6 +1652,21 @@ const Avida::Property& cOrganism::OrgPropertyMap::Get(const PropertyID& p_id) co
 }
 
 
+double cOrganism::OrgPropertyMap::GetDouble(int p_idx) const
+{
+  OrgPropRetrievalContainer* container = OrgGlobalPropMapSingleton::Instance().Find(p_idx);
+  if (container) return container->GetDouble(m_organism);
+  return PropertyMap::GetDouble(p_idx);
+}
+
+int cOrganism::OrgPropertyMap::GetInt(int p_idx) const
+{
+  OrgPropRetrievalContainer* container = OrgGlobalPropMapSingleton::Instance().Find(p_idx);
+  if (container) return container->GetInt(m_organism);
+  return PropertyMap::GetInt(p_idx);
+}
+
+
 bool cOrganism::OrgPropertyMap::SetValue(const PropertyID& p_id, const Apto::String& prop_value) { return false; }
 bool cOrganism::OrgPropertyMap::SetValue(const PropertyID& p_id, const int prop_value) { return false; }
 bool cOrganism::OrgPropertyMap::SetValue(const PropertyID& p_id, const double prop_value) { return false; }
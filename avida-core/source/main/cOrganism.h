@@ -30,6 +30,7 @@
 
 #include "cCPUMemory.h"
 #include "cMutationRates.h"
+#include "cMutationScheduler.h"
 #include "cPhenotype.h"
 #include "cOrgInterface.h"
 #include "cOrgMessage.h"
@@ -69,6 +70,8 @@ private:
   const Genome m_initial_genome;         // Initial genome; can never be changed!
   Apto::Array<Systematics::UnitPtr> m_parasites;   // List of all parasites associated with this organism.
   cMutationRates m_mut_rates;             // Rate of all possible mutations.
+  bool m_skip_ahead_muts;                 // Use m_mut_sched for the per-copy mutation tests (COPY_MUT_SKIP_AHEAD)
+  mutable cMutationScheduler m_mut_sched; // Geometric skip-ahead countdowns for the per-copy mutation tests
   cOrgInterface* m_interface;             // Interface back to the population.
   int m_id;                               // unique id for each org, is just the number it was born
   int m_lineage_label;                    // a lineages tag; inherited unchanged in offspring
@@ -109,6 +112,8 @@ private:
 
   bool killed_event;
 
+  inline Systematics::GenomeTestMetricsPtr testMetrics(cAvidaContext& ctx) const;
+
   cOrganism(); // @not_implemented
   cOrganism(const cOrganism&); // @not_implemented
   cOrganism& operator=(const cOrganism&); // @not_implemented
@@ -306,11 +311,31 @@ public:
   void ClearParasites();
 
   // --------  Mutation Rate Convenience Methods  --------
-  bool TestCopyMut(cAvidaContext& ctx) const { return m_mut_rates.TestCopyMut(ctx); }
-  bool TestCopyIns(cAvidaContext& ctx) const { return m_mut_rates.TestCopyIns(ctx); }
-  bool TestCopyDel(cAvidaContext& ctx) const { return m_mut_rates.TestCopyDel(ctx); }
-  bool TestCopyUniform(cAvidaContext& ctx) const { return m_mut_rates.TestCopyUniform(ctx); }
-  bool TestCopySlip(cAvidaContext& ctx) const { return m_mut_rates.TestCopySlip(ctx); }
+  bool TestCopyMut(cAvidaContext& ctx) const
+  {
+    if (!m_skip_ahead_muts) return m_mut_rates.TestCopyMut(ctx);
+    return m_mut_sched.Test(ctx, cMutationScheduler::COPY_MUT, m_mut_rates.GetCopyMutProb());
+  }
+  bool TestCopyIns(cAvidaContext& ctx) const
+  {
+    if (!m_skip_ahead_muts) return m_mut_rates.TestCopyIns(ctx);
+    return m_mut_sched.Test(ctx, cMutationScheduler::COPY_INS, m_mut_rates.GetCopyInsProb());
+  }
+  bool TestCopyDel(cAvidaContext& ctx) const
+  {
+    if (!m_skip_ahead_muts) return m_mut_rates.TestCopyDel(ctx);
+    return m_mut_sched.Test(ctx, cMutationScheduler::COPY_DEL, m_mut_rates.GetCopyDelProb());
+  }
+  bool TestCopyUniform(cAvidaContext& ctx) const
+  {
+    if (!m_skip_ahead_muts) return m_mut_rates.TestCopyUniform(ctx);
+    return m_mut_sched.Test(ctx, cMutationScheduler::COPY_UNIFORM, m_mut_rates.GetCopyUniformProb());
+  }
+  bool TestCopySlip(cAvidaContext& ctx) const
+  {
+    if (!m_skip_ahead_muts) return m_mut_rates.TestCopySlip(ctx);
+    return m_mut_sched.Test(ctx, cMutationScheduler::COPY_SLIP, m_mut_rates.GetCopySlipProb());
+  }
 
   bool TestDivideMut(cAvidaContext& ctx) const { return m_mut_rates.TestDivideMut(ctx); }
   bool TestDivideIns(cAvidaContext& ctx) const { return m_mut_rates.TestDivideIns(ctx); }
@@ -790,6 +815,9 @@ private:
     
     LIB_LOCAL const Property& Get(const PropertyID& p_id) const;
     
+    LIB_LOCAL double GetDouble(int p_idx) const;
+    LIB_LOCAL int GetInt(int p_idx) const;
+    
     LIB_LOCAL bool SetValue(const PropertyID& p_id, const Apto::String& prop_value);
     LIB_LOCAL bool SetValue(const PropertyID& p_id, const int prop_value);
     LIB_LOCAL bool SetValue(const PropertyID& p_id, const double prop_value);
@@ -836,16 +864,24 @@ private:
 };
 
 
+inline Systematics::GenomeTestMetricsPtr cOrganism::testMetrics(cAvidaContext& ctx) const
+{
+  // Take a finished background test as is; otherwise wait for it, or run it here if no worker has started it yet
+  Systematics::GroupPtr genotype = SystematicsGroup("genotype");
+  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, genotype);
+  return (metrics) ? metrics : Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype);
+}
+
 inline double cOrganism::GetTestFitness(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetFitness();
+  return testMetrics(ctx)->GetFitness();
 }
 
 inline double cOrganism::GetTestMerit(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetMerit();
+  return testMetrics(ctx)->GetMerit();
 }
 
 inline double cOrganism::GetTestColonyFitness(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetColonyFitness();
+  return testMetrics(ctx)->GetColonyFitness();
 }
 
 
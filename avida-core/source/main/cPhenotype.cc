@@ -25,39 +25,36 @@
 #include "cContextPhenotype.h"
 #include "cEnvironment.h"
 #include "cDeme.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
 #include "cOrganism.h"
 #include "cReactionResult.h"
 #include "cTaskState.h"
 #include "cWorld.h"
 #include "tList.h"
 
+#include <cstring>
 #include <fstream>
 
 using namespace std;
 
 
+// Copy as much of src as fits in dest, leaving the remainder of dest untouched
+template <class T> static inline void copyPrefix(tArraySlice<T>& dest, const tArraySlice<T>& src)
+{
+  const int count = (src.GetSize() < dest.GetSize()) ? src.GetSize() : dest.GetSize();
+  for (int i = 0; i < count; i++) dest[i] = src[i];
+}
+
+
 cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 : m_world(world)
 , initialized(false)
+, m_counter_slab(NULL)
+, m_inst_set_size(0)
 , energy_store(0.0)
-, cur_task_count(m_world->GetEnvironment().GetNumTasks())
-, cur_para_tasks(m_world->GetEnvironment().GetNumTasks())
-, cur_host_tasks(m_world->GetEnvironment().GetNumTasks())
-, cur_internal_task_count(m_world->GetEnvironment().GetNumTasks())
-, eff_task_count(m_world->GetEnvironment().GetNumTasks())
-, cur_task_quality(m_world->GetEnvironment().GetNumTasks())  
-, cur_task_value(m_world->GetEnvironment().GetNumTasks())  
-, cur_internal_task_quality(m_world->GetEnvironment().GetNumTasks())
 , cur_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
 , cur_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, first_reaction_cycles(m_world->GetEnvironment().GetReactionLib().GetSize())
-, first_reaction_execs(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_stolen_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())
-, cur_sense_count(m_world->GetStats().GetSenseSize())
-, sensed_resources(m_world->GetEnvironment().GetResourceLib().GetSize())
-, cur_task_time(m_world->GetEnvironment().GetNumTasks())   // Added for tracking time; WRE 03-18-07
 , m_tolerance_immigrants()
 , m_tolerance_offspring_own()
 , m_tolerance_offspring_others()
@@ -67,19 +64,9 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , cur_mating_display_a(0)
 , cur_mating_display_b(0)
 , m_reaction_result(NULL)
-, last_task_count(m_world->GetEnvironment().GetNumTasks())
-, last_para_tasks(m_world->GetEnvironment().GetNumTasks())
-, last_host_tasks(m_world->GetEnvironment().GetNumTasks())
-, last_internal_task_count(m_world->GetEnvironment().GetNumTasks())
-, last_task_quality(m_world->GetEnvironment().GetNumTasks())
-, last_task_value(m_world->GetEnvironment().GetNumTasks())
-, last_internal_task_quality(m_world->GetEnvironment().GetNumTasks())
 , last_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
 , last_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
 , last_collect_spec_counts()
-, last_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
-, last_reaction_add_reward(m_world->GetEnvironment().GetReactionLib().GetSize())  
-, last_sense_count(m_world->GetStats().GetSenseSize())
 , last_mating_display_a(0)
 , last_mating_display_b(0)
 , generation(0)
@@ -94,6 +81,8 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , last_task_time(0)
 
 { 
+  allocateCounters(counterLayout(m_world));
+
   if (parent_generation >= 0) {
     generation = parent_generation;
     if (m_world->GetConfig().GENERATION_INC_METHOD.Get() != GENERATION_INC_BOTH) generation++;
@@ -110,10 +99,11 @@ cPhenotype::~cPhenotype()
   // Remove Task States
   for (Apto::Map<void*, cTaskState*>::ValueIterator it = m_task_states.Values(); it.Next();) delete (*it.Get());
   delete m_reaction_result;
+  delete [] m_counter_slab;
 }
 
 
-cPhenotype::cPhenotype(const cPhenotype& in_phen) : m_reaction_result(NULL)
+cPhenotype::cPhenotype(const cPhenotype& in_phen) : m_counter_slab(NULL), m_inst_set_size(0), m_reaction_result(NULL)
 {
   *this = in_phen;
 }
@@ -121,10 +111,16 @@ cPhenotype::cPhenotype(const cPhenotype& in_phen) : m_reaction_result(NULL)
 
 cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
 {
+  if (this == &in_phen) return *this;
   
   m_world                  = in_phen.m_world;
   initialized              = in_phen.initialized;
   
+  // All slab counters are copied in one go, adopting the source layout if it differs
+  m_inst_set_size          = in_phen.m_inst_set_size;
+  if (m_counter_slab == NULL || m_counter_layout != in_phen.m_counter_layout) allocateCounters(in_phen.m_counter_layout);
+  else bindCounters();
+  if (in_phen.m_counter_slab) memcpy(m_counter_slab, in_phen.m_counter_slab, m_counter_layout.SlabSize() * sizeof(double));
   
   // 1. These are values calculated at the last divide (of self or offspring)
   merit                    = in_phen.merit;
@@ -148,45 +144,25 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   cur_energy_bonus         = in_phen.cur_energy_bonus;                   
   cur_num_errors           = in_phen.cur_num_errors;                         
   cur_num_donates          = in_phen.cur_num_donates;                       
-  cur_task_count           = in_phen.cur_task_count;  
-  cur_para_tasks           = in_phen.cur_para_tasks;
-  cur_host_tasks           = in_phen.cur_host_tasks;
-  eff_task_count           = in_phen.eff_task_count;
-  cur_internal_task_count  = in_phen.cur_internal_task_count;
-  cur_task_quality         = in_phen.cur_task_quality;    
-  cur_internal_task_quality= in_phen.cur_internal_task_quality;       
-  cur_task_value           = in_phen.cur_task_value;			
   cur_rbins_total          = in_phen.cur_rbins_total;
   cur_rbins_avail          = in_phen.cur_rbins_avail;
   cur_collect_spec_counts  = in_phen.cur_collect_spec_counts;
-  cur_reaction_count       = in_phen.cur_reaction_count;            
-  first_reaction_cycles    = in_phen.first_reaction_cycles;            
-  first_reaction_execs     = first_reaction_execs;            
-  cur_reaction_add_reward  = in_phen.cur_reaction_add_reward;     
-  cur_inst_count           = in_phen.cur_inst_count;                 
-  cur_from_sensor_count    = in_phen.cur_from_sensor_count;
   cur_group_attack_count    = in_phen.cur_group_attack_count;
   cur_top_pred_group_attack_count    = in_phen.cur_top_pred_group_attack_count;
   cur_killed_targets       = in_phen.cur_killed_targets;
   cur_attacks              = in_phen.cur_attacks;
   cur_kills                 = in_phen.cur_kills;
-  cur_sense_count          = in_phen.cur_sense_count;
-  sensed_resources         = in_phen.sensed_resources;            
-  cur_task_time            = in_phen.cur_task_time;
   m_tolerance_immigrants          = in_phen.m_tolerance_immigrants;
   m_tolerance_offspring_own       = in_phen.m_tolerance_offspring_own;
   m_tolerance_offspring_others    = in_phen.m_tolerance_offspring_others;
   m_intolerances                  = in_phen.m_intolerances;
   cur_child_germline_propensity = in_phen.cur_child_germline_propensity;
-  cur_stolen_reaction_count       = in_phen.cur_stolen_reaction_count;  
   mating_type = in_phen.mating_type; //@CHC
   mate_preference = in_phen.mate_preference; //@CHC
   cur_mating_display_a = in_phen.cur_mating_display_a;
   cur_mating_display_b = in_phen.cur_mating_display_b;
   last_mating_display_a = in_phen.last_mating_display_a;
   last_mating_display_b = in_phen.last_mating_display_b;  
-  
-  cur_from_message_count    = in_phen.cur_from_message_count;
 
   // Dynamically allocated m_task_states requires special handling
   for (Apto::Map<void*, cTaskState*>::ConstIterator it = in_phen.m_task_states.Begin(); it.Next();) {
@@ -200,33 +176,19 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_energy_bonus        = in_phen.last_energy_bonus; 
   last_num_errors          = in_phen.last_num_errors; 
   last_num_donates         = in_phen.last_num_donates;
-  last_task_count          = in_phen.last_task_count;
-  last_host_tasks          = in_phen.last_host_tasks;
-  last_para_tasks          = in_phen.last_para_tasks;
-  last_internal_task_count = in_phen.last_internal_task_count;
-  last_task_quality        = in_phen.last_task_quality;
-  last_internal_task_quality=in_phen.last_internal_task_quality;
-  last_task_value          = in_phen.last_task_value;
   last_rbins_total         = in_phen.last_rbins_total;
   last_rbins_avail         = in_phen.last_rbins_avail;
   last_collect_spec_counts = in_phen.last_collect_spec_counts;
-  last_reaction_count      = in_phen.last_reaction_count;
-  last_reaction_add_reward = in_phen.last_reaction_add_reward; 
-  last_inst_count          = in_phen.last_inst_count;	  
-  last_from_sensor_count   = in_phen.last_from_sensor_count;
   last_group_attack_count   = in_phen.last_group_attack_count;
   last_top_pred_group_attack_count   = in_phen.last_top_pred_group_attack_count;
   last_killed_targets      = in_phen.last_killed_targets;
   last_attacks             = in_phen.last_attacks;
   last_kills                = in_phen.last_kills;
-  last_sense_count         = in_phen.last_sense_count;
   last_fitness             = in_phen.last_fitness;            
   last_child_germline_propensity = in_phen.last_child_germline_propensity;
   total_energy_donated     = in_phen.total_energy_donated;
   total_energy_received    = in_phen.total_energy_received;
   total_energy_applied     = in_phen.total_energy_applied;
-  
-  last_from_message_count   = in_phen.last_from_message_count;
 
   // 4. Records from this organisms life...
   num_divides              = in_phen.num_divides;   
@@ -337,6 +299,210 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
 }
 
 
+/*
+ * Counter slab arrangement.  The slab is an array of doubles holding, in order:
+ *
+ *   [cur block][last block][cur-only extras]
+ *
+ * Each block is the double counters (task quality, task value, internal task quality, reaction add reward) followed by
+ * the int counters (task, host task, internal task and reaction counts; the instruction, from-sensor and from-message
+ * counts at inst_capacity apiece; the sense counts; and finally the parasite task counts).  Parasite tasks come last
+ * so that a divide which keeps them can clear everything else with a single memset.  The extras are the task times
+ * and sensed resources, followed by the effective task counts, first reaction cycles and execs, and stolen reaction
+ * counts.
+ */
+
+cPhenotype::sCounterLayout cPhenotype::counterLayout(cWorld* world)
+{
+  const cEnvironment& env = world->GetEnvironment();
+  
+  sCounterLayout layout;
+  layout.num_tasks = env.GetNumTasks();
+  layout.num_reactions = env.GetReactionLib().GetSize();
+  layout.num_resources = env.GetResourceLib().GetSize();
+  layout.num_senses = world->GetStats().GetSenseSize();
+  for (int i = 0; i < world->GetHardwareManager().GetNumInstSets(); i++) {
+    const int inst_set_size = world->GetHardwareManager().GetInstSet(i).GetSize();
+    if (inst_set_size > layout.inst_capacity) layout.inst_capacity = inst_set_size;
+  }
+  
+  return layout;
+}
+
+
+void cPhenotype::allocateCounters(const sCounterLayout& layout)
+{
+  delete [] m_counter_slab;
+  
+  m_counter_layout = layout;
+  m_counter_slab = new double[layout.SlabSize()];
+  memset(m_counter_slab, 0, layout.SlabSize() * sizeof(double));
+  bindCounters();
+}
+
+
+void cPhenotype::bindCounters()
+{
+  const int num_tasks = m_counter_layout.num_tasks;
+  const int num_reactions = m_counter_layout.num_reactions;
+  const int num_senses = m_counter_layout.num_senses;
+  const int inst_capacity = m_counter_layout.inst_capacity;
+  assert(m_inst_set_size <= inst_capacity);
+  
+  double* cur_block = counterBlock(0);
+  cur_task_quality.Reset(cur_block, num_tasks);
+  cur_task_value.Reset(cur_block + num_tasks, num_tasks);
+  cur_internal_task_quality.Reset(cur_block + 2 * num_tasks, num_tasks);
+  cur_reaction_add_reward.Reset(cur_block + 3 * num_tasks, num_reactions);
+  
+  int* cur_ints = reinterpret_cast<int*>(cur_block + m_counter_layout.BlockDoubles());
+  cur_task_count.Reset(cur_ints, num_tasks);
+  cur_host_tasks.Reset(cur_ints + num_tasks, num_tasks);
+  cur_internal_task_count.Reset(cur_ints + 2 * num_tasks, num_tasks);
+  cur_reaction_count.Reset(cur_ints + 3 * num_tasks, num_reactions);
+  cur_ints += 3 * num_tasks + num_reactions;
+  cur_inst_count.Reset(cur_ints, m_inst_set_size);
+  cur_from_sensor_count.Reset(cur_ints + inst_capacity, m_inst_set_size);
+  cur_from_message_count.Reset(cur_ints + 2 * inst_capacity, m_inst_set_size);
+  cur_sense_count.Reset(cur_ints + 3 * inst_capacity, num_senses);
+  cur_para_tasks.Reset(cur_ints + 3 * inst_capacity + num_senses, num_tasks);
+  
+  double* last_block = counterBlock(1);
+  last_task_quality.Reset(last_block, num_tasks);
+  last_task_value.Reset(last_block + num_tasks, num_tasks);
+  last_internal_task_quality.Reset(last_block + 2 * num_tasks, num_tasks);
+  last_reaction_add_reward.Reset(last_block + 3 * num_tasks, num_reactions);
+  
+  int* last_ints = reinterpret_cast<int*>(last_block + m_counter_layout.BlockDoubles());
+  last_task_count.Reset(last_ints, num_tasks);
+  last_host_tasks.Reset(last_ints + num_tasks, num_tasks);
+  last_internal_task_count.Reset(last_ints + 2 * num_tasks, num_tasks);
+  last_reaction_count.Reset(last_ints + 3 * num_tasks, num_reactions);
+  last_ints += 3 * num_tasks + num_reactions;
+  last_inst_count.Reset(last_ints, m_inst_set_size);
+  last_from_sensor_count.Reset(last_ints + inst_capacity, m_inst_set_size);
+  last_from_message_count.Reset(last_ints + 2 * inst_capacity, m_inst_set_size);
+  last_sense_count.Reset(last_ints + 3 * inst_capacity, num_senses);
+  last_para_tasks.Reset(last_ints + 3 * inst_capacity + num_senses, num_tasks);
+  
+  double* extras = counterBlock(2);
+  cur_task_time.Reset(extras, num_tasks);
+  sensed_resources.Reset(extras + num_tasks, m_counter_layout.num_resources);
+  
+  int* extra_ints = reinterpret_cast<int*>(extras + m_counter_layout.ExtraDoubles());
+  eff_task_count.Reset(extra_ints, num_tasks);
+  first_reaction_cycles.Reset(extra_ints + num_tasks, num_reactions);
+  first_reaction_execs.Reset(extra_ints + num_tasks + num_reactions, num_reactions);
+  cur_stolen_reaction_count.Reset(extra_ints + num_tasks + 2 * num_reactions, num_reactions);
+}
+
+
+void cPhenotype::lockInCurCounters()
+{
+  memcpy(counterBlock(1), counterBlock(0), m_counter_layout.BlockSize() * sizeof(double));
+}
+
+
+void cPhenotype::resetCurCounters(bool reset_para_tasks)
+{
+  size_t num_bytes = m_counter_layout.BlockSize() * sizeof(double);
+  if (!reset_para_tasks) {
+    num_bytes = m_counter_layout.BlockDoubles() * sizeof(double) +
+                (m_counter_layout.BlockInts() - m_counter_layout.num_tasks) * sizeof(int);
+  }
+  memset(counterBlock(0), 0, num_bytes);
+  
+  eff_task_count.SetAll(0);
+  first_reaction_cycles.SetAll(-1);
+  first_reaction_execs.SetAll(-1);
+  cur_stolen_reaction_count.SetAll(0);
+}
+
+
+void cPhenotype::clearLastCounters()
+{
+  memset(counterBlock(1), 0, m_counter_layout.BlockSize() * sizeof(double));
+}
+
+
+void cPhenotype::copyLastCounters(const cPhenotype& src)
+{
+  if (m_counter_layout == src.m_counter_layout && m_inst_set_size == src.m_inst_set_size) {
+    memcpy(counterBlock(1), src.counterBlock(1), m_counter_layout.BlockSize() * sizeof(double));
+    return;
+  }
+  
+  // Layouts only differ if the environment or instruction sets changed since the source was built
+  clearLastCounters();
+  copyPrefix(last_task_count, src.last_task_count);
+  copyPrefix(last_host_tasks, src.last_host_tasks);
+  copyPrefix(last_para_tasks, src.last_para_tasks);
+  copyPrefix(last_internal_task_count, src.last_internal_task_count);
+  copyPrefix(last_task_quality, src.last_task_quality);
+  copyPrefix(last_task_value, src.last_task_value);
+  copyPrefix(last_internal_task_quality, src.last_internal_task_quality);
+  copyPrefix(last_reaction_count, src.last_reaction_count);
+  copyPrefix(last_reaction_add_reward, src.last_reaction_add_reward);
+  copyPrefix(last_inst_count, src.last_inst_count);
+  copyPrefix(last_from_sensor_count, src.last_from_sensor_count);
+  copyPrefix(last_from_message_count, src.last_from_message_count);
+  copyPrefix(last_sense_count, src.last_sense_count);
+}
+
+
+void cPhenotype::SetInstSetSize(int inst_set_size)
+{
+  const int old_size = m_inst_set_size;
+  
+  if (inst_set_size > m_counter_layout.inst_capacity) {
+    // Instruction set is larger than any known when the layout was derived; move everything to a roomier slab
+    double* old_slab = m_counter_slab;
+    const sCounterLayout old_layout = m_counter_layout;
+    sCounterLayout layout = m_counter_layout;
+    layout.inst_capacity = inst_set_size;
+    
+    m_counter_slab = NULL;
+    m_inst_set_size = 0;
+    allocateCounters(layout);
+    
+    const int num_leading_ints = 3 * layout.num_tasks + layout.num_reactions;
+    const int num_trailing_ints = layout.num_senses + layout.num_tasks;
+    for (int block = 0; block < 2; block++) {
+      const double* old_block = old_slab + block * old_layout.BlockSize();
+      double* new_block = counterBlock(block);
+      memcpy(new_block, old_block, layout.BlockDoubles() * sizeof(double));
+      
+      const int* old_ints = reinterpret_cast<const int*>(old_block + layout.BlockDoubles());
+      int* new_ints = reinterpret_cast<int*>(new_block + layout.BlockDoubles());
+      memcpy(new_ints, old_ints, num_leading_ints * sizeof(int));
+      for (int i = 0; i < 3; i++) {
+        memcpy(new_ints + num_leading_ints + i * layout.inst_capacity,
+               old_ints + num_leading_ints + i * old_layout.inst_capacity, old_size * sizeof(int));
+      }
+      memcpy(new_ints + num_leading_ints + 3 * layout.inst_capacity,
+             old_ints + num_leading_ints + 3 * old_layout.inst_capacity, num_trailing_ints * sizeof(int));
+    }
+    memcpy(counterBlock(2), old_slab + 2 * old_layout.BlockSize(),
+           (old_layout.SlabSize() - 2 * old_layout.BlockSize()) * sizeof(double));
+    
+    delete [] old_slab;
+  }
+  
+  m_inst_set_size = inst_set_size;
+  bindCounters();
+  
+  // Newly exposed counters start at zero, as they would in a resized array
+  for (int i = old_size; i < inst_set_size; i++) {
+    cur_inst_count[i] = 0;
+    cur_from_sensor_count[i] = 0;
+    cur_from_message_count[i] = 0;
+    last_inst_count[i] = 0;
+    last_from_sensor_count[i] = 0;
+    last_from_message_count[i] = 0;
+  }
+}
+
+
 /**
  * This function is run whenever a new organism is being constructed inside
  * of its parent.
@@ -379,14 +545,7 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   cur_energy_bonus = 0.0;
   cur_num_errors  = 0;
   cur_num_donates  = 0;
-  cur_task_count.SetAll(0);
-  cur_internal_task_count.SetAll(0);
-  eff_task_count.SetAll(0);
-  cur_host_tasks.SetAll(0);
-  cur_para_tasks.SetAll(0);
-  cur_task_quality.SetAll(0);
-  cur_task_value.SetAll(0);
-  cur_internal_task_quality.SetAll(0);
+  resetCurCounters(true);
   cur_rbins_total.SetAll(0);  // total resources collected in lifetime
   // parent's resources have already been halved or reset in DivideReset;
   // offspring gets that value (half or 0) too.
@@ -400,14 +559,6 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   }
   
   cur_collect_spec_counts.SetAll(0);
-  cur_reaction_count.SetAll(0);
-  first_reaction_cycles.SetAll(-1);
-  first_reaction_execs.SetAll(-1);
-  cur_stolen_reaction_count.SetAll(0);
-  cur_reaction_add_reward.SetAll(0);
-  cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
-  cur_from_message_count.SetAll(0);
   for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
     cur_group_attack_count[r].SetAll(0);
     cur_top_pred_group_attack_count[r].SetAll(0);
@@ -415,11 +566,8 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   cur_killed_targets.SetAll(0);
   cur_attacks = 0;
   cur_kills = 0;
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);  // Added for time tracking; WRE 03-18-07
-  for (int j = 0; j < sensed_resources.GetSize(); j++) {
-    sensed_resources[j] =  parent_phenotype.sensed_resources[j];
-  }
+  copyPrefix(sensed_resources, parent_phenotype.sensed_resources);
   cur_trial_fitnesses.Resize(0); 
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
@@ -444,30 +592,17 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Instru
   last_cpu_cycles_used      = parent_phenotype.last_cpu_cycles_used;
   last_num_errors           = parent_phenotype.last_num_errors;
   last_num_donates          = parent_phenotype.last_num_donates;
-  last_task_count           = parent_phenotype.last_task_count;
-  last_host_tasks           = parent_phenotype.last_host_tasks;
-  last_para_tasks           = parent_phenotype.last_para_tasks;
-  last_internal_task_count  = parent_phenotype.last_internal_task_count;
-  last_task_quality         = parent_phenotype.last_task_quality;
-  last_task_value           = parent_phenotype.last_task_value;
-  last_internal_task_quality= parent_phenotype.last_internal_task_quality;
+  copyLastCounters(parent_phenotype);
   last_rbins_total          = parent_phenotype.last_rbins_total;
   last_rbins_avail          = parent_phenotype.last_rbins_avail;
   last_collect_spec_counts  = parent_phenotype.last_collect_spec_counts;
-  last_reaction_count       = parent_phenotype.last_reaction_count;
-  last_reaction_add_reward  = parent_phenotype.last_reaction_add_reward;
-  last_inst_count           = parent_phenotype.last_inst_count;
-  last_from_sensor_count    = parent_phenotype.last_from_sensor_count;
   last_group_attack_count    = parent_phenotype.last_group_attack_count;
   last_top_pred_group_attack_count    = parent_phenotype.last_top_pred_group_attack_count;
   last_killed_targets       = parent_phenotype.last_killed_targets;
   last_attacks              = parent_phenotype.last_attacks;
   last_kills                = parent_phenotype.last_kills;
-  last_sense_count          = parent_phenotype.last_sense_count;
   last_fitness              = CalcFitness(last_merit_base, last_bonus, gestation_time, last_cpu_cycles_used);
   last_child_germline_propensity = parent_phenotype.last_child_germline_propensity;   // chance of child being a germline cell; @JEB
-  
-  last_from_message_count    = parent_phenotype.last_from_message_count;
 
   // Setup other miscellaneous values...
   num_divides     = 0;
@@ -618,14 +753,7 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   cur_energy_bonus = 0.0;
   cur_num_errors  = 0;
   cur_num_donates  = 0;
-  cur_task_count.SetAll(0);
-  cur_para_tasks.SetAll(0);
-  cur_host_tasks.SetAll(0);
-  cur_internal_task_count.SetAll(0);
-  eff_task_count.SetAll(0);
-  cur_task_quality.SetAll(0);
-  cur_task_value.SetAll(0);
-  cur_internal_task_quality.SetAll(0);
+  resetCurCounters(true);
   cur_rbins_total.SetAll(0);
   if (m_world->GetConfig().RESOURCE_GIVEN_ON_INJECT.Get() > 0.0) {   
     const int resource = m_world->GetConfig().COLLECT_SPECIFIC_RESOURCE.Get();
@@ -633,14 +761,6 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   }
   else cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
-  cur_reaction_count.SetAll(0);
-  first_reaction_cycles.SetAll(-1);
-  first_reaction_execs.SetAll(-1);
-  cur_stolen_reaction_count.SetAll(0);
-  cur_reaction_add_reward.SetAll(0);
-  cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
-  cur_from_message_count.SetAll(0);
   for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
     cur_group_attack_count[r].SetAll(0);
     cur_top_pred_group_attack_count[r].SetAll(0);
@@ -649,7 +769,6 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   cur_attacks = 0;
   cur_kills = 0;
   sensed_resources.SetAll(0);
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
   cur_trial_fitnesses.Resize(0);
   cur_trial_bonuses.Resize(0); 
@@ -670,21 +789,10 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   last_cpu_cycles_used = 0;
   last_num_errors = 0;
   last_num_donates = 0;
-  last_task_count.SetAll(0);
-  last_host_tasks.SetAll(0);
-  last_para_tasks.SetAll(0);
-  last_internal_task_count.SetAll(0);
-  last_task_quality.SetAll(0);
-  last_task_value.SetAll(0);
-  last_internal_task_quality.SetAll(0);
+  clearLastCounters();
   last_rbins_total.SetAll(0);
   last_rbins_avail.SetAll(0);
   last_collect_spec_counts.SetAll(0);
-  last_reaction_count.SetAll(0);
-  last_reaction_add_reward.SetAll(0);
-  last_inst_count.SetAll(0);
-  last_from_sensor_count.SetAll(0);
-  last_from_message_count.SetAll(0);
   for (int r = 0; r < last_group_attack_count.GetSize(); r++) {
     last_group_attack_count[r].SetAll(0);
     last_top_pred_group_attack_count[r].SetAll(0);
@@ -692,7 +800,6 @@ void cPhenotype::SetupInject(const InstructionSequence& _genome)
   last_killed_targets.SetAll(0);
   last_attacks = 0;
   last_kills = 0;
-  last_sense_count.SetAll(0);
   last_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
   
   // Setup other miscellaneous values...
@@ -861,27 +968,15 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   //TODO?  last_energy         = cur_energy_bonus;
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
-  last_task_count           = cur_task_count;
-  last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
-  last_internal_task_count  = cur_internal_task_count;
-  last_task_quality         = cur_task_quality;
-  last_task_value           = cur_task_value;
-  last_internal_task_quality= cur_internal_task_quality;
+  lockInCurCounters();
   last_rbins_total          = cur_rbins_total;
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
-  last_reaction_count       = cur_reaction_count;
-  last_reaction_add_reward  = cur_reaction_add_reward;
-  last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
-  last_from_message_count    = cur_from_message_count;
   last_group_attack_count   = cur_group_attack_count;
   last_killed_targets       = cur_killed_targets;
   last_attacks              = cur_attacks;
   last_kills                = cur_kills;
   last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   last_child_germline_propensity = cur_child_germline_propensity;
   
   last_mating_display_a = cur_mating_display_a; //@CHC
@@ -893,23 +988,13 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   cur_energy_bonus = 0.0;
   cur_num_errors  = 0;
   cur_num_donates  = 0;
-  cur_task_count.SetAll(0);
-  cur_host_tasks.SetAll(0);
   
   cur_mating_display_a = 0; //@CHC
   cur_mating_display_b = 0;
   
   // @LZ: figure out when and where to reset cur_para_tasks, depending on the divide method, and
   //      resonable assumptions
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {     
-    last_para_tasks = cur_para_tasks;
-    cur_para_tasks.SetAll(0);
-  }
-  cur_internal_task_count.SetAll(0);
-  eff_task_count.SetAll(0);
-  cur_task_quality.SetAll(0);
-  cur_task_value.SetAll(0);
-  cur_internal_task_quality.SetAll(0);
+  resetCurCounters(m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT);
   if (m_world->GetConfig().SPLIT_ON_DIVIDE.Get()) {
     // resources available are split in half -- the offspring gets the other half
     for (int i = 0; i < cur_rbins_avail.GetSize(); i++) {cur_rbins_avail[i] /= 2.0;}
@@ -923,14 +1008,6 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
     }
   }
   cur_collect_spec_counts.SetAll(0);
-  cur_reaction_count.SetAll(0);
-  first_reaction_cycles.SetAll(-1);
-  first_reaction_execs.SetAll(-1);
-  cur_stolen_reaction_count.SetAll(0);
-  cur_reaction_add_reward.SetAll(0);
-  cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
-  cur_from_message_count.SetAll(0);
   for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
     cur_group_attack_count[r].SetAll(0);
     cur_top_pred_group_attack_count[r].SetAll(0);
@@ -938,7 +1015,6 @@ void cPhenotype::DivideReset(const InstructionSequence& _genome)
   cur_killed_targets.SetAll(0);
   cur_attacks = 0;
   cur_kills = 0;
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
   cur_child_germline_propensity = m_world->GetConfig().DEMES_DEFAULT_GERMLINE_PROPENSITY.Get();
   
@@ -1094,27 +1170,15 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   last_cpu_cycles_used      = cpu_cycles_used;
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
-  last_task_count           = cur_task_count;
-  last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
-  last_internal_task_count  = cur_internal_task_count;
-  last_task_quality         = cur_task_quality;
-  last_task_value			= cur_task_value;
-  last_internal_task_quality= cur_internal_task_quality;
+  lockInCurCounters();
   last_rbins_total          = cur_rbins_total;
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
-  last_reaction_count       = cur_reaction_count;
-  last_reaction_add_reward  = cur_reaction_add_reward;
-  last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
-  last_from_message_count    = cur_from_message_count;
   last_group_attack_count   = cur_group_attack_count;
   last_killed_targets       = cur_killed_targets;
   last_attacks              = cur_attacks;
   last_kills                = cur_kills;
   last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   last_child_germline_propensity = cur_child_germline_propensity;
   
   // Reset cur values.
@@ -1122,19 +1186,9 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   cpu_cycles_used = 0;
   cur_num_errors  = 0;
   cur_num_donates  = 0;
-  cur_task_count.SetAll(0);
-  cur_host_tasks.SetAll(0);
   // @LZ: figure out when and where to reset cur_para_tasks, depending on the divide method, and
   //      resonable assumptions
-  if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {
-    last_para_tasks = cur_para_tasks;
-    cur_para_tasks.SetAll(0);
-  }
-  cur_internal_task_count.SetAll(0);
-  eff_task_count.SetAll(0);
-  cur_task_quality.SetAll(0);
-  cur_task_value.SetAll(0);
-  cur_internal_task_quality.SetAll(0);
+  resetCurCounters(m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT);
   cur_rbins_total.SetAll(0);  // total resources collected in lifetime
   if (m_world->GetConfig().RESOURCE_GIVEN_ON_INJECT.Get() > 0.0) {   
     const int resource = m_world->GetConfig().COLLECT_SPECIFIC_RESOURCE.Get();
@@ -1142,14 +1196,6 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   }
   else cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
-  cur_reaction_count.SetAll(0);
-  first_reaction_cycles.SetAll(-1);
-  first_reaction_execs.SetAll(-1);
-  cur_stolen_reaction_count.SetAll(0);
-  cur_reaction_add_reward.SetAll(0);
-  cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
-  cur_from_message_count.SetAll(0);
   for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
     cur_group_attack_count[r].SetAll(0);
     cur_top_pred_group_attack_count[r].SetAll(0);
@@ -1157,7 +1203,6 @@ void cPhenotype::TestDivideReset(const InstructionSequence& _genome)
   cur_killed_targets.SetAll(0);
   cur_attacks = 0;
   cur_kills = 0;
-  cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
   sensed_resources.SetAll(-1.0);
   cur_trial_fitnesses.Resize(0); 
@@ -1330,9 +1375,7 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   cur_kills = 0;
   cur_sense_count.SetAll(0);
   cur_task_time.SetAll(0.0);
-  for (int j = 0; j < sensed_resources.GetSize(); j++) {
-    sensed_resources[j] = clone_phenotype.sensed_resources[j];
-  }
+  copyPrefix(sensed_resources, clone_phenotype.sensed_resources);
   cur_trial_fitnesses.Resize(0); 
   cur_trial_bonuses.Resize(0); 
   cur_trial_times_used.Resize(0); 
@@ -1352,24 +1395,24 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   last_cpu_cycles_used     = clone_phenotype.last_cpu_cycles_used;
   last_num_errors          = clone_phenotype.last_num_errors;
   last_num_donates         = clone_phenotype.last_num_donates;
-  last_task_count          = clone_phenotype.last_task_count;
-  last_host_tasks          = clone_phenotype.last_host_tasks;
-  last_para_tasks          = clone_phenotype.last_para_tasks;
-  last_internal_task_count = clone_phenotype.last_internal_task_count;
+  copyPrefix(last_task_count, clone_phenotype.last_task_count);
+  copyPrefix(last_host_tasks, clone_phenotype.last_host_tasks);
+  copyPrefix(last_para_tasks, clone_phenotype.last_para_tasks);
+  copyPrefix(last_internal_task_count, clone_phenotype.last_internal_task_count);
   last_rbins_total         = clone_phenotype.last_rbins_total;
   last_rbins_avail         = clone_phenotype.last_rbins_avail;
   last_collect_spec_counts = clone_phenotype.last_collect_spec_counts;
-  last_reaction_count      = clone_phenotype.last_reaction_count;
-  last_reaction_add_reward = clone_phenotype.last_reaction_add_reward;
-  last_inst_count          = clone_phenotype.last_inst_count;
-  last_from_sensor_count   = clone_phenotype.last_from_sensor_count;
-  last_from_message_count   = clone_phenotype.last_from_message_count;
+  copyPrefix(last_reaction_count, clone_phenotype.last_reaction_count);
+  copyPrefix(last_reaction_add_reward, clone_phenotype.last_reaction_add_reward);
+  copyPrefix(last_inst_count, clone_phenotype.last_inst_count);
+  copyPrefix(last_from_sensor_count, clone_phenotype.last_from_sensor_count);
+  copyPrefix(last_from_message_count, clone_phenotype.last_from_message_count);
   last_group_attack_count   = clone_phenotype.last_group_attack_count;
   last_top_pred_group_attack_count   = clone_phenotype.last_top_pred_group_attack_count;
   last_killed_targets      = clone_phenotype.last_killed_targets;
   last_attacks             = clone_phenotype.last_attacks;
   last_kills                = clone_phenotype.last_kills;
-  last_sense_count         = clone_phenotype.last_sense_count;
+  copyPrefix(last_sense_count, clone_phenotype.last_sense_count);
   last_fitness             = CalcFitness(last_merit_base, last_bonus, gestation_time, last_cpu_cycles_used);
   last_child_germline_propensity = clone_phenotype.last_child_germline_propensity;
   
@@ -1491,7 +1534,7 @@ bool cPhenotype::TestInput(tBuffer<int>&, tBuffer<int>&)
 }
 
 bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                            const Apto::Array<double>& res_in, const Apto::Array<double>& rbins_in,
+                            const cResourceView& res_in, const Apto::Array<double>& rbins_in,
                             Apto::Array<double>& res_change, Apto::Array<cString>& insts_triggered,
                             bool is_parasite, cContextPhenotype* context_phenotype)
 {
@@ -1508,6 +1551,9 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
   const double task_refractory_period = m_world->GetConfig().TASK_REFRACTORY_PERIOD.Get();
   double refract_factor;
   
+  // Genome test workers run concurrently with the main thread, which owns the shared stats
+  cStats* stats = (ctx.GetWorkerMode()) ? NULL : &m_world->GetStats();
+  
   if (!m_reaction_result) m_reaction_result = new cReactionResult(num_resources, num_tasks, num_reactions);
   cReactionResult& result = *m_reaction_result;
   
@@ -1554,8 +1600,8 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
       if (result.UsedEnvResource() == false) { cur_internal_task_count[i]++; }
       
       // if we want to generate an age-task histogram
-      if (m_world->GetConfig().AGE_POLY_TRACKING.Get()) {
-        m_world->GetStats().AgeTaskEvent(taskctx.GetOrganism()->GetID(), i, time_used);
+      if (stats && m_world->GetConfig().AGE_POLY_TRACKING.Get()) {
+        stats->AgeTaskEvent(taskctx.GetOrganism()->GetID(), i, time_used);
       }
     }
     
@@ -1571,22 +1617,22 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
   }
 
   for (int i = 0; i < num_tasks; i++) {
-    if (result.TaskDone(i) && !last_task_count[i]) {
-      m_world->GetStats().AddNewTaskCount(i);
+    if (stats && result.TaskDone(i) && !last_task_count[i]) {
+      stats->AddNewTaskCount(i);
       int prev_num_tasks = 0;
       int cur_num_tasks = 0;
       for (int j=0; j< num_tasks; j++) {
         if (last_task_count[j]>0) prev_num_tasks++;
         if (cur_task_count[j]>0) cur_num_tasks++;
       }
-      m_world->GetStats().AddOtherTaskCounts(i, prev_num_tasks, cur_num_tasks);
+      stats->AddOtherTaskCounts(i, prev_num_tasks, cur_num_tasks);
     }
   }
   
   for (int i = 0; i < num_reactions; i++) {
     cur_reaction_add_reward[i] += result.GetReactionAddBonus(i);
-    if (result.ReactionTriggered(i) && last_reaction_count[i]==0) {
-      m_world->GetStats().AddNewReactionCount(i);
+    if (stats && result.ReactionTriggered(i) && last_reaction_count[i]==0) {
+      stats->AddNewReactionCount(i);
     }
     if (result.ReactionTriggered(i) == true) {
       if (context_phenotype != 0) {
@@ -1614,7 +1660,7 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
             // track time used if applicable
             int cur_time_used = time_used - last_task_time; 
             last_task_time = time_used;
-            m_world->GetStats().AddTaskSwitchTime(last_task_id, i, cur_time_used);
+            if (stats) stats->AddTaskSwitchTime(last_task_id, i, cur_time_used);
             if (last_task_id != i) {
               num_new_unique_reactions++;
               last_task_id = i;
@@ -1998,14 +2044,14 @@ void cPhenotype::DivideFailed() {
 /**
  Credit organism with energy reward, but only update energy store if APPLY_ENERGY_METHOD = "on task completion" (1)
  */
-void cPhenotype::RefreshEnergy() {
+void cPhenotype::RefreshEnergy(cAvidaContext& ctx) {
   if(cur_energy_bonus > 0) {
     if(m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 0 || // on divide
        m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 2) {  // on sleep
       energy_tobe_applied += cur_energy_bonus;
     } else if(m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 1) {
       SetEnergy(energy_store + cur_energy_bonus);
-      m_world->GetStats().SumEnergyTestamentAcceptedByOrganisms().Add(energy_testament);
+      if (!ctx.GetWorkerMode()) m_world->GetStats().SumEnergyTestamentAcceptedByOrganisms().Add(energy_testament);
       energy_testament = 0.0;
     } else {
       cerr<< "Unknown APPLY_ENERGY_METHOD value " << m_world->GetConfig().APPLY_ENERGY_METHOD.Get();
@@ -2015,9 +2061,9 @@ void cPhenotype::RefreshEnergy() {
   }
 }
 
-void cPhenotype::ApplyToEnergyStore() {
+void cPhenotype::ApplyToEnergyStore(cAvidaContext& ctx) {
   SetEnergy(energy_store + energy_tobe_applied);
-  m_world->GetStats().SumEnergyTestamentAcceptedByOrganisms().Add(energy_testament);
+  if (!ctx.GetWorkerMode()) m_world->GetStats().SumEnergyTestamentAcceptedByOrganisms().Add(energy_testament);
   energy_testament = 0.0;
   energy_tobe_applied = 0.0;
   energy_testament = 0.0;
@@ -2066,10 +2112,10 @@ double cPhenotype::ExtractParentEnergy() {
   double frac_energy_decay_at_birth = m_world->GetConfig().FRAC_ENERGY_DECAY_AT_ORG_BIRTH.Get();
   double energy_cap = m_world->GetConfig().ENERGY_CAP.Get();
   
-  // apply energy if APPLY_ENERGY_METHOD is set to "on divide" (0)
+  // apply energy if APPLY_ENERGY_METHOD is set to "on divide" (0); births only happen on the main thread
   if(m_world->GetConfig().APPLY_ENERGY_METHOD.Get() == 0) {
-    RefreshEnergy();
-    ApplyToEnergyStore();
+    RefreshEnergy(m_world->GetDefaultContext());
+    ApplyToEnergyStore(m_world->GetDefaultContext());
   }
   
   // decay of energy in parent
@@ -2145,27 +2191,15 @@ void cPhenotype::NewTrial()
   //TODO?  last_energy         = cur_energy_bonus;
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
-  last_task_count           = cur_task_count;
-  last_host_tasks           = cur_host_tasks;
-  last_para_tasks           = cur_para_tasks;
-  last_internal_task_count  = cur_internal_task_count;
-  last_task_quality         = cur_task_quality;
-  last_internal_task_quality= cur_internal_task_quality;
-  last_task_value			      = cur_task_value;
+  lockInCurCounters();
   last_rbins_total          = cur_rbins_total;
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
-  last_reaction_count       = cur_reaction_count;
-  last_reaction_add_reward  = cur_reaction_add_reward;
-  last_inst_count           = cur_inst_count;
-  last_from_sensor_count    = cur_from_sensor_count;
-  last_from_message_count    = cur_from_message_count;
   last_group_attack_count   = cur_group_attack_count;
   last_killed_targets       = cur_killed_targets;
   last_attacks              = cur_attacks;
   last_kills                = cur_kills;
   last_top_pred_group_attack_count    = cur_top_pred_group_attack_count;
-  last_sense_count          = cur_sense_count;
   
   // Reset cur values.
   cur_bonus       = m_world->GetConfig().DEFAULT_BONUS.Get();
@@ -2173,25 +2207,10 @@ void cPhenotype::NewTrial()
   cur_energy_bonus = 0.0;
   cur_num_errors  = 0;
   cur_num_donates  = 0;
-  cur_task_count.SetAll(0);
-  cur_host_tasks.SetAll(0);
-  cur_para_tasks.SetAll(0);
-  cur_internal_task_count.SetAll(0);
-  eff_task_count.SetAll(0);
-  cur_task_quality.SetAll(0);
-  cur_internal_task_quality.SetAll(0);
-  cur_task_value.SetAll(0);
+  resetCurCounters(true);
   cur_rbins_total.SetAll(0);
   cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
-  cur_reaction_count.SetAll(0);
-  first_reaction_cycles.SetAll(-1);
-  first_reaction_execs.SetAll(-1);
-  cur_stolen_reaction_count.SetAll(0);
-  cur_reaction_add_reward.SetAll(0);
-  cur_inst_count.SetAll(0);
-  cur_from_sensor_count.SetAll(0);
-  cur_from_message_count.SetAll(0);
   for (int r = 0; r < cur_group_attack_count.GetSize(); r++) {
     cur_group_attack_count[r].SetAll(0);
     cur_top_pred_group_attack_count[r].SetAll(0);
@@ -2199,7 +2218,6 @@ void cPhenotype::NewTrial()
   cur_killed_targets.SetAll(0);
   cur_attacks = 0;
   cur_kills = 0;
-  cur_sense_count.SetAll(0);
   //cur_trial_fitnesses.Resize(0); Don't throw out the trial fitnesses! @JEB
   trial_time_used = 0;
   trial_cpu_cycles_used = 0;
@@ -2420,14 +2438,11 @@ double cPhenotype::GetResourcesConsumed()
 }
 
 //Deep copy parasite task count
-void cPhenotype::SetLastParasiteTaskCount(Apto::Array<int> oldParaPhenotype)
+void cPhenotype::SetLastParasiteTaskCount(const tArraySlice<int>& oldParaPhenotype)
 {
   assert(initialized == true);
   
-  for(int i=0;i<oldParaPhenotype.GetSize();i++)
-  {
-    last_para_tasks[i] = oldParaPhenotype[i];
-  }
+  copyPrefix(last_para_tasks, oldParaPhenotype);
 }
 
 /* Return the cumulative reaction count if we aren't resetting on divide. */
@@ -28,9 +28,11 @@
 #include <fstream>
 
 #include "cMerit.h"
+#include "cResourceView.h"
 #include "cString.h"
 #include "cCodeLabel.h"
 #include "cWorld.h"
+#include "tArraySlice.h"
 
 
 /*************************************************************************
@@ -79,6 +81,40 @@ private:
   cWorld* m_world;
   bool initialized;
 
+  // The per-task, per-reaction, per-sense and per-instruction counters below are slices of one slab, allocated when
+  // the phenotype is built.  The "cur" and "last" counter blocks share a single layout, so locking in the current
+  // values at a divide is one memcpy and clearing them is one memset.  See cPhenotype.cc for the arrangement.
+  struct sCounterLayout
+  {
+    int num_tasks;
+    int num_reactions;
+    int num_resources;
+    int num_senses;
+    int inst_capacity;  // Room for each instruction counter; an organism uses as much as its instruction set needs
+
+    sCounterLayout() : num_tasks(0), num_reactions(0), num_resources(0), num_senses(0), inst_capacity(0) { ; }
+
+    bool operator==(const sCounterLayout& rhs) const
+    {
+      return num_tasks == rhs.num_tasks && num_reactions == rhs.num_reactions && num_resources == rhs.num_resources &&
+        num_senses == rhs.num_senses && inst_capacity == rhs.inst_capacity;
+    }
+    bool operator!=(const sCounterLayout& rhs) const { return !operator==(rhs); }
+
+    int BlockDoubles() const { return 3 * num_tasks + num_reactions; }
+    int BlockInts() const { return 4 * num_tasks + num_reactions + 3 * inst_capacity + num_senses; }
+    int BlockSize() const { return BlockDoubles() + intsToDoubles(BlockInts()); }
+    int ExtraDoubles() const { return num_tasks + num_resources; }
+    int ExtraInts() const { return num_tasks + 3 * num_reactions; }
+    int SlabSize() const { return 2 * BlockSize() + ExtraDoubles() + intsToDoubles(ExtraInts()); }
+
+  private:
+    static int intsToDoubles(int n) { return int((n * sizeof(int) + sizeof(double) - 1) / sizeof(double)); }
+  };
+  sCounterLayout m_counter_layout;
+  double* m_counter_slab;
+  int m_inst_set_size;
+
   // 1. These are values calculated at the last divide (of self or offspring)
   cMerit merit;             // Relative speed of CPU
   double executionRatio;    //  ratio of current execution merit over base execution merit
@@ -109,38 +145,38 @@ private:
   int cur_num_errors;                         // Total instructions executed illeagally.
   int cur_num_donates;                        // Number of donations so far
 
-  Apto::Array<int> cur_task_count;                 // Total times each task was performed
-  Apto::Array<int> cur_para_tasks;                 // Total times each task was performed by the parasite @LZ
-  Apto::Array<int> cur_host_tasks;                 // Total times each task was done by JUST the host @LZ
-  Apto::Array<int> cur_internal_task_count;        // Total times each task was performed using internal resources
-  Apto::Array<int> eff_task_count;                 // Total times each task was performed (resetable during the life of the organism)
-  Apto::Array<double> cur_task_quality;            // Average (total?) quality with which each task was performed
-  Apto::Array<double> cur_task_value;              // Value with which this phenotype performs task
-  Apto::Array<double> cur_internal_task_quality;   // Average (total?) quaility with which each task using internal resources was performed
+  tArraySlice<int> cur_task_count;                 // Total times each task was performed
+  tArraySlice<int> cur_para_tasks;                 // Total times each task was performed by the parasite @LZ
+  tArraySlice<int> cur_host_tasks;                 // Total times each task was done by JUST the host @LZ
+  tArraySlice<int> cur_internal_task_count;        // Total times each task was performed using internal resources
+  tArraySlice<int> eff_task_count;                 // Total times each task was performed (resetable during the life of the organism)
+  tArraySlice<double> cur_task_quality;            // Average (total?) quality with which each task was performed
+  tArraySlice<double> cur_task_value;              // Value with which this phenotype performs task
+  tArraySlice<double> cur_internal_task_quality;   // Average (total?) quaility with which each task using internal resources was performed
   Apto::Array<double> cur_rbins_total;             // Total amount of resources collected over the organism's life
   Apto::Array<double> cur_rbins_avail;             // Amount of internal resources available
   Apto::Array<int> cur_collect_spec_counts;        // How many times each nop-specification was used in a collect-type instruction
-  Apto::Array<int> cur_reaction_count;             // Total times each reaction was triggered.
-  Apto::Array<int> first_reaction_cycles;          // CPU cycles of first time reaction was triggered.
-  Apto::Array<int> first_reaction_execs;            // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).
-  Apto::Array<int> cur_stolen_reaction_count;      // Total counts of reactions stolen by predators.
-  Apto::Array<double> cur_reaction_add_reward;     // Bonus change from triggering each reaction.
-  Apto::Array<int> cur_inst_count;                 // Instruction exection counter
-  Apto::Array<int> cur_from_sensor_count;           // Use of inputs that originated from sensory data were used in execution of this instruction.
+  tArraySlice<int> cur_reaction_count;             // Total times each reaction was triggered.
+  tArraySlice<int> first_reaction_cycles;          // CPU cycles of first time reaction was triggered.
+  tArraySlice<int> first_reaction_execs;            // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).
+  tArraySlice<int> cur_stolen_reaction_count;      // Total counts of reactions stolen by predators.
+  tArraySlice<double> cur_reaction_add_reward;     // Bonus change from triggering each reaction.
+  tArraySlice<int> cur_inst_count;                 // Instruction exection counter
+  tArraySlice<int> cur_from_sensor_count;           // Use of inputs that originated from sensory data were used in execution of this instruction.
   Apto::Array< Apto::Array<int> > cur_group_attack_count;
   Apto::Array< Apto::Array<int> > cur_top_pred_group_attack_count;
   Apto::Array<int> cur_killed_targets;
   int cur_attacks;
   int cur_kills;
   
-  Apto::Array<int> cur_sense_count;                // Total times resource combinations have been sensed; @JEB
-  Apto::Array<double> sensed_resources;            // Resources which the organism has sensed; @JEB
-  Apto::Array<double> cur_task_time;               // Time at which each task was last performed; WRE 03-18-07
+  tArraySlice<int> cur_sense_count;                // Total times resource combinations have been sensed; @JEB
+  tArraySlice<double> sensed_resources;            // Resources which the organism has sensed; @JEB
+  tArraySlice<double> cur_task_time;               // Time at which each task was last performed; WRE 03-18-07
   Apto::Map<void*, cTaskState*> m_task_states;
   Apto::Array<double> cur_trial_fitnesses;         // Fitnesses of various trials.; @JEB
   Apto::Array<double> cur_trial_bonuses;           // Bonuses of various trials.; @JEB
   Apto::Array<int> cur_trial_times_used;           // Time used in of various trials.; @JEB
-  Apto::Array<int> cur_from_message_count;           // Use of inputs that originated from messages were used in execution of this instruction.
+  tArraySlice<int> cur_from_message_count;           // Use of inputs that originated from messages were used in execution of this instruction.
 
   int trial_time_used;                        // like time_used, but reset every trial; @JEB
   int trial_cpu_cycles_used;                  // like cpu_cycles_used, but reset every trial; @JEB
@@ -167,28 +203,28 @@ private:
   int last_num_errors;
   int last_num_donates;
 
-  Apto::Array<int> last_task_count;
-  Apto::Array<int> last_para_tasks;
-  Apto::Array<int> last_host_tasks;                // Last task counts from hosts only, before last divide @LZ
-  Apto::Array<int> last_internal_task_count;
-  Apto::Array<double> last_task_quality;
-  Apto::Array<double> last_task_value;
-  Apto::Array<double> last_internal_task_quality;
+  tArraySlice<int> last_task_count;
+  tArraySlice<int> last_para_tasks;
+  tArraySlice<int> last_host_tasks;                // Last task counts from hosts only, before last divide @LZ
+  tArraySlice<int> last_internal_task_count;
+  tArraySlice<double> last_task_quality;
+  tArraySlice<double> last_task_value;
+  tArraySlice<double> last_internal_task_quality;
   Apto::Array<double> last_rbins_total;
   Apto::Array<double> last_rbins_avail;
   Apto::Array<int> last_collect_spec_counts;
-  Apto::Array<int> last_reaction_count;
-  Apto::Array<double> last_reaction_add_reward;
-  Apto::Array<int> last_inst_count;	  // Instruction exection counter
-  Apto::Array<int> last_from_sensor_count;
-  Apto::Array<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB
+  tArraySlice<int> last_reaction_count;
+  tArraySlice<double> last_reaction_add_reward;
+  tArraySlice<int> last_inst_count;	  // Instruction exection counter
+  tArraySlice<int> last_from_sensor_count;
+  tArraySlice<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB
   Apto::Array< Apto::Array<int> > last_group_attack_count;
   Apto::Array< Apto::Array<int> > last_top_pred_group_attack_count;
   Apto::Array<int> last_killed_targets;
   int last_attacks;
   int last_kills;
 
-  Apto::Array<int> last_from_message_count;
+  tArraySlice<int> last_from_message_count;
 
   double last_fitness;            // Used to determine sterilization.
   int last_cpu_cycles_used;
@@ -311,11 +347,21 @@ private:
   double permanent_germline_propensity;
   
 
-  inline void SetInstSetSize(int inst_set_size);
+  void SetInstSetSize(int inst_set_size);
   inline void SetGroupAttackInstSetSize(int num_group_attack_inst);
+
+  static sCounterLayout counterLayout(cWorld* world);
+  void allocateCounters(const sCounterLayout& layout);
+  void bindCounters();
+  double* counterBlock(int block) { return m_counter_slab + block * m_counter_layout.BlockSize(); }
+  const double* counterBlock(int block) const { return m_counter_slab + block * m_counter_layout.BlockSize(); }
+  void lockInCurCounters();
+  void resetCurCounters(bool reset_para_tasks);
+  void clearLastCounters();
+  void copyLastCounters(const cPhenotype& src);
   
 public:
-  cPhenotype() : m_world(NULL), m_reaction_result(NULL) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme Apto::Array usage.
+  cPhenotype() : m_world(NULL), m_counter_slab(NULL), m_inst_set_size(0), m_reaction_result(NULL) { ; } // Will not construct a valid cPhenotype! Only exists to support incorrect cDeme Apto::Array usage.
   cPhenotype(cWorld* world, int parent_generation, int num_nops);
 
 
@@ -346,7 +392,7 @@ public:
   // Input and Output Reaction Tests
   bool TestInput(tBuffer<int>& inputs, tBuffer<int>& outputs);
   bool TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
-                  const Apto::Array<double>& res_in, const Apto::Array<double>& rbins_in, Apto::Array<double>& res_change,
+                  const cResourceView& res_in, const Apto::Array<double>& rbins_in, Apto::Array<double>& res_change,
                   Apto::Array<cString>& insts_triggered, bool is_parasite=false, cContextPhenotype* context_phenotype = 0);
 
   // State saving and loading, and printing...
@@ -422,29 +468,29 @@ public:
   int GetCurNumErrors() const { assert(initialized == true); return cur_num_errors; }
   int GetCurNumDonates() const { assert(initialized == true); return cur_num_donates; }
   int GetCurCountForTask(int idx) const { assert(initialized == true); return cur_task_count[idx]; }
-  const Apto::Array<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
-  const Apto::Array<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
-  const Apto::Array<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
-  const Apto::Array<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
+  const tArraySlice<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
+  const tArraySlice<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
+  const tArraySlice<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
+  const tArraySlice<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
   void ClearEffTaskCount() { assert(initialized == true); eff_task_count.SetAll(0); }
-  const Apto::Array<double> & GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
-  const Apto::Array<double> & GetCurTaskValue() const { assert(initialized == true); return cur_task_value; }
-  const Apto::Array<double> & GetCurInternalTaskQuality() const { assert(initialized == true); return cur_internal_task_quality; }
+  const tArraySlice<double>& GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
+  const tArraySlice<double>& GetCurTaskValue() const { assert(initialized == true); return cur_task_value; }
+  const tArraySlice<double>& GetCurInternalTaskQuality() const { assert(initialized == true); return cur_internal_task_quality; }
   const Apto::Array<double>& GetCurRBinsTotal() const { assert(initialized == true); return cur_rbins_total; }
   double GetCurRBinTotal(int index) const { assert(initialized == true); return cur_rbins_total[index]; }
   const Apto::Array<double>& GetCurRBinsAvail() const { assert(initialized == true); return cur_rbins_avail; }
   double GetCurRBinAvail(int index) const { assert(initialized == true); return cur_rbins_avail[index]; }
 
-  const Apto::Array<int>& GetCurReactionCount() const { assert(initialized == true); return cur_reaction_count;}
-  const Apto::Array<int>& GetFirstReactionCycles() const { assert(initialized == true); return first_reaction_cycles;}
+  const tArraySlice<int>& GetCurReactionCount() const { assert(initialized == true); return cur_reaction_count; }
+  const tArraySlice<int>& GetFirstReactionCycles() const { assert(initialized == true); return first_reaction_cycles; }
   void SetFirstReactionCycle(int idx) { if (first_reaction_cycles[idx] < 0) first_reaction_cycles[idx] = time_used; }
-  const Apto::Array<int>& GetFirstReactionExecs() const { assert(initialized == true); return first_reaction_execs;}
+  const tArraySlice<int>& GetFirstReactionExecs() const { assert(initialized == true); return first_reaction_execs; }
   void SetFirstReactionExec(int idx) { if (first_reaction_execs[idx] < 0) first_reaction_execs[idx] = num_execs; }
 
-  const Apto::Array<int>& GetStolenReactionCount() const { assert(initialized == true); return cur_stolen_reaction_count;}
-  const Apto::Array<double>& GetCurReactionAddReward() const { assert(initialized == true); return cur_reaction_add_reward;}
-  const Apto::Array<int>& GetCurInstCount() const { assert(initialized == true); return cur_inst_count; }
-  const Apto::Array<int>& GetCurSenseCount() const { assert(initialized == true); return cur_sense_count; }
+  const tArraySlice<int>& GetStolenReactionCount() const { assert(initialized == true); return cur_stolen_reaction_count; }
+  const tArraySlice<double>& GetCurReactionAddReward() const { assert(initialized == true); return cur_reaction_add_reward; }
+  const tArraySlice<int>& GetCurInstCount() const { assert(initialized == true); return cur_inst_count; }
+  const tArraySlice<int>& GetCurSenseCount() const { assert(initialized == true); return cur_sense_count; }
 
   double GetSensedResource(int _in) { assert(initialized == true); return sensed_resources[_in]; }
   const Apto::Array<int>& GetCurCollectSpecCounts() const { assert(initialized == true); return cur_collect_spec_counts; }
@@ -473,26 +519,26 @@ public:
   int GetLastNumDonates() const { assert(initialized == true); return last_num_donates; }
 
   int GetLastCountForTask(int idx) const { assert(initialized == true); return last_task_count[idx]; }
-  const Apto::Array<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
-  void SetLastTaskCount(Apto::Array<int> tasks) { assert(initialized == true); last_task_count = tasks; }
-  const Apto::Array<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
-  const Apto::Array<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
-  void  SetLastParasiteTaskCount(Apto::Array<int>  oldParaPhenotype);
-  const Apto::Array<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
-  const Apto::Array<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
-  const Apto::Array<double>& GetLastTaskValue() const { assert(initialized == true); return last_task_value; }
-  const Apto::Array<double>& GetLastInternalTaskQuality() const { assert(initialized == true); return last_internal_task_quality; }
+  const tArraySlice<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
+  void SetLastTaskCount(const tArraySlice<int>& tasks) { assert(initialized == true); last_task_count.CopyFrom(tasks); }
+  const tArraySlice<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
+  const tArraySlice<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
+  void  SetLastParasiteTaskCount(const tArraySlice<int>& oldParaPhenotype);
+  const tArraySlice<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
+  const tArraySlice<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
+  const tArraySlice<double>& GetLastTaskValue() const { assert(initialized == true); return last_task_value; }
+  const tArraySlice<double>& GetLastInternalTaskQuality() const { assert(initialized == true); return last_internal_task_quality; }
   const Apto::Array<double>& GetLastRBinsTotal() const { assert(initialized == true); return last_rbins_total; }
   const Apto::Array<double>& GetLastRBinsAvail() const { assert(initialized == true); return last_rbins_avail; }
-  const Apto::Array<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
-  const Apto::Array<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
-  const Apto::Array<int>& GetLastInstCount() const { assert(initialized == true); return last_inst_count; }
-  const Apto::Array<int>& GetLastFromSensorInstCount() const { assert(initialized == true); return last_from_sensor_count; }
-  const Apto::Array<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
+  const tArraySlice<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
+  const tArraySlice<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
+  const tArraySlice<int>& GetLastInstCount() const { assert(initialized == true); return last_inst_count; }
+  const tArraySlice<int>& GetLastFromSensorInstCount() const { assert(initialized == true); return last_from_sensor_count; }
+  const tArraySlice<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
   const Apto::Array< Apto::Array<int> >& GetLastGroupAttackInstCount() const { assert(initialized == true); return last_group_attack_count; }
   const Apto::Array< Apto::Array<int> >& GetLastTopPredGroupAttackInstCount() const { assert(initialized == true); return last_top_pred_group_attack_count; }
 
-  const Apto::Array<int>& GetLastFromMessageInstCount() const { assert(initialized == true); return last_from_message_count; }
+  const tArraySlice<int>& GetLastFromMessageInstCount() const { assert(initialized == true); return last_from_message_count; }
 
   double GetLastFitness() const { assert(initialized == true); return last_fitness; }
   double GetPermanentGermlinePropensity() const { assert(initialized == true); return permanent_germline_propensity; }
@@ -737,11 +783,11 @@ public:
 
   // @LZ - Parasite Etc. Helpers
   void DivideFailed();
-  void UpdateParasiteTasks() { last_para_tasks = cur_para_tasks; cur_para_tasks.SetAll(0); return; }
+  void UpdateParasiteTasks() { last_para_tasks.CopyFrom(cur_para_tasks); cur_para_tasks.SetAll(0); return; }
   
 
-  void RefreshEnergy();
-  void ApplyToEnergyStore();
+  void RefreshEnergy(cAvidaContext& ctx);
+  void ApplyToEnergyStore(cAvidaContext& ctx);
   void EnergyTestament(const double value); //! external energy given to organism
   void ApplyDonatedEnergy();
   void ReceiveDonatedEnergy(const double value);
@@ -757,16 +803,6 @@ public:
 };
 
 
-inline void cPhenotype::SetInstSetSize(int inst_set_size)
-{
-  cur_inst_count.Resize(inst_set_size, 0);
-  cur_from_sensor_count.Resize(inst_set_size, 0);
-  cur_from_message_count.Resize(inst_set_size, 0);
-  last_inst_count.Resize(inst_set_size, 0);
-  last_from_sensor_count.Resize(inst_set_size, 0);
-  last_from_message_count.Resize(inst_set_size, 0);
-}
-
 inline void cPhenotype::SetGroupAttackInstSetSize(int num_group_attack_inst)
 {
   last_group_attack_count.Resize(num_group_attack_inst);
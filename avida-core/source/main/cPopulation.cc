@@ -43,10 +43,12 @@
 #include "AvidaTools.h"
 
 #include "cAvidaContext.h"
+#include "cBatchedScheduler.h"
 #include "cCPUTestInfo.h"
 #include "cCodeLabel.h"
 #include "cDemePlaceholderUnit.h"
 #include "cEnvironment.h"
+#include "cGenomeTestService.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cInitFile.h"
@@ -61,6 +63,7 @@
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cTopology.h"
+#include "cUpdateWorkerPool.h"
 #include "cWorld.h"
 
 #include "cHardwareCPU.h"
@@ -84,11 +87,29 @@ static const PropertyID s_prop_id_instset("instset");
 cPopulationOrgStatProvider::~cPopulationOrgStatProvider() { ; }
 
 
+// The instruction count providers keep their counts by inst set id, resolving each organism's inst set by its hardware
+// rather than by looking up the genome's "instset" property string once per organism per update
+static int FindInstSetID(const cHardwareManager& hwm, const cInstSet& inst_set)
+{
+  for (int i = 0; i < hwm.GetNumInstSets(); i++) if (&hwm.GetInstSet(i) == &inst_set) return i;
+  assert(false);
+  return 0;
+}
+
+static int FindInstSetID(const cHardwareManager& hwm, const Apto::String& name)
+{
+  for (int i = 0; i < hwm.GetNumInstSets(); i++) {
+    if (Apto::String((const char*)hwm.GetInstSet(i).GetInstSetName()) == name) return i;
+  }
+  return -1;
+}
+
+
 class InstructionExecCountsProvider : public cPopulationOrgStatProvider
 {
 private:
   cWorld* m_world;
-  Apto::Map<Apto::String, Apto::Array<Apto::Stat::Accumulator<int> >, Apto::DefaultHashBTree, Apto::ImplicitDefault> m_is_exe_inst_map;
+  Apto::Array<Apto::Array<Apto::Stat::Accumulator<int> > > m_is_exe_counts;  // Indexed by hardware manager inst set
   Data::DataSetPtr m_provides;
 
 public:
@@ -97,9 +118,8 @@ public:
     m_provides->Insert(Apto::String("core.population.inst_exec_counts[]"));
 
     cHardwareManager& hwm = m_world->GetHardwareManager();
-    for (int i = 0; i < hwm.GetNumInstSets(); i++) {
-      m_is_exe_inst_map[Apto::String((const char*)hwm.GetInstSet(i).GetInstSetName())].Resize(hwm.GetInstSet(i).GetSize());
-    }
+    m_is_exe_counts.Resize(hwm.GetNumInstSets());
+    for (int i = 0; i < hwm.GetNumInstSets(); i++) m_is_exe_counts[i].Resize(hwm.GetInstSet(i).GetSize());
   }
   
   Data::ConstDataSetPtr Provides() const { return m_provides; }
@@ -137,7 +157,10 @@ public:
   {
     Apto::SmartPtr<Data::ArrayPackage, Apto::InternalRCObject> pkg(new Data::ArrayPackage);
     
-    const Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[arg];
+    const int inst_set_id = FindInstSetID(m_world->GetHardwareManager(), arg);
+    if (inst_set_id < 0) return pkg;
+    
+    const Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_counts[inst_set_id];
     for (int i = 0; i < inst_exe_counts.GetSize(); i++) {
       pkg->AddComponent(Data::PackagePtr(new Data::Wrap<int>(inst_exe_counts[i].Sum())));
     }
@@ -148,16 +171,16 @@ public:
   
   void UpdateReset()
   {
-    for (Apto::Map<Apto::String, Apto::Array<Apto::Stat::Accumulator<int> > >::ValueIterator it = m_is_exe_inst_map.Values(); it.Next();) {
-      Apto::Array<Apto::Stat::Accumulator<int> >& inst_counts = (*it.Get());
+    for (int is = 0; is < m_is_exe_counts.GetSize(); is++) {
+      Apto::Array<Apto::Stat::Accumulator<int> >& inst_counts = m_is_exe_counts[is];
       for (int i = 0; i < inst_counts.GetSize(); i++) inst_counts[i].Clear();
     }
   }
   
   void HandleOrganism(cOrganism* organism)
   {
-    Apto::String inst_set = organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue();
-    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[inst_set];
+    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts =
+      m_is_exe_counts[FindInstSetID(m_world->GetHardwareManager(), organism->GetHardware().GetInstSet())];
     for (int j = 0; j < organism->GetPhenotype().GetLastInstCount().GetSize(); j++) {
       inst_exe_counts[j].Add(organism->GetPhenotype().GetLastInstCount()[j]);
     }
@@ -176,7 +199,7 @@ class FromMessageInstructionExecCountsProvider : public cPopulationOrgStatProvid
 {
 private:
   cWorld* m_world;
-  Apto::Map<Apto::String, Apto::Array<Apto::Stat::Accumulator<int> >, Apto::DefaultHashBTree, Apto::ImplicitDefault> m_is_exe_inst_map;
+  Apto::Array<Apto::Array<Apto::Stat::Accumulator<int> > > m_is_exe_counts;  // Indexed by hardware manager inst set
   Data::DataSetPtr m_provides;
   
 public:
@@ -185,9 +208,8 @@ public:
     m_provides->Insert(Apto::String("core.population.from_message_inst_exec_counts[]"));
     
     cHardwareManager& hwm = m_world->GetHardwareManager();
-    for (int i = 0; i < hwm.GetNumInstSets(); i++) {
-      m_is_exe_inst_map[Apto::String((const char*)hwm.GetInstSet(i).GetInstSetName())].Resize(hwm.GetInstSet(i).GetSize());
-    }
+    m_is_exe_counts.Resize(hwm.GetNumInstSets());
+    for (int i = 0; i < hwm.GetNumInstSets(); i++) m_is_exe_counts[i].Resize(hwm.GetInstSet(i).GetSize());
   }
   
   Data::ConstDataSetPtr Provides() const { return m_provides; }
@@ -225,7 +247,10 @@ public:
   {
     Apto::SmartPtr<Data::ArrayPackage, Apto::InternalRCObject> pkg(new Data::ArrayPackage);
     
-    const Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[arg];
+    const int inst_set_id = FindInstSetID(m_world->GetHardwareManager(), arg);
+    if (inst_set_id < 0) return pkg;
+    
+    const Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_counts[inst_set_id];
     for (int i = 0; i < inst_exe_counts.GetSize(); i++) {
       pkg->AddComponent(Data::PackagePtr(new Data::Wrap<int>(inst_exe_counts[i].Sum())));
     }
@@ -236,16 +261,16 @@ public:
   
   void UpdateReset()
   {
-    for (Apto::Map<Apto::String, Apto::Array<Apto::Stat::Accumulator<int> > >::ValueIterator it = m_is_exe_inst_map.Values(); it.Next();) {
-      Apto::Array<Apto::Stat::Accumulator<int> >& inst_counts = (*it.Get());
+    for (int is = 0; is < m_is_exe_counts.GetSize(); is++) {
+      Apto::Array<Apto::Stat::Accumulator<int> >& inst_counts = m_is_exe_counts[is];
       for (int i = 0; i < inst_counts.GetSize(); i++) inst_counts[i].Clear();
     }
   }
   
   void HandleOrganism(cOrganism* organism)
   {
-    Apto::String inst_set = organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue();
-    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[inst_set];
+    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts =
+      m_is_exe_counts[FindInstSetID(m_world->GetHardwareManager(), organism->GetHardware().GetInstSet())];
     for (int j = 0; j < organism->GetPhenotype().GetLastFromMessageInstCount().GetSize(); j++) {
       inst_exe_counts[j].Add(organism->GetPhenotype().GetLastFromMessageInstCount()[j]);
     }
@@ -265,6 +290,10 @@ public:
 cPopulation::cPopulation(cWorld* world)  
 : m_world(world)
 , m_scheduler(NULL)
+, m_batched_scheduler(NULL)
+, m_update_workers(NULL)
+, m_resource_workers(NULL)
+, m_genome_tests(NULL)
 , birth_chamber(world)
 , print_mini_trace_genomes(false)
 , use_micro_traces(false)
@@ -275,6 +304,7 @@ cPopulation::cPopulation(cWorld* world)
 , num_prey_organisms(0)
 , num_pred_organisms(0)
 , num_top_pred_organisms(0)
+, m_deme_clock(0.0)
 , sync_events(false)
 , m_hgt_resid(-1)
 {
@@ -317,6 +347,7 @@ void cPopulation::ClearCellGrid()
   delete sleep_log; sleep_log = NULL;
   reaper_queue.Clear();
   delete m_scheduler; m_scheduler = NULL;
+  m_batched_scheduler = NULL;
 }
 
 
@@ -334,6 +365,7 @@ void cPopulation::SetupCellGrid()
   
   // Allocate the cells, resources, and market.
   cell_array.ResizeClear(num_cells);
+  m_cell_connections.ResizeClear(num_cells, 8);
   empty_cell_id_array.ResizeClear(cell_array.GetSize());
   for (int i = 0; i < empty_cell_id_array.GetSize(); i++) {
     empty_cell_id_array[i] = i;
@@ -342,7 +374,7 @@ void cPopulation::SetupCellGrid()
   // Setup the cells.  Do things that are not dependent upon topology here.
   bool fill_reaper_queue = (m_world->GetConfig().BIRTH_METHOD.Get() == POSITION_OFFSPRING_FULL_SOUP_ELDEST);
   for (int i = 0; i < num_cells; i++) {
-    cell_array[i].Setup(m_world, i, environment.GetMutRates(), i % world_x, i / world_x);    
+    cell_array[i].Setup(m_world, &m_cell_connections, i, environment.GetMutRates(), i % world_x, i / world_x);
     if (fill_reaper_queue) reaper_queue.Push(&(cell_array[i]));
   }
   
@@ -400,6 +432,7 @@ void cPopulation::SetupCellGrid()
         assert(false);
     }
   }
+  m_cell_connections.Compact();
   
   BuildTimeSlicer();
   
@@ -420,6 +453,7 @@ void cPopulation::SetupCellGrid()
     cResourceCount tmp_deme_res_count(num_deme_res);
     GetDeme(i).SetDemeResourceCount(tmp_deme_res_count);
     GetDeme(i).ResizeSpatialGrids(deme_size_x, deme_size_y);
+    GetDeme(i).GetDemeResources().AttachElapsedClock(&m_deme_clock);
   }
   
   
@@ -479,6 +513,11 @@ void cPopulation::SetupCellGrid()
     }
   }
   
+  if (m_resource_workers == NULL && m_world->GetConfig().RESOURCE_UPDATE_THREADS.Get() > 1) {
+    m_resource_workers = new cUpdateWorkerPool(m_world, m_world->GetConfig().RESOURCE_UPDATE_THREADS.Get());
+  }
+  resource_count.SetWorkerPool(m_resource_workers, m_world->GetConfig().RESOURCE_TILE_MIN_CELLS.Get());
+  
   // if HGT is on, make sure there's a resource for it:
   if (m_world->GetConfig().ENABLE_HGT.Get() && (m_hgt_resid == -1)) {
     m_world->GetDriver().Feedback().Warning("HGT is enabled, but no HGT resource is defined; add hgt=1 to a single resource in the environment file.");
@@ -602,8 +641,11 @@ bool cPopulation::IsValidArgument(const Data::DataID& data_id, Data::Argument ar
 
 cPopulation::~cPopulation()
 {
+  delete m_genome_tests;
   for (int i = 0; i < cell_array.GetSize(); i++) delete cell_array[i].GetOrganism(); 
   delete m_scheduler;
+  delete m_update_workers;
+  delete m_resource_workers;
 }
 
 
@@ -697,6 +739,15 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
     merit_array = non_migrant_merits;
   }
   
+  // Hand genotypes that have become abundant enough to the background test service
+  if (GetGenomeTestService()) {
+    const int threshold = m_world->GetConfig().GENOME_TEST_THRESHOLD.Get();
+    for (int i = 0; i < offspring_array.GetSize(); i++) {
+      Systematics::GroupPtr genotype = offspring_array[i]->SystematicsGroup("genotype");
+      if (genotype && genotype->NumUnits() >= threshold) Systematics::GenomeTestMetrics::RequestMetrics(m_world, genotype);
+    }
+  }
+  
   Apto::Array<int> target_cells(offspring_array.GetSize());
   
   // Loop through choosing the later placement of each offspring in the population.
@@ -4232,7 +4283,7 @@ void cPopulation::DivideDemes(cAvidaContext& ctx)
       cOrganism * org1 = cell_array[cell1_id].GetOrganism();
       
       // Keep track of what tasks have been done.
-      const Apto::Array<int> & cur_tasks = org1->GetPhenotype().GetLastTaskCount();
+      const tArraySlice<int>& cur_tasks = org1->GetPhenotype().GetLastTaskCount();
       for (int i = 0; i < num_tasks; i++) {
         tot_tasks[i] += cur_tasks[i];
       }
@@ -5331,26 +5382,26 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
   tList<cPopulationCell> found_list;
   
   // First, check if there is an empty organism to work with (always preferred)
-  tList<cPopulationCell>& conn_list = parent_cell.ConnectionList();
+  cConnectionList conn_list = parent_cell.ConnectionList();
   
   const bool prefer_empty = m_world->GetConfig().PREFER_EMPTY.Get();
   
   if (birth_method == POSITION_OFFSPRING_DISPERSAL && conn_list.GetSize() > 0) {
-    tList<cPopulationCell>* disp_list = &conn_list;
+    cConnectionList disp_list = conn_list;
     
     // hop through connection lists based on the dispersal rate
     int hops = ctx.GetRandom().GetRandPoisson(m_world->GetConfig().DISPERSAL_RATE.Get());
     for (int i = 0; i < hops; i++) {
-      disp_list = &(disp_list->GetPos(ctx.GetRandom().GetUInt(disp_list->GetSize()))->ConnectionList());
-      if (disp_list->GetSize() == 0) break;
+      disp_list = disp_list.GetPos(ctx.GetRandom().GetUInt(disp_list.GetSize()))->ConnectionList();
+      if (disp_list.GetSize() == 0) break;
     }
     
     // if prefer empty, select an empty cell from the final connection list
-    if (prefer_empty) FindEmptyCell(*disp_list, found_list);
+    if (prefer_empty) FindEmptyCell(disp_list, found_list);
     
     // if prefer empty is off, or there are no empty cells, use the whole connection list as possiblities
     if (found_list.GetSize() == 0) {
-      found_list = *disp_list;
+      for (int i = 0; i < disp_list.GetSize(); i++) found_list.PushRear(disp_list.GetPos(i));
       // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
       if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
     }
@@ -5369,7 +5420,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
         PositionMerit(parent_cell, found_list, parent_ok);
         break;
       case POSITION_OFFSPRING_RANDOM:
-        found_list.Append(conn_list);
+        for (int i = 0; i < conn_list.GetSize(); i++) found_list.PushRear(conn_list.GetPos(i));
         if (parent_ok == true) found_list.Push(&parent_cell);
         break;
       case POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED:
@@ -5400,10 +5451,10 @@ void cPopulation::PositionAge(cPopulationCell & parent_cell,
   if (parent_ok == false) max_age = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cConnectionList conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_age = test_cell->GetOrganism()->GetPhenotype().GetAge();
     if (cur_age > max_age) {
       max_age = cur_age;
@@ -5428,10 +5479,10 @@ void cPopulation::PositionMerit(cPopulationCell & parent_cell,
   if (parent_ok == false) max_ratio = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cConnectionList conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const double cur_ratio = test_cell->GetOrganism()->CalcMeritRatio();
     if (cur_ratio > max_ratio) {
       max_ratio = cur_ratio;
@@ -5456,10 +5507,10 @@ void cPopulation::PositionEnergyUsed(cPopulationCell & parent_cell,
   if (parent_ok == false) max_energy_used = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cConnectionList conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_energy_used = test_cell->GetOrganism()->GetPhenotype().GetTimeUsed();
     if (cur_energy_used > max_energy_used) {
       max_energy_used = cur_energy_used;
@@ -5698,10 +5749,8 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
   
-  // These must be done even if there is only one deme.
-  for(int i = 0; i < GetNumDemes(); i++) {
-    GetDeme(i).Update(step_size);
-  }
+  // Deme resources draw from the shared deme clock when next queried, this must be done even if there is only one deme.
+  m_deme_clock += step_size;
   
   cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
   deme.IncTimeUsed(merit);
@@ -5745,7 +5794,7 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   // Deme specific
   if (GetNumDemes() > 1) {
-    for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
+    m_deme_clock += step_size;
     
     cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
@@ -5762,6 +5811,195 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   resource_count.Update(step_size);
 }
 
+
+// Processes one scheduling decision as a time slice of up to 'quantum' steps.  The first instruction executes normally
+// and the rest of the slice follows the speculative execution rules, so it ends early at a divide, when the organism
+// is due to die, or on the first instruction flagged as interacting with other cells (which executes when the organism
+// is next scheduled).  Step bookkeeping is applied once for the whole slice.  Returns the number of steps used.
+int cPopulation::ProcessStepQuantum(cAvidaContext& ctx, double step_size, int cell_id, int quantum)
+{
+  assert(step_size > 0.0);
+  assert(quantum > 0);
+  assert(cell_id < cell_array.GetSize());
+  
+  // If cell_id is negative, no cell could be found -- the step is used up all the same.
+  if (cell_id < 0) return 1;
+  
+  cPopulationCell& cell = GetCell(cell_id);
+  assert(cell.IsOccupied()); // Unoccupied cell getting processor time!
+  cOrganism* cur_org = cell.GetOrganism();
+  cHardwareBase* hw = cell.GetHardware();
+  cPhenotype& phenotype = cur_org->GetPhenotype();
+  
+  const int num_divides = phenotype.GetNumDivides();
+  int steps = 1;
+  if (hw->SingleProcess(ctx) && quantum > 1 && hw->SupportsSpeculative() && !hw->IsTraced() &&
+      !phenotype.GetToDelete() && phenotype.GetNumDivides() == num_divides) {
+    while (steps < quantum && hw->SingleProcess(ctx, true)) steps++;
+  }
+  
+  double merit = phenotype.GetMerit().GetDouble();
+  if (phenotype.GetToDelete() == true) {
+    cur_org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs);
+    delete cur_org;
+  }
+  
+  m_world->GetStats().IncExecuted(steps);
+  resource_count.Update(step_size * steps);
+  
+  // Deme resources draw from the shared deme clock when next queried, this must be done even if there is only one deme.
+  m_deme_clock += step_size * steps;
+  
+  cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
+  deme.IncTimeUsed(merit, steps);
+  
+  if (GetNumDemes() >= 1) {
+    CheckImplicitDemeRepro(deme, ctx); 
+  }
+  
+  return steps;
+}
+
+// Pre-executes the local (non-stalling) instructions of every cell in one row of the world.  Each cell is run for at
+// most the number of steps it was scheduled this update, and the work done is recorded as the cell's speculative
+// state so that the serial pass in ProcessUpdateParallel simply consumes it.
+class cSpeculativeRegionJob : public cUpdateWorkerPool::Job
+{
+private:
+  Apto::Array<cPopulationCell>& m_cells;
+  const Apto::Array<int>& m_quota;
+  Apto::Array<int>& m_region_spec;
+  const int m_region_size;
+  
+public:
+  cSpeculativeRegionJob(Apto::Array<cPopulationCell>& cells, const Apto::Array<int>& quota, Apto::Array<int>& region_spec,
+                        int region_size)
+    : m_cells(cells), m_quota(quota), m_region_spec(region_spec), m_region_size(region_size) { ; }
+  
+  void Run(cAvidaContext& ctx, int region_id)
+  {
+    const int begin = region_id * m_region_size;
+    const int end = Apto::Min(begin + m_region_size, m_cells.GetSize());
+    
+    int spec_total = 0;
+    for (int cell_id = begin; cell_id < end; cell_id++) {
+      const int quota = m_quota[cell_id];
+      cPopulationCell& cell = m_cells[cell_id];
+      if (quota == 0 || !cell.IsOccupied() || cell.GetSpeculativeState()) continue;
+      
+      cHardwareBase* hw = cell.GetHardware();
+      if (!hw->SupportsSpeculative() || hw->IsTraced()) continue;
+      
+      int spec_count = 0;
+      while (spec_count < quota && hw->SingleProcess(ctx, true)) spec_count++;
+      cell.SetSpeculativeState(spec_count);
+      spec_total += spec_count;
+    }
+    m_region_spec[region_id] = spec_total;
+  }
+};
+
+
+cGenomeTestService* cPopulation::GetGenomeTestService()
+{
+  if (m_genome_tests == NULL && m_world->GetConfig().GENOME_TEST_THREADS.Get() > 0) {
+    m_genome_tests = new cGenomeTestService(m_world, m_world->GetConfig().GENOME_TEST_THREADS.Get());
+  }
+  return m_genome_tests;
+}
+
+
+// Processes an entire update using the worker pool.  The update's schedule is drawn up front, after which each row of
+// the world is handed to a worker that speculatively executes its organisms' local instructions with a per-row RNG
+// stream.  Anything that may touch another cell (IO, divide, movement, messaging, ...) stalls speculation and is left
+// for the serial merge pass, which replays the drawn schedule in order on the main context.  Instruction sets that
+// touch shared state without stalling are never run here (see Avida2Driver).  Results are therefore reproducible for a
+// fixed random seed independent of the number of worker threads.  Since the whole schedule is drawn before any
+// organism runs, merit changes and offspring born during the update are first scheduled in the following update.
+void cPopulation::ProcessUpdateParallel(cAvidaContext& ctx, double step_size, int update_size)
+{
+  assert(step_size > 0.0);
+  
+  if (m_update_workers == NULL) {
+    m_update_workers = new cUpdateWorkerPool(m_world, m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get());
+  }
+  
+  // Draw this update's schedule, recording how many steps each cell will receive
+  m_update_schedule.ResizeClear(update_size);
+  m_update_quota.ResizeClear(cell_array.GetSize());
+  m_update_quota.SetAll(0);
+  for (int i = 0; i < update_size; i++) {
+    const int cell_id = ScheduleOrganism();
+    m_update_schedule[i] = cell_id;
+    if (cell_id >= 0) m_update_quota[cell_id]++;
+  }
+  
+  // Regions are rows of the world, seeded in order from the world RNG
+  const int num_regions = world_y;
+  m_region_seeds.ResizeClear(num_regions);
+  m_region_spec.ResizeClear(num_regions);
+  for (int i = 0; i < num_regions; i++) {
+    m_region_seeds[i] = m_world->GetRandom().GetInt(m_world->GetRandom().MaxSeed());
+    m_region_spec[i] = 0;
+  }
+  
+  cSpeculativeRegionJob job(cell_array, m_update_quota, m_region_spec, world_x);
+  m_update_workers->Execute(job, num_regions, &m_region_seeds[0]);
+  
+  cStats& stats = m_world->GetStats();
+  for (int i = 0; i < num_regions; i++) if (m_region_spec[i]) stats.AddSpeculative(m_region_spec[i]);
+  
+  // Merge pass, replay the schedule serially so that all cross-cell effects happen in a deterministic order
+  for (int i = 0; i < update_size; i++) {
+    if (num_organisms == 0) break;
+    
+    const int cell_id = m_update_schedule[i];
+    if (cell_id < 0 || !cell_array[cell_id].IsOccupied()) continue;
+    ProcessStepSpeculative(ctx, step_size, cell_id);
+  }
+}
+
+
+// Processes an entire update from block allocations of the batched scheduler, in place of one scheduler draw per step.
+// Each cell's organism executes all of the steps allocated to it in one block, with cells visited in a random order.
+// Steps allocated to an organism that dies or is replaced before its block completes are drawn again, along with any
+// others left unused, from the priorities in effect at the end of the pass (so merit changes and offspring born during
+// the update are picked up at block boundaries), until the update's steps are spent or no organisms remain.
+void cPopulation::ProcessUpdateBatched(cAvidaContext& ctx, double step_size, int update_size, bool speculative)
+{
+  assert(step_size > 0.0);
+  assert(m_batched_scheduler);
+  
+  m_update_owner.ResizeClear(cell_array.GetSize());
+  
+  int remaining = update_size;
+  while (remaining > 0 && num_organisms > 0) {
+    if (m_batched_scheduler->Allocate(remaining, m_update_quota) == 0) break;
+    
+    // Record which organism each allocation belongs to and the order in which the cells will be processed
+    m_update_schedule.Resize(0);
+    for (int cell_id = 0; cell_id < cell_array.GetSize(); cell_id++) {
+      if (m_update_quota[cell_id] == 0) continue;
+      assert(cell_array[cell_id].IsOccupied());
+      m_update_owner[cell_id] = cell_array[cell_id].GetOrganism()->GetID();
+      m_update_schedule.Push(cell_id);
+    }
+    m_batched_scheduler->Shuffle(m_update_schedule);
+    
+    for (int i = 0; i < m_update_schedule.GetSize() && num_organisms > 0; i++) {
+      const int cell_id = m_update_schedule[i];
+      cPopulationCell& cell = cell_array[cell_id];
+      for (int step = 0; step < m_update_quota[cell_id]; step++) {
+        if (!cell.IsOccupied() || cell.GetOrganism()->GetID() != m_update_owner[cell_id]) break;
+        if (speculative) ProcessStepSpeculative(ctx, step_size, cell_id);
+        else ProcessStep(ctx, step_size, cell_id);
+        remaining--;
+      }
+    }
+  }
+}
+
+
 // Loop through all the demes getting stats and doing calculations
 // which must be done on a deme by deme basis.
 void cPopulation::UpdateDemeStats(cAvidaContext& ctx) { 
@@ -5866,6 +6104,17 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
   int min_gestation_time = INT_MAX;
   int min_genome_length = INT_MAX;
   
+  // Ask for every genotype's test results up front, so that the ones still missing are queued together and tested
+  // side by side on the background service rather than one at a time as the loop below reaches them
+  Apto::Array<Systematics::GenomeTestMetricsPtr> test_metrics;
+  if (stats.ShouldCollectEnvTestStats()) {
+    test_metrics.Resize(live_org_list.GetSize());
+    for (int i = 0; i < live_org_list.GetSize(); i++) {
+      Systematics::GroupPtr genotype = live_org_list[i]->SystematicsGroup("genotype");
+      test_metrics[i] = Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, genotype);
+    }
+  }
+  
   for (int i = 0; i < live_org_list.GetSize(); i++) {  
     cOrganism* organism = live_org_list[i];
     
@@ -5949,8 +6198,8 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
     }
 
     if (stats.ShouldCollectEnvTestStats()) {
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
-      Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
+      Systematics::GenomeTestMetricsPtr& metrics = test_metrics[i];
+      if (!metrics) metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, organism->SystematicsGroup("genotype"));
       const Apto::Array<int>& test_task_counts = metrics->GetTaskCounts();
       
       for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) if (test_task_counts[j] > 0) stats.AddTestTask(j);
@@ -6210,6 +6459,10 @@ void cPopulation::ProcessPreUpdate()
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  // Fold the time elapsed this update into every deme's resources and restart the shared deme clock
+  for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].GetDemeResources().RestartElapsedClock();
+  m_deme_clock = 0.0;
+  
   ProcessUpdateCellActions(ctx);
   
   cStats& stats = m_world->GetStats();
@@ -7320,6 +7573,13 @@ void cPopulation::BuildTimeSlicer()
       m_scheduler = new Apto::Scheduler::ProbabilisticIntegrated(cell_array.GetSize(), rng);
     }
       break;
+    case SLICE_BATCHED_PROB_MERIT:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_batched_scheduler = new cBatchedScheduler(cell_array.GetSize(), rng);
+      m_scheduler = m_batched_scheduler;
+    }
+      break;
     default:
       cout << "error: requested time slicer not found." << endl;
       m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
@@ -7328,13 +7588,10 @@ void cPopulation::BuildTimeSlicer()
 }
 
 
-void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
-                                tList<cPopulationCell> & found_list)
+void cPopulation::FindEmptyCell(const cConnectionList& cell_list, tList<cPopulationCell>& found_list)
 {
-  tListIterator<cPopulationCell> cell_it(cell_list);
-  cPopulationCell * test_cell;
-  
-  while ( (test_cell = cell_it.Next()) != NULL) {
+  for (int i = 0; i < cell_list.GetSize(); i++) {
+    cPopulationCell* test_cell = cell_list.GetPos(i);
     // If this cell is empty, add it to the list...
     if (test_cell->IsOccupied() == false) found_list.Push(test_cell);
   }
@@ -7474,7 +7731,9 @@ void cPopulation::InjectGenome(int cell_id, Systematics::Source src, const Genom
   //Coalescense Clade Setup
   new_organism->SetCCladeLabel(-1);
   
-  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, new_organism->SystematicsGroup("genotype"));
+  Systematics::GroupPtr genotype = new_organism->SystematicsGroup("genotype");
+  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, genotype);
+  if (!metrics) metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype);
   
   if (m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
     phenotype.SetMerit(cMerit(phenotype.ConvertEnergyToMerit(phenotype.GetStoredEnergy())));
@@ -41,9 +41,12 @@
 class cAvidaContext;
 class cCodeLabel;
 class cEnvironment;
+class cGenomeTestService;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cBatchedScheduler;
+class cUpdateWorkerPool;
 
 using namespace Avida;
 
@@ -66,7 +69,12 @@ private:
   // Components...
   cWorld* m_world;
   Apto::PriorityScheduler* m_scheduler;                // Handles allocation of CPU cycles
+  cBatchedScheduler* m_batched_scheduler;              // m_scheduler when allocating whole updates at once, else NULL
+  cUpdateWorkerPool* m_update_workers;                 // Worker threads for parallel update processing
+  cUpdateWorkerPool* m_resource_workers;               // Worker threads for spatial resource updates
+  cGenomeTestService* m_genome_tests;                  // Background genotype testing (NULL unless enabled)
   Apto::Array<cPopulationCell> cell_array;  // Local cells composing the population
+  cConnectionTable m_cell_connections;      // Neighbor lists for every cell in cell_array
   Apto::Array<int> empty_cell_id_array;     // Used for PREFER_EMPTY birth methods
   cResourceCount resource_count;       // Global resources available
   cBirthChamber birth_chamber;         // Global birth chamber.
@@ -112,6 +120,7 @@ private:
   int num_top_pred_organisms;
   
   Apto::Array<cDeme> deme_array;            // Deme structure of the population.
+  double m_deme_clock;                      // Time elapsed this update, credited lazily to deme resources
  
   // Outside interactions...
   bool sync_events;   // Do we need to sync up the event list with population?
@@ -121,6 +130,13 @@ private:
   std::map<int, int> m_group_females; //<! Maps the group id to the number of females in the group
   std::map<int, int> m_group_males; //<! Maps the group id to the number of males in the group
 
+  // Parallel and batched update state, see ProcessUpdateParallel and ProcessUpdateBatched
+  Apto::Array<int> m_update_schedule;  //!< Cell ids drawn for each step (parallel), or cell processing order (batched)
+  Apto::Array<int> m_update_quota;     //!< Number of steps each cell received in the current update
+  Apto::Array<int> m_update_owner;     //!< Id of the organism each cell's batched steps were allocated to
+  Apto::Array<int> m_region_seeds;     //!< Per-region RNG seeds for the current update
+  Apto::Array<int> m_region_spec;      //!< Per-region count of pre-executed instructions
+
   int m_hgt_resid; //!< HGT resource ID.
 
   cPopulation(); // @not_implemented
@@ -259,6 +275,10 @@ public:
   int ScheduleOrganism();          // Determine next organism to be processed.
   void ProcessStep(cAvidaContext& ctx, double step_size, int cell_id);
   void ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id);
+  int ProcessStepQuantum(cAvidaContext& ctx, double step_size, int cell_id, int quantum);
+  void ProcessUpdateParallel(cAvidaContext& ctx, double step_size, int update_size);
+  void ProcessUpdateBatched(cAvidaContext& ctx, double step_size, int update_size, bool speculative);
+  bool HasBatchedScheduler() const { return m_batched_scheduler != NULL; }
 
   // Calculate the statistics from the most recent update.
   void ProcessPostUpdate(cAvidaContext& ctx);
@@ -300,6 +320,7 @@ public:
   int GetWorldY() const { return world_y; }
   int GetNumDemes() const { return deme_array.GetSize(); }
   cDeme& GetDeme(int i) { return deme_array[i]; }
+  cGenomeTestService* GetGenomeTestService(); // NULL unless GENOME_TEST_THREADS is set
 
   cPopulationCell& GetCell(int in_num) { assert(in_num >=0); assert(in_num < cell_array.GetSize()); return cell_array[in_num]; }
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const { return resource_count.GetResources(ctx); }
@@ -307,6 +328,7 @@ public:
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const { return resource_count.GetFrozenResources(ctx, cell_id); }
   double GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const { return resource_count.GetFrozenCellResVal(ctx, cell_id, res_id); }
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const { return resource_count.GetCellResVal(ctx, cell_id, res_id); }
+  cResourceView GetCellResourceView(cAvidaContext& ctx, int cell_id) const { return resource_count.GetCellResourceView(ctx, cell_id); }
   const Apto::Array<double>& GetDemeResources(int deme_id, cAvidaContext& ctx) { return GetDeme(deme_id).GetDemeResourceCount().GetResources(ctx); }  
   const Apto::Array<double>& GetDemeCellResources(int deme_id, int cell_id, cAvidaContext& ctx) { return GetDeme(deme_id).GetDemeResourceCount().GetCellResources( GetDeme(deme_id).GetRelativeCellID(cell_id), ctx ); } 
   void TriggerDoUpdates(cAvidaContext& ctx) { resource_count.UpdateResources(ctx); }
@@ -462,7 +484,7 @@ private:
   cPopulationCell& PositionDemeRandom(int deme_id, cPopulationCell& parent_cell, bool parent_ok = true);
   int UpdateEmptyCellIDArray(int deme_id = -1);
   Apto::Array<int>& GetEmptyCellIDArray() { return empty_cell_id_array; }
-  void FindEmptyCell(tList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
+  void FindEmptyCell(const cConnectionList& cell_list, tList<cPopulationCell>& found_list);
   int FindRandEmptyCell(cAvidaContext& ctx);
   
   // Update statistics collecting...
@@ -41,6 +41,7 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
 : m_world(in_cell.m_world)
 , m_organism(in_cell.m_organism)
 , m_hardware(in_cell.m_hardware)
+, m_connections(in_cell.m_connections)
 , m_inputs(in_cell.m_inputs)
 , m_cell_id(in_cell.m_cell_id)
 , m_deme_id(in_cell.m_deme_id)
@@ -53,11 +54,6 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
   // Copy the mutation rates into a new structure
   m_mut_rates = new cMutationRates(*in_cell.m_mut_rates);
 	
-  // Copy the connection list
-  tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-  cPopulationCell* test_cell;
-  while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
-	
 	// copy the hgt information, if needed.
 	if(in_cell.m_hgt) {
 		InitHGTSupport();
@@ -71,6 +67,7 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 		m_world = in_cell.m_world;
 		m_organism = in_cell.m_organism;
 		m_hardware = in_cell.m_hardware;
+		m_connections = in_cell.m_connections;
 		m_inputs = in_cell.m_inputs;
 		m_cell_id = in_cell.m_cell_id;
 		m_deme_id = in_cell.m_deme_id;
@@ -85,11 +82,6 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 		else
 			m_mut_rates->Copy(*in_cell.m_mut_rates);
 		
-		// Copy the connection list
-		tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-		cPopulationCell* test_cell;
-		while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
-		
 		// copy hgt information, if needed.
 		delete m_hgt;
 		m_hgt = 0;
@@ -100,9 +92,10 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 	}
 }
 
-void cPopulationCell::Setup(cWorld* world, int in_id, const cMutationRates& in_rates, int x, int y)
+void cPopulationCell::Setup(cWorld* world, cConnectionTable* connections, int in_id, const cMutationRates& in_rates, int x, int y)
 {
   m_world = world;
+  m_connections = connections;
   m_cell_id = in_id;
   m_x = x;
   m_y = y;
@@ -129,36 +122,35 @@ void cPopulationCell::Rotate(cPopulationCell& new_facing)
     return;
   }
 	
-#ifdef DEBUG
-  int scan_count = 0;
-#endif
-  while (m_connections.GetFirst() != &new_facing) {
-    m_connections.CircNext();
-#ifdef DEBUG
-    assert(++scan_count < m_connections.GetSize());
-#endif
-  }
+  const int pos = m_connections->Find(m_cell_id, &new_facing);
+  assert(pos >= 0);
+  if (pos > 0) m_connections->Rotate(m_cell_id, pos);
 }
 
 /*! This method recursively builds a set of cells that neighbor this cell, out to 
  the given depth.  The set must be passed in by-reference, as calls to this method 
  must share a common set of already-visited cells.
+ 
+ A cell already in the set is not expanded again, so which cells beyond the first
+ level are reached depends on the order of the walk.  The first level is always
+ every connection, which the connection table's cached neighborhood provides.
  */
 void cPopulationCell::GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const {
-	typedef std::set<cPopulationCell*> cell_set_t;
+  if (depth <= 1) {
+    const cNeighborhood neighborhood = GetNeighborhood(1);
+    for (int i = 0; i < neighborhood.GetSize(); i++) cell_set.insert(neighborhood.Get(i));
+    if (m_connections->Find(m_cell_id, this) >= 0) cell_set.insert(const_cast<cPopulationCell*>(this));
+    return;
+  }
   
-  // For each cell in our connection list...
-  tConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-		// store the cell pointer, and check to see if we've already visited that cell...
-    cPopulationCell* cell = i.Next();
-		assert(cell != 0); // cells should never be null.
-		std::pair<cell_set_t::iterator, bool> ins = cell_set.insert(cell);
-		// and if so, recurse to it...
-		if(ins.second && (depth > 1)) {
-			cell->GetNeighboringCells(cell_set, depth-1);
-		}
-	}
+  // For each cell in our connection list, starting from the one faced...
+  for (int i = 0; i < m_connections->GetSize(m_cell_id); i++) {
+    // store the cell pointer, and check to see if we've already visited that cell...
+    cPopulationCell* cell = m_connections->Get(m_cell_id, i);
+    assert(cell != 0); // cells should never be null.
+    // and if not, recurse to it...
+    if (cell_set.insert(cell).second) cell->GetNeighboringCells(cell_set, depth - 1);
+  }
 }
 
 /*! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
@@ -176,12 +168,12 @@ void cPopulationCell::GetOccupiedNeighboringCells(std::set<cPopulationCell*>& oc
 
 void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const
 {
-  occupied_cells.Resize(m_connections.GetSize());
+  const int num_connections = m_connections->GetSize(m_cell_id);
+  occupied_cells.Resize(num_connections);
   int occupied_count = 0;
 
-  tLWConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-    cPopulationCell* cell = i.Next();
+  for (int i = 0; i < num_connections; i++) {
+    cPopulationCell* cell = m_connections->Get(m_cell_id, i);
 		assert(cell); // cells should never be null.
     if (cell->IsOccupied()) occupied_cells[occupied_count++] = cell;
   }
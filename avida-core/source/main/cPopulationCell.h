@@ -29,6 +29,7 @@
 #include <set>
 #include <deque>
 
+#include "cConnectionTable.h"
 #include "cMutationRates.h"
 #include "tList.h"
 #include "cGenomeUtil.h"
@@ -52,7 +53,7 @@ private:
   cOrganism* m_organism;                    // The occupent of this cell.
   cHardwareBase* m_hardware;
 
-  tList<cPopulationCell> m_connections;  // A list of neighboring cells.
+  cConnectionTable* m_connections;       // Neighbor lists of the population this cell belongs to.
   cMutationRates* m_mut_rates;           // Mutation rates at this cell.
   Apto::Array<int> m_inputs;                 // Environmental Inputs...
 
@@ -86,13 +87,13 @@ private:
 public:
   typedef std::set<cPopulationCell*> neighborhood_type; //!< Type for cell neighborhoods.
 
-  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_mut_rates(NULL), m_migrant(false), m_can_input(false), m_can_output(false), m_hgt(0) { ; }
+  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_connections(NULL), m_mut_rates(NULL), m_migrant(false), m_can_input(false), m_can_output(false), m_hgt(0) { ; }
   cPopulationCell(const cPopulationCell& in_cell);
   ~cPopulationCell() { delete m_mut_rates; delete m_hgt; }
 
   void operator=(const cPopulationCell& in_cell);
 
-  void Setup(cWorld* world, int in_id, const cMutationRates& in_rates, int x, int y);
+  void Setup(cWorld* world, cConnectionTable* connections, int in_id, const cMutationRates& in_rates, int x, int y);
   void SetDemeID(int in_id) { m_deme_id = in_id; }
   void Rotate(cPopulationCell& new_facing);
 
@@ -103,13 +104,15 @@ public:
 
   inline cOrganism* GetOrganism() const { return m_organism; }
   inline cHardwareBase* GetHardware() const { return m_hardware; }
-  inline tList<cPopulationCell>& ConnectionList() { return m_connections; }
-  //! Recursively build a set of cells that neighbor this one, out to the given depth.
+  inline cConnectionList ConnectionList() { return cConnectionList(m_connections, m_cell_id); }
+  //! Cells that neighbor this one, out to the given depth (at least 1), from the connection table's cache.  Never includes this cell.
+  inline cNeighborhood GetNeighborhood(int depth) const { return m_connections->GetNeighborhood(m_cell_id, Apto::Max(depth, 1)); }
+  //! Recursively build a set of cells that neighbor this one, out to the given depth, as a walk through the connections reaches them.
   void GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const;
-  //! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
+  //! Build a set of occupied cells that neighbor this one, out to the given depth, including this cell as GetNeighboringCells does.
   void GetOccupiedNeighboringCells(std::set<cPopulationCell*>& occupied_cell_set, int depth) const;
   void GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const;
-  inline cPopulationCell& GetCellFaced() { return *(m_connections.GetFirst()); }
+  inline cPopulationCell& GetCellFaced() { return *(m_connections->Get(m_cell_id, 0)); }
   int GetFacing();  // Returns the facing of this cell.
   int GetFacedDir(); // Returns the human interpretable facing of this org.
   inline void GetPosition(int& x, int& y) const { x = m_x; y = m_y; } // Retrieves the position (x,y) coordinates of this cell.
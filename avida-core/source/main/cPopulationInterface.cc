@@ -269,10 +269,9 @@ void cPopulationInterface::GetNeighborhoodCellIDs(Apto::Array<int>& list)
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
   
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  cConnectionList conn_list = cell.ConnectionList();
+  list.Resize(conn_list.GetSize());
+  for (int i = 0; i < conn_list.GetSize(); i++) list[i] = conn_list.GetPos(i)->GetID();
 }
 
 void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int av_num)
@@ -280,10 +279,9 @@ void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_avatars[av_num].av_cell_id);
   assert(cell.HasAV());
   
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  cConnectionList conn_list = cell.ConnectionList();
+  list.Resize(conn_list.GetSize());
+  for (int i = 0; i < conn_list.GetSize(); i++) list[i] = conn_list.GetPos(i)->GetID();
 }
 
 int cPopulationInterface::GetFacing()
@@ -353,6 +351,11 @@ double cPopulationInterface::GetResourceVal(cAvidaContext& ctx, int res_id)
   return m_world->GetPopulation().GetCellResVal(ctx, m_cell_id, res_id);
 }
 
+cResourceView cPopulationInterface::GetResourceView(cAvidaContext& ctx)
+{
+  return m_world->GetPopulation().GetCellResourceView(ctx, m_cell_id);
+}
+
 const Apto::Array<double>& cPopulationInterface::GetFacedCellResources(cAvidaContext& ctx)
 {
   return m_world->GetPopulation().GetCellResources(GetCell()->GetCellFaced().GetID(), ctx); 
@@ -618,16 +621,10 @@ bool cPopulationInterface::BroadcastMessage(cOrgMessage& msg, int depth) {
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied()); // This organism; sanity.
 	
-	// Get the set of cells that are within range.
-	std::set<cPopulationCell*> cell_set;
-	cell.GetNeighboringCells(cell_set, depth);
-	
-	// Remove this cell from the set!
-	cell_set.erase(&cell);
-	
-	// Now, send a message towards each cell:
-	for(std::set<cPopulationCell*>::iterator i=cell_set.begin(); i!=cell_set.end(); ++i) {
-		SendMessage(msg, **i);
+	// Send a message towards every cell within depth connections (not including this one), in cell id order
+	const cNeighborhood neighborhood = cell.GetNeighborhood(depth);
+	for (int i = 0; i < neighborhood.GetSize(); i++) {
+		SendMessage(msg, *neighborhood.Get(i));
 	}
 	return true;
 }
@@ -1524,11 +1521,9 @@ void cPopulationInterface::PushToleranceInstExe(int tol_inst, cAvidaContext& ctx
     return;
   }
   
-  const Apto::Array<double> res_count = GetResources(ctx);
-  
   int group_id = GetOrganism()->GetOpinion().first;
   int group_size = NumberOfOrganismsInGroup(group_id);
-  double resource_level = res_count[group_id];
+  double resource_level = GetResourceVal(ctx, group_id);
   int tol_max = m_world->GetConfig().MAX_TOLERANCE.Get();
   
   double immigrant_odds = CalcGroupOddsImmigrants(group_id, -1);
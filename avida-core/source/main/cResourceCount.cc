@@ -25,6 +25,7 @@
 #include "cGradientCount.h"
 #include "cWorld.h"
 #include "cStats.h"
+#include "cUpdateWorkerPool.h"
 
 #include "nGeometry.h"
 
@@ -37,71 +38,15 @@ const double cResourceCount::EPSILON (1.0e-15);
 const int cResourceCount::PRECALC_DISTANCE(100);
 
 
-void FlowMatter(cSpatialCountElem &elem1, cSpatialCountElem &elem2, 
-                double inxdiffuse, 
-                double inydiffuse, double inxgravity, double inygravity,
-                int xdist, int ydist, double dist) {
-
-  /* Routine to calculate the amount of flow from one Element to another.
-     Amount of flow is a function of:
-
-       1) Amount of material in each cell (will try to equalize)
-       2) Distance between each cell
-       3) x and y "gravity"
-
-     This method only effect the delta amount of each element.  The State
-     method will need to be called at the end of each time step to complete
-     the movement of material.
-  */
-
-  double  diff, flowamt, xgravity, xdiffuse, ygravity,  ydiffuse;
-
-  if (((elem1.amount == 0.0) && (elem2.amount == 0.0)) && (dist < 0.0)) return;
-  diff = (elem1.amount - elem2.amount);
-  if (xdist != 0) {
-
-    /* if there is material to be effected by x gravity */
-
-    if (((xdist>0) && (inxgravity>0.0)) || ((xdist<0) && (inxgravity<0.0))) {
-      xgravity = elem1.amount * fabs(inxgravity)/3.0;
-    } else {
-      xgravity = -elem2.amount * fabs(inxgravity)/3.0;
-    }
-    
-    /* Diffusion uses the diffusion constant x half the difference (as the 
-       elements attempt to equalize) / the number of possible neighbors (8) */
-
-    xdiffuse = inxdiffuse * diff / 16.0;
-  } else {
-    xdiffuse = 0.0;
-    xgravity = 0.0;
-  }  
-  if (ydist != 0) {
-
-    /* if there is material to be effected by y gravity */
-
-    if (((ydist>0) && (inygravity>0.0)) || ((ydist<0) && (inygravity<0.0))) {
-      ygravity = elem1.amount * fabs(inygravity)/3.0;
-    } else {
-      ygravity = -elem2.amount * fabs(inygravity)/3.0;
-    }
-    ydiffuse = inydiffuse * diff / 16.0;
-  } else {
-    ydiffuse = 0.0;
-    ygravity = 0.0;
-  }  
-
-  flowamt = ((xdiffuse + ydiffuse + xgravity + ygravity)/
-             (fabs(xdist*1.0) + fabs(ydist*1.0)))/dist;
-  elem1.delta -= flowamt;
-  elem2.delta += flowamt;
-}
-
 cResourceCount::cResourceCount(int num_resources)
   : update_time(0.0)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_elapsed_clock(NULL)
+  , m_elapsed_synced(0.0)
+  , m_workers(NULL)
+  , m_min_tiled_cells(0)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -110,7 +55,7 @@ cResourceCount::cResourceCount(int num_resources)
   return;
 }
 
-cResourceCount::cResourceCount(const cResourceCount &rc) {
+cResourceCount::cResourceCount(const cResourceCount &rc) : m_elapsed_clock(NULL), m_elapsed_synced(0.0), m_workers(NULL), m_min_tiled_cells(0) {
   *this = rc;
 
   return;
@@ -133,6 +78,10 @@ const cResourceCount &cResourceCount::operator=(const cResourceCount &rc) {
   
   curr_grid_res_cnt = rc.curr_grid_res_cnt;
   curr_spatial_res_cnt = rc.curr_spatial_res_cnt;
+  
+  // Credit any time still pending on the source, this count keeps its own clock attachment
+  rc.syncElapsedClock();
+  if (m_elapsed_clock) m_elapsed_synced = *m_elapsed_clock;
   update_time = rc.update_time;
   spatial_update_time = rc.spatial_update_time;
   cell_lists = rc.cell_lists;
@@ -330,7 +279,6 @@ void cResourceCount::Setup(cWorld* world, const int& res_index, const cString& n
   inflow_rate[res_index] = inflow;
   geometry[res_index] = in_geometry;
   spatial_resource_count[res_index]->SetGeometry(in_geometry);
-  spatial_resource_count[res_index]->SetPointers();
   spatial_resource_count[res_index]->SetCellList(in_cell_list_ptr);
 
   double step_decay = pow(decay, UPDATE_STEP);
@@ -539,6 +487,16 @@ void cResourceCount::Update(double in_time)
   spatial_update_time += in_time;
  }
 
+void cResourceCount::syncElapsedClock() const
+{
+  if (m_elapsed_clock == NULL) return;
+  
+  const double elapsed = *m_elapsed_clock - m_elapsed_synced;
+  update_time += elapsed;
+  spatial_update_time += elapsed;
+  m_elapsed_synced = *m_elapsed_clock;
+}
+
  
 const Apto::Array<double> & cResourceCount::GetResources(cAvidaContext& ctx) const
 {
@@ -565,6 +523,13 @@ const Apto::Array<double> & cResourceCount::GetCellResources(int cell_id, cAvida
 
 }
 
+cResourceView cResourceCount::GetCellResourceView(cAvidaContext& ctx, int cell_id) const
+// Like GetCellResources, but levels are read from the counts as they are used rather than copied out
+{
+  DoUpdates(ctx);
+  return cResourceView(*this, cell_id);
+}
+
 const Apto::Array<double> & cResourceCount::GetFrozenResources(cAvidaContext&, int cell_id) const
 // Get amount of the resource for a given cell in the grid.  If it is a
 // global resource pass out the entire content of that resource.
@@ -655,7 +620,7 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
         resource_count[i] += res_change[i];
       assert(resource_count[i] >= 0.0);
     } else {
-      double temp = spatial_resource_count[i]->Element(cell_id).GetAmount();
+      double temp = spatial_resource_count[i]->GetAmount(cell_id);
       spatial_resource_count[i]->Rate(cell_id, res_change[i]);
       /* Ideally the state of the cell's resource should not be set till
          the end of the update so that all processes (inflow, outflow, 
@@ -664,10 +629,10 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
          the organism demand to work immediately on the state of the resource */ 
     
       spatial_resource_count[i]->State(cell_id);
-      if(spatial_resource_count[i]->Element(cell_id).GetAmount() != temp){
+      if(spatial_resource_count[i]->GetAmount(cell_id) != temp){
         spatial_resource_count[i]->SetModified(true);
       }
-      assert(spatial_resource_count[i]->Element(cell_id).GetAmount() >= 0.0);
+      assert(spatial_resource_count[i]->GetAmount(cell_id) >= 0.0);
     }
   }
 }
@@ -753,6 +718,8 @@ int cResourceCount::GetMaxUsedY(int res_id)
 ///// Private Methods /////////
 void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
 { 
+  syncElapsedClock();
+  
   assert(update_time >= -EPSILON);
 
   // Determine how many update steps have progressed
@@ -785,20 +752,73 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   while (m_spatial_update > m_last_updated) {
     m_last_updated++;
     for (int i = 0; i < resource_count.GetSize(); i++) {
-     if (geometry[i] != nGeometry::GLOBAL && geometry[i] != nGeometry::PARTIAL) {
-        spatial_resource_count[i]->UpdateCount(ctx);
-        spatial_resource_count[i]->Source(inflow_rate[i]);
-        spatial_resource_count[i]->Sink(decay_rate[i]);
-        if (spatial_resource_count[i]->GetCellListSize() > 0) {
-          spatial_resource_count[i]->CellInflow();
-          spatial_resource_count[i]->CellOutflow();
+      if (geometry[i] != nGeometry::GLOBAL && geometry[i] != nGeometry::PARTIAL) {
+        if (!m_workers) {
+          updateSpatialResource(ctx, i);
+        } else if (spatial_resource_count[i]->HasIndependentUpdate()) {
+          // Defer to a batch that can run concurrently
+          m_spatial_batch.Push(i);
+        } else {
+          // Resources that draw random numbers or act on the population keep their place in the serial order
+          updateSpatialBatch(ctx);
+          updateSpatialResource(ctx, i);
         }
-        spatial_resource_count[i]->FlowAll();
-        spatial_resource_count[i]->StateAll();
-        // BDB: resource_count[i] = spatial_resource_count[i]->SumAll();
       }
     }
+    if (m_workers) updateSpatialBatch(ctx);
+  }
+}
+
+void cResourceCount::updateSpatialResource(cAvidaContext& ctx, int res_index, cUpdateWorkerPool* flow_workers) const
+{
+  cSpatialResCount* res = spatial_resource_count[res_index];
+  res->UpdateCount(ctx);
+  res->Source(inflow_rate[res_index]);
+  res->Sink(decay_rate[res_index]);
+  if (res->GetCellListSize() > 0) {
+    res->CellInflow();
+    res->CellOutflow();
+  }
+  if (flow_workers) res->FlowAll(*flow_workers);
+  else res->FlowAll();
+  res->StateAll();
+  // BDB: resource_count[i] = res->SumAll();
+}
+
+
+/* Run the complete update pipeline of one independent spatial resource */
+
+class cSpatialResourceJob : public cUpdateWorkerPool::Job
+{
+private:
+  const cResourceCount& m_rc;
+
+public:
+  cSpatialResourceJob(const cResourceCount& rc) : m_rc(rc) { ; }
+
+  void Run(cAvidaContext& ctx, int job_id) { m_rc.updateSpatialResource(ctx, m_rc.m_spatial_batch[job_id]); }
+};
+
+void cResourceCount::updateSpatialBatch(cAvidaContext& ctx) const
+{
+  const int num_batched = m_spatial_batch.GetSize();
+  if (num_batched == 0) return;
+
+  // Resources share no state, so each is handed to a worker whole.  When there are too few of them to occupy the
+  // pool, large grids are instead updated one at a time with their diffusion split into row bands.
+  int max_cells = 0;
+  for (int i = 0; i < num_batched; i++) max_cells = Apto::Max(max_cells, spatial_resource_count[m_spatial_batch[i]]->GetSize());
+
+  if (num_batched < m_workers->GetNumWorkers() && max_cells >= m_min_tiled_cells) {
+    for (int i = 0; i < num_batched; i++) updateSpatialResource(ctx, m_spatial_batch[i], m_workers);
+  } else if (num_batched == 1) {
+    updateSpatialResource(ctx, m_spatial_batch[0]);
+  } else {
+    cSpatialResourceJob job(*this);
+    m_workers->Execute(job, num_batched);
   }
+
+  m_spatial_batch.Resize(0);
 }
 
 void cResourceCount::ReinitializeResources(cAvidaContext& ctx, double additional_resource)
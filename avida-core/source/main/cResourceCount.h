@@ -28,14 +28,19 @@
 #include "cSpatialResCount.h"
 #include "cString.h"
 #include "cAvidaContext.h"
+#include "cResourceView.h"
 #include "tMatrix.h"
 #include "nGeometry.h"
 
+class cUpdateWorkerPool;
 class cWorld;
 
 
 class cResourceCount
 {
+  friend class cSpatialResourceJob;
+  friend class cResourceView;
+
 private:
   mutable Apto::Array<cString> resource_name;
   mutable Apto::Array<double> resource_initial;  // Initial quantity of each resource
@@ -56,8 +61,21 @@ private:
   mutable double spatial_update_time;
   mutable int m_last_updated;
   mutable int m_spatial_update;
+  
+  // Optional shared clock (see AttachElapsedClock), elapsed time is credited to update_time lazily
+  const double* m_elapsed_clock;
+  mutable double m_elapsed_synced;
+  
+  void syncElapsedClock() const;
+
+  // Optional worker threads for the per-update spatial resource pipelines (see SetWorkerPool)
+  cUpdateWorkerPool* m_workers;
+  int m_min_tiled_cells;          // Smallest grid whose diffusion is split across the workers
+  mutable Apto::Array<int> m_spatial_batch;
 
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
+  void updateSpatialResource(cAvidaContext& ctx, int res_index, cUpdateWorkerPool* flow_workers = NULL) const;
+  void updateSpatialBatch(cAvidaContext& ctx) const;
 
   // A few constants to describe update process...
   static const double UPDATE_STEP;   // Fraction of an update per step
@@ -127,11 +145,23 @@ public:
   void SetDecay(const cString& name, const double _decay);
   
   void Update(double in_time);
+  
+  // Let this count draw elapsed time from an externally advanced clock rather than per-step calls to Update().
+  // Time is credited the next time the resources are brought up to date.  RestartElapsedClock must be called
+  // immediately before the owner resets the clock to zero.
+  void AttachElapsedClock(const double* clock) { m_elapsed_clock = clock; m_elapsed_synced = (clock) ? *clock : 0.0; }
+  void RestartElapsedClock() { syncElapsedClock(); m_elapsed_synced = 0.0; }
+
+  // Run independent spatial resources (and single grids of at least 'min_tiled_cells', in row bands) on the supplied
+  // workers.  Results are identical to the serial update.  The pool is not owned, and is not carried over by copies.
+  void SetWorkerPool(cUpdateWorkerPool* workers, int min_tiled_cells)
+    { m_workers = workers; m_min_tiled_cells = min_tiled_cells; }
 
   int GetSize(void) const { return resource_count.GetSize(); }
   const Apto::Array<double>& ReadResources(void) const { return resource_count; }
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const; 
   const Apto::Array<double>& GetCellResources(int cell_id, cAvidaContext& ctx) const;
+  cResourceView GetCellResourceView(cAvidaContext& ctx, int cell_id) const;
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const;
   double GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const;
   double GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const;
@@ -0,0 +1,65 @@
+/*
+ *  cResourceView.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cResourceView.h"
+
+#include "cResourceCount.h"
+#include "nGeometry.h"
+
+#include <cassert>
+
+
+cResourceView::cResourceView(const cResourceCount& res_count, int cell_id)
+  : m_array(NULL), m_res_count(&res_count), m_cell_id(cell_id), m_num_resources(res_count.GetSize()), m_deme_res(NULL)
+  , m_cell_id_lists(NULL), m_list_cell_id(-1), m_direct(false)
+{
+}
+
+
+double cResourceView::lookup(int res_id) const
+{
+  assert(res_id >= 0 && res_id < GetSize());
+  
+  // Resources limited to a list of cells are unavailable everywhere else
+  if (m_cell_id_lists && res_id < m_cell_id_lists->GetSize()) {
+    const Apto::Array<int>& cells = (*m_cell_id_lists)[res_id];
+    if (cells.GetSize()) {
+      int i = 0;
+      while (i < cells.GetSize() && cells[i] != m_list_cell_id) i++;
+      if (i == cells.GetSize()) return 0.0;
+    }
+  }
+  
+  if (res_id >= m_num_resources) return (*m_deme_res)[res_id - m_num_resources];
+  if (m_array) return (*m_array)[res_id];
+  
+  const cResourceCount& res_count = *m_res_count;
+  const int geometry = res_count.geometry[res_id];
+  if (geometry == nGeometry::GLOBAL || geometry == nGeometry::PARTIAL) return res_count.resource_count[res_id];
+  return res_count.spatial_resource_count[res_id]->GetAmount(m_cell_id);
+}
+
+
+void cResourceView::CopyTo(Apto::Array<double>& res) const
+{
+  const int num_resources = GetSize();
+  res.Resize(num_resources);
+  for (int i = 0; i < num_resources; i++) res[i] = (*this)[i];
+}
@@ -0,0 +1,71 @@
+/*
+ *  cResourceView.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cResourceView_h
+#define cResourceView_h
+
+#include "avida/Avida.h"
+
+class cResourceCount;
+
+
+// cResourceView - read-only view of the resources available at a single cell.
+//
+// A view either wraps an existing array of levels or refers to a cResourceCount and a cell within it.  In the latter
+// case nothing is copied: each level is read from global or spatial storage only when it is asked for.  Views are
+// obtained from cResourceCount::GetCellResourceView(), which brings the counts up to date first, and remain valid
+// until the counts are next modified.  Deme resources may be appended after those of the count, and access may be
+// restricted by per-resource cell lists, matching the combined array built for task tests.
+
+class cResourceView
+{
+private:
+  const Apto::Array<double>* m_array;
+  const cResourceCount* m_res_count;
+  int m_cell_id;
+  int m_num_resources;
+  const Apto::Array<double>* m_deme_res;
+  const Apto::Array<Apto::Array<int> >* m_cell_id_lists;
+  int m_list_cell_id;
+  bool m_direct;
+
+  double lookup(int res_id) const;
+
+public:
+  cResourceView(const Apto::Array<double>& res)
+    : m_array(&res), m_res_count(NULL), m_cell_id(-1), m_num_resources(res.GetSize()), m_deme_res(NULL)
+    , m_cell_id_lists(NULL), m_list_cell_id(-1), m_direct(true) { ; }
+  cResourceView(const cResourceCount& res_count, int cell_id);
+
+  // Levels of 'deme_res' follow those of the viewed resources
+  void AppendDemeResources(const Apto::Array<double>& deme_res) { m_deme_res = &deme_res; m_direct = false; }
+
+  // Resources with a non-empty list in 'cell_id_lists' read as zero unless 'cell_id' is in the list
+  void RestrictToCellLists(const Apto::Array<Apto::Array<int> >& cell_id_lists, int cell_id)
+    { m_cell_id_lists = &cell_id_lists; m_list_cell_id = cell_id; m_direct = false; }
+
+  int GetSize() const { return (m_deme_res) ? m_num_resources + m_deme_res->GetSize() : m_num_resources; }
+  double operator[](int res_id) const { return (m_direct) ? (*m_array)[res_id] : lookup(res_id); }
+
+  // Copy all levels, for callers that need an array they can modify
+  void CopyTo(Apto::Array<double>& res) const;
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "cSpatialResCount.h"
 
 #include "AvidaTools.h"
+#include "cUpdateWorkerPool.h"
 #include "nGeometry.h"
 
 #include <cmath>
@@ -33,50 +34,33 @@ using namespace AvidaTools;
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry, double inxdiffuse, double inydiffuse,
                                    double inxgravity, double inygravity)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_modified(false)
 {
-  int i;
- 
   xdiffuse = inxdiffuse;
   ydiffuse = inydiffuse;
   xgravity = inxgravity;
   ygravity = inygravity;
-  world_x = inworld_x;
-  world_y = inworld_y;
-  geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-  } 
-  SetPointers();
+  ResizeClear(inworld_x, inworld_y, ingeometry);
 }
 
 /* Setup a single spatial resource using default flow amounts  */
 
 cSpatialResCount::cSpatialResCount(int inworld_x, int inworld_y, int ingeometry)
-: grid(inworld_x * inworld_y), m_initial(0.0), m_modified(false)
+: m_initial(0.0), m_modified(false)
 {
-  int i;
- 
   xdiffuse = 1.0;
   ydiffuse = 1.0;
   xgravity = 0.0;
   ygravity = 0.0;
-  world_x = inworld_x;
-  world_y = inworld_y;
-  geometry = ingeometry;
-  num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
+  ResizeClear(inworld_x, inworld_y, ingeometry);
 }
 
 cSpatialResCount::cSpatialResCount() : m_initial(0.0), xdiffuse(1.0), ydiffuse(1.0), xgravity(0.0), ygravity(0.0), m_modified(false)
 {
   geometry = nGeometry::GLOBAL;
+  world_x = 0;
+  world_y = 0;
+  num_cells = 0;
 }
 
 cSpatialResCount::~cSpatialResCount() { ; }
@@ -84,69 +68,18 @@ cSpatialResCount::~cSpatialResCount() { ; }
 
 void cSpatialResCount::ResizeClear(int inworld_x, int inworld_y, int ingeometry)
 {
-  int i;
- 
-  grid.ResizeClear(inworld_x * inworld_y); 
   world_x = inworld_x;
   world_y = inworld_y;
   geometry = ingeometry;
   num_cells = world_x * world_y;
-  for (i = 0; i < GetSize(); i++) {
-    cSpatialCountElem tmpelem;
-    grid[i] = tmpelem;
-   } 
-   SetPointers();
-}
-
-void cSpatialResCount::SetPointers()
-{
-  /* Pointer 0 will point to the cell above and to the left the current cell
-     and will go clockwise around the cell.                               */
-
-  int     i,ii;
-  double  SQRT2 = sqrt(2.0);
-
-  /* First treat all cells like they are in a torus */
-
-  for (i = 0; i < GetSize(); i++) {
-    grid[i].SetPtr(0 ,GridNeighbor(i, world_x, world_y, -1, -1), -1, -1, SQRT2);
-    grid[i].SetPtr(1 ,GridNeighbor(i, world_x, world_y,  0, -1),  0, -1, 1.0);
-    grid[i].SetPtr(2 ,GridNeighbor(i, world_x, world_y, +1, -1), +1, -1, SQRT2);
-    grid[i].SetPtr(3 ,GridNeighbor(i, world_x, world_y, +1,  0), +1,  0, 1.0);
-    grid[i].SetPtr(4 ,GridNeighbor(i, world_x, world_y, +1, +1), +1, +1, SQRT2);
-    grid[i].SetPtr(5 ,GridNeighbor(i, world_x, world_y,  0, +1),  0, +1, 1.0);
-    grid[i].SetPtr(6 ,GridNeighbor(i, world_x, world_y, -1, +1), -1, +1, SQRT2);
-    grid[i].SetPtr(7 ,GridNeighbor(i, world_x, world_y, -1,  0), -1,  0, 1.0);
-  }
- 
-  /* Fix links for top, bottom and sides for non-torus */
-  
-  if (geometry == nGeometry::GRID) {
-    /* Top and bottom */
-
-    for (i = 0; i < world_x; i++) {
-      grid[i].SetPtr(0, -99, -99, -99, -99.0);
-      grid[i].SetPtr(1, -99, -99, -99, -99.0);
-      grid[i].SetPtr(2, -99, -99, -99, -99.0);
-      ii = num_cells-1-i;
-      grid[ii].SetPtr(4, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(5, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(6, -99, -99, -99, -99.0);
-    }
 
-    /* fix links for right and left sides */
-
-    for (i = 0; i < world_y; i++) {
-      ii = i * world_x;    
-      grid[ii].SetPtr(0, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(7, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(6, -99, -99, -99, -99.0);
-      ii = ((i + 1) * world_x) - 1;
-      grid[ii].SetPtr(2, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(3, -99, -99, -99, -99.0);
-      grid[ii].SetPtr(4, -99, -99, -99, -99.0);
-    }
-  }
+  m_amount.ResizeClear(num_cells);
+  m_amount.SetAll(0.0);
+  m_delta.ResizeClear(num_cells);
+  m_delta.SetAll(0.0);
+  m_cell_initial.ResizeClear(num_cells);
+  m_cell_initial.SetAll(0.0);
+  m_flow.ResizeClear(num_cells * 4);
 }
 
 
@@ -222,10 +155,10 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id <= grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       Rate((*cell_list_ptr)[i].GetId(), (*cell_list_ptr)[i].GetInitial());
       State((*cell_list_ptr)[i].GetId());
-      Element(cell_id).SetInitial((*cell_list_ptr)[i].GetInitial());
+      m_cell_initial[cell_id] = (*cell_list_ptr)[i].GetInitial();
     }
   }
 }
@@ -233,8 +166,8 @@ void cSpatialResCount::SetCellList(Apto::Array<cCellResource>* in_cell_list_ptr)
 /* Set the rate variable for one element using the array index */
 
 void cSpatialResCount::Rate(int x, double ratein) const {
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].Rate(ratein);
+  if (x >= 0 && x < num_cells) {
+    m_delta[x] += ratein;
   } else {
     assert(false); // x not valid id
   }
@@ -244,7 +177,7 @@ void cSpatialResCount::Rate(int x, double ratein) const {
 
 void cSpatialResCount::Rate(int x, int y, double ratein) const { 
   if (x >= 0 && x < world_x && y>= 0 && y < world_y) {
-    grid[y * world_x + x].Rate(ratein);
+    m_delta[y * world_x + x] += ratein;
   } else {
     assert(false); // x or y not valid id
   }
@@ -254,8 +187,9 @@ void cSpatialResCount::Rate(int x, int y, double ratein) const {
    the array index */
    
 void cSpatialResCount::State(int x) { 
-  if (x >= 0 && x < grid.GetSize()) {
-    grid[x].State();
+  if (x >= 0 && x < num_cells) {
+    m_amount[x] += m_delta[x];
+    m_delta[x] = 0.0;
   } else {
     assert(false); // x not valid id
   }
@@ -266,7 +200,9 @@ void cSpatialResCount::State(int x) {
    
 void cSpatialResCount::State(int x, int y) { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    grid[y*world_x + x].State();
+    const int cell_id = y * world_x + x;
+    m_amount[cell_id] += m_delta[cell_id];
+    m_delta[cell_id] = 0.0;
   } else {
     assert(false); // x or y not valid id
   }
@@ -275,8 +211,8 @@ void cSpatialResCount::State(int x, int y) {
 /* Get the state of one element using the array index */
 
 double cSpatialResCount::GetAmount(int x) const { 
-  if (x >= 0 && x < grid.GetSize()) {
-    return grid[x].GetAmount(); 
+  if (x >= 0 && x < num_cells) {
+    return m_amount[x];
   } else {
     return -99.9;
   }
@@ -286,7 +222,7 @@ double cSpatialResCount::GetAmount(int x) const {
 
 double cSpatialResCount::GetAmount(int x, int y) const { 
   if (x >= 0 && x < world_x && y >= 0 && y < world_y) {
-    return grid[y*world_x + x].GetAmount(); 
+    return m_amount[y * world_x + x];
   } else {
     return -99.9;
   }
@@ -297,7 +233,7 @@ void cSpatialResCount::RateAll(double ratein) {
   int i;
  
   for (i = 0; i < num_cells; i++) {
-    grid[i].Rate(ratein);
+    m_delta[i] += ratein;
   } 
 }
 
@@ -309,34 +245,262 @@ void cSpatialResCount::StateAll() {
   int i;
  
   for (i = 0; i < num_cells; i++) {
-    grid[i].State();
+    m_amount[i] += m_delta[i];
+    m_delta[i] = 0.0;
   } 
 }
 
+/* Calculate the amount of flow from one cell to its neighbor at offset (XDIST, YDIST).  Amount of flow is a function of:
+
+     1) Amount of material in each cell (will try to equalize)
+     2) Distance between each cell
+     3) x and y "gravity"
+
+   The offset is a template parameter so that the gravity direction tests and the zero terms fold away for each of
+   the four stencil directions, leaving a branch-free expression the compiler can vectorize.  The arithmetic (and
+   its order) is unchanged from the original per-element FlowMatter, so results are bit-for-bit identical. */
+
+template <int XDIST, int YDIST>
+static inline double FlowAmount(double amount1, double amount2, double inxdiffuse, double inydiffuse,
+                                double inxgravity, double inygravity, double dist)
+{
+  const double diff = amount1 - amount2;
+  double xdiffuse = 0.0, xgravity = 0.0, ydiffuse = 0.0, ygravity = 0.0;
+
+  if (XDIST != 0) {
+    /* if there is material to be effected by x gravity */
+    if (((XDIST > 0) && (inxgravity > 0.0)) || ((XDIST < 0) && (inxgravity < 0.0))) {
+      xgravity = amount1 * fabs(inxgravity) / 3.0;
+    } else {
+      xgravity = -amount2 * fabs(inxgravity) / 3.0;
+    }
+
+    /* Diffusion uses the diffusion constant x half the difference (as the
+       elements attempt to equalize) / the number of possible neighbors (8) */
+    xdiffuse = inxdiffuse * diff / 16.0;
+  }
+  if (YDIST != 0) {
+    /* if there is material to be effected by y gravity */
+    if (((YDIST > 0) && (inygravity > 0.0)) || ((YDIST < 0) && (inygravity < 0.0))) {
+      ygravity = amount1 * fabs(inygravity) / 3.0;
+    } else {
+      ygravity = -amount2 * fabs(inygravity) / 3.0;
+    }
+    ydiffuse = inydiffuse * diff / 16.0;
+  }
+
+  return ((xdiffuse + ydiffuse + xgravity + ygravity) / (fabs(XDIST * 1.0) + fabs(YDIST * 1.0))) / dist;
+}
+
+/* Compute the flow from count cells in src to the matching cells in dest, storing the results in flow. */
+
+template <int XDIST, int YDIST>
+static void FlowStencil(const double* src, const double* dest, double* flow, int count, double inxdiffuse,
+                        double inydiffuse, double inxgravity, double inygravity, double dist)
+{
+  for (int i = 0; i < count; i++) {
+    flow[i] = FlowAmount<XDIST, YDIST>(src[i], dest[i], inxdiffuse, inydiffuse, inxgravity, inygravity, dist);
+  }
+}
+
+/* Because flow is two way we must check only half the neighbors to prevent double flow calculations, so each cell
+   flows to its east, south-east, south and south-west neighbors.  The flows for each of these four directions are
+   stored in consecutive blocks of m_flow.  Links that leave the world are computed as if on a torus and simply never
+   applied for the grid geometry. */
+
+void cSpatialResCount::computeFlows(int y_begin, int y_end)
+{
+  const double SQRT2 = sqrt(2.0);
+  const double* amount = &m_amount[0];
+  double* flow_e = &m_flow[0];
+  double* flow_se = flow_e + num_cells;
+  double* flow_s = flow_se + num_cells;
+  double* flow_sw = flow_s + num_cells;
+  const int last_x = world_x - 1;
+
+  // Flow amounts depend only on the current amounts, so they are computed a whole row at a time
+  for (int y = y_begin; y < y_end; y++) {
+    const int row = y * world_x;
+    const double* cur = amount + row;
+    const double* below = amount + ((y + 1) % world_y) * world_x;
+
+    FlowStencil<1, 0>(cur, cur + 1, flow_e + row, last_x, xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+    flow_e[row + last_x] = FlowAmount<1, 0>(cur[last_x], cur[0], xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+
+    FlowStencil<1, 1>(cur, below + 1, flow_se + row, last_x, xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    flow_se[row + last_x] = FlowAmount<1, 1>(cur[last_x], below[0], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+
+    FlowStencil<0, 1>(cur, below, flow_s + row, world_x, xdiffuse, ydiffuse, xgravity, ygravity, 1.0);
+
+    flow_sw[row] = FlowAmount<-1, 1>(cur[0], below[last_x], xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+    FlowStencil<-1, 1>(cur + 1, below, flow_sw + row + 1, last_x, xdiffuse, ydiffuse, xgravity, ygravity, SQRT2);
+  }
+}
+
+/* Move the material, in the same cell and neighbor order as always, so that every delta accumulates its
+   contributions in an identical sequence */
+
+void cSpatialResCount::applyFlows()
+{
+  const bool torus = (geometry != nGeometry::GRID);
+  double* delta = &m_delta[0];
+  const double* flow_e = &m_flow[0];
+  const double* flow_se = flow_e + num_cells;
+  const double* flow_s = flow_se + num_cells;
+  const double* flow_sw = flow_s + num_cells;
+  const int last_x = world_x - 1;
+
+  for (int y = 0; y < world_y; y++) {
+    const int row = y * world_x;
+    const int below = ((y + 1) % world_y) * world_x;
+    const bool has_below = (torus || y < world_y - 1);
+
+    for (int x = 0; x < world_x; x++) {
+      const int i = row + x;
+      const bool has_right = (torus || x < last_x);
+      const bool has_left = (torus || x > 0);
+      const int right = (x < last_x) ? x + 1 : 0;
+      const int left = (x > 0) ? x - 1 : last_x;
+
+      if (has_right) {
+        delta[i] -= flow_e[i];
+        delta[row + right] += flow_e[i];
+      }
+      if (has_right && has_below) {
+        delta[i] -= flow_se[i];
+        delta[below + right] += flow_se[i];
+      }
+      if (has_below) {
+        delta[i] -= flow_s[i];
+        delta[below + x] += flow_s[i];
+      }
+      if (has_left && has_below) {
+        delta[i] -= flow_sw[i];
+        delta[below + left] += flow_sw[i];
+      }
+    }
+  }
+}
+
+/* Same result as applyFlows, but each cell pulls in every flow that touches it and applies them in the order the
+   serial sweep would have.  Only the cell's own delta is written, so disjoint row ranges may run concurrently. */
+
+void cSpatialResCount::gatherFlows(int y_begin, int y_end)
+{
+  const bool torus = (geometry != nGeometry::GRID);
+  double* delta = &m_delta[0];
+  const double* flow = &m_flow[0];
+  const int last_x = world_x - 1;
+  const int last_y = world_y - 1;
+
+  // Ordering key for a single transfer: source cell, then direction, with the source's own decrement first
+  int key[8];
+  double amount[8];
+
+  for (int y = y_begin; y < y_end; y++) {
+    const int row = y * world_x;
+    const int above = ((y > 0) ? y - 1 : last_y) * world_x;
+    const bool has_above = (torus || y > 0);
+    const bool has_below = (torus || y < last_y);
+
+    for (int x = 0; x < world_x; x++) {
+      const int i = row + x;
+      const bool has_right = (torus || x < last_x);
+      const bool has_left = (torus || x > 0);
+      const int right = (x < last_x) ? x + 1 : 0;
+      const int left = (x > 0) ? x - 1 : last_x;
+      int num = 0;
+
+      // Outgoing (direction 0..3 = east, south-east, south, south-west)
+      if (has_right) { key[num] = i * 8 + 0; amount[num++] = -flow[i]; }
+      if (has_right && has_below) { key[num] = i * 8 + 2; amount[num++] = -flow[num_cells + i]; }
+      if (has_below) { key[num] = i * 8 + 4; amount[num++] = -flow[2 * num_cells + i]; }
+      if (has_left && has_below) { key[num] = i * 8 + 6; amount[num++] = -flow[3 * num_cells + i]; }
+
+      // Incoming
+      if (has_left) {
+        const int src = row + left;
+        key[num] = src * 8 + 1; amount[num++] = flow[src];
+      }
+      if (has_above) {
+        if (has_left) {
+          const int src = above + left;
+          key[num] = src * 8 + 3; amount[num++] = flow[num_cells + src];
+        }
+        const int src = above + x;
+        key[num] = src * 8 + 5; amount[num++] = flow[2 * num_cells + src];
+        if (has_right) {
+          const int src = above + right;
+          key[num] = src * 8 + 7; amount[num++] = flow[3 * num_cells + src];
+        }
+      }
+
+      // Insertion sort, the entries are already nearly in order
+      for (int j = 1; j < num; j++) {
+        const int cur_key = key[j];
+        const double cur_amount = amount[j];
+        int k = j - 1;
+        while (k >= 0 && key[k] > cur_key) {
+          key[k + 1] = key[k];
+          amount[k + 1] = amount[k];
+          k--;
+        }
+        key[k + 1] = cur_key;
+        amount[k + 1] = cur_amount;
+      }
+
+      double cell_delta = delta[i];
+      for (int j = 0; j < num; j++) cell_delta += amount[j];
+      delta[i] = cell_delta;
+    }
+  }
+}
+
 void cSpatialResCount::FlowAll() {
 
   // @JEB save time if diffusion and gravity off...
   if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
+  if (num_cells == 0) return;
 
-  int     i,k,ii,xdist,ydist;
-  double  dist;
- 
-  for (i = 0; i < num_cells; i++) {
-      
-    /* because flow is two way we must check only half the neighbors to 
-       prevent double flow calculations */
-
-    for (k = 3; k <= 6; k++) {
-      ii = grid[i].GetElemPtr(k);
-      xdist = grid[i].GetPtrXdist(k);
-      ydist = grid[i].GetPtrYdist(k);
-      dist = grid[i].GetPtrDist(k);
-      if (ii >= 0) {
-        FlowMatter(grid[i],grid[ii],xdiffuse,ydiffuse,xgravity,ygravity,
-                   xdist, ydist, dist);
-      }
-    }
+  computeFlows(0, world_y);
+  applyFlows();
+}
+
+
+/* Run one phase of the tiled flow calculation over a band of rows */
+
+class cSpatialFlowJob : public cUpdateWorkerPool::Job
+{
+private:
+  cSpatialResCount& m_res;
+  int m_num_tiles;
+  bool m_gather;
+
+public:
+  cSpatialFlowJob(cSpatialResCount& res, int num_tiles, bool gather)
+    : m_res(res), m_num_tiles(num_tiles), m_gather(gather) { ; }
+
+  void Run(cAvidaContext&, int job_id)
+  {
+    const int y_begin = (m_res.world_y * job_id) / m_num_tiles;
+    const int y_end = (m_res.world_y * (job_id + 1)) / m_num_tiles;
+    if (m_gather) m_res.gatherFlows(y_begin, y_end);
+    else m_res.computeFlows(y_begin, y_end);
   }
+};
+
+void cSpatialResCount::FlowAll(cUpdateWorkerPool& workers)
+{
+  if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
+  if (num_cells == 0) return;
+
+  const int num_tiles = Apto::Min(world_y, Apto::Max(workers.GetNumWorkers(), 1));
+
+  // All flows must be known before any cell can gather, hence the two batches
+  cSpatialFlowJob compute_job(*this, num_tiles, false);
+  workers.Execute(compute_job, num_tiles);
+  cSpatialFlowJob gather_job(*this, num_tiles, true);
+  workers.Execute(gather_job, num_tiles);
 }
 
 /* Total up all the resources in each cell */
@@ -379,7 +543,7 @@ void cSpatialResCount::CellInflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       Rate(cell_id, (*cell_list_ptr)[i].GetInflow());
     }
   }
@@ -415,7 +579,7 @@ void cSpatialResCount::CellOutflow() const {
     /* Be sure the user entered a valid cell id or if the the program is loading
        the resource for the testCPU that does not have a grid set up */
        
-    if (cell_id >= 0 && cell_id < grid.GetSize()) {
+    if (cell_id >= 0 && cell_id < num_cells) {
       deltaamount = Apto::Max((GetAmount(cell_id) * (*cell_list_ptr)[i].GetOutflow()), 0.0);
     }                     
     Rate((*cell_list_ptr)[i].GetId(), -deltaamount); 
@@ -424,14 +588,14 @@ void cSpatialResCount::CellOutflow() const {
 
 void cSpatialResCount::SetCellAmount(int cell_id, double res)
 {
-  if (cell_id >= 0 && cell_id < grid.GetSize())
+  if (cell_id >= 0 && cell_id < num_cells)
   {
-    Element(cell_id).SetAmount(res);
+    m_amount[cell_id] = res;
   }
 }
 
 
 void cSpatialResCount::ResetResourceCounts()
 {
-  for (int i = 0; i < grid.GetSize(); i++) grid[i].ResetResourceCount(m_initial);
+  for (int i = 0; i < num_cells; i++) m_amount[i] = m_initial + m_cell_initial[i];
 }
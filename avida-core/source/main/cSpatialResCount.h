@@ -25,15 +25,24 @@
 #ifndef cSpatialResCount_h
 #define cSpatialResCount_h
 
+#include "avida/core/Types.h"
+
 #include "cAvidaContext.h"
-#include "cSpatialCountElem.h"
 #include "cResource.h"
 
+class cUpdateWorkerPool;
+
 
 class cSpatialResCount
 {
+  friend class cSpatialFlowJob;
 private:
-  Apto::Array<cSpatialCountElem> grid;
+  // Per-cell state is kept as parallel arrays (indexed by cell id) so that the diffusion kernel in FlowAll walks
+  // contiguous memory.  Neighbors are implied by the grid/torus geometry rather than stored per cell.
+  mutable Apto::Array<double> m_amount;
+  mutable Apto::Array<double> m_delta;
+  Apto::Array<double> m_cell_initial;
+  Apto::Array<double> m_flow; // FlowAll scratch, one block of num_cells for each of the four forward directions
   double m_initial;
   double xdiffuse, ydiffuse;
   double xgravity, ygravity;
@@ -46,6 +55,10 @@ private:
   Apto::Array<cCellResource> *cell_list_ptr;
   bool m_modified;
   
+  void computeFlows(int y_begin, int y_end);
+  void applyFlows();
+  void gatherFlows(int y_begin, int y_end);
+
 public:
   cSpatialResCount();
   cSpatialResCount(int inworld_x, int inworld_y, int ingeometry);
@@ -55,14 +68,12 @@ public:
   virtual ~cSpatialResCount();
   
   void ResizeClear(int inworld_x, int inworld_y, int ingeometry);
-  void SetPointers();
   void CheckRanges();
   void SetCellList(Apto::Array<cCellResource> *in_cell_list_ptr);
-  int GetSize() const { return grid.GetSize(); }
+  int GetSize() const { return m_amount.GetSize(); }
   int GetX() const { return world_x; }
   int GetY() const { return world_y; }
   int GetCellListSize() const { return cell_list_ptr->GetSize(); }
-  cSpatialCountElem& Element(int x) { return grid[x]; }
   void Rate(int x, double ratein) const;
   void Rate(int x, int y, double ratein) const;
   void State(int x);
@@ -72,6 +83,7 @@ public:
   void RateAll(double ratein); 
   virtual void StateAll();
   void FlowAll(); 
+  void FlowAll(cUpdateWorkerPool& workers); // tiled across row bands, identical results to FlowAll()
   double SumAll() const;
   void Source(double amount) const;
   void CellInflow() const;
@@ -94,6 +106,9 @@ public:
   void SetOutflowY1(int in_outflowY1) { outflowY1 = in_outflowY1; }
   void SetOutflowY2(int in_outflowY2) { outflowY2 = in_outflowY2; }
   virtual void UpdateCount(cAvidaContext&) { ; }
+  // True when UpdateCount touches nothing but this resource (no RNG draws, no population access), so that the
+  // whole per-update pipeline for this resource may run on a worker thread
+  virtual bool HasIndependentUpdate() const { return true; }
   void ResetResourceCounts();
   void SetModified(bool in_modified) { m_modified = in_modified; }
   bool GetModified() { return m_modified; }
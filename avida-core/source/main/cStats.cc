@@ -1746,6 +1746,29 @@ void cStats::PrintDivideMutData(const cString& filename)
 }
 
 
+void cStats::PrintTestResultCacheData(const cString& filename)
+{
+  Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
+  cTestResultCache& cache = m_world->GetHardwareManager().GetTestResultCache();
+  
+  df->WriteComment("Avida test-on-divide result cache data");
+  df->WriteComment("Hits and misses are counted since the previous line");
+  df->WriteTimeStamp();
+  
+  const int hits = cache.GetHits();
+  const int misses = cache.GetMisses();
+  df->Write(m_update, "Update");
+  df->Write(hits, "Cache hits");
+  df->Write(misses, "Cache misses");
+  df->Write((hits + misses > 0) ? (double)hits / (double)(hits + misses) : 0.0, "Hit rate");
+  df->Write(cache.GetSize(), "Cached results");
+  df->Write(cache.GetCapacity(), "Cache capacity");
+  df->Endl();
+  
+  cache.ResetCounts();
+}
+
+
 void cStats::PrintSenseData(const cString& filename)
 {
   Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
@@ -2322,6 +2345,12 @@ void cStats::SetGroupAttackInstNames(const cString& inst_set) {
   }
 }
 
+int cStats::GetNumGroupAttackInsts(const cString& inst_set) const
+{
+  Apto::Array<cString> names;
+  return m_group_attack_names.Get(inst_set, names) ? names.GetSize() : 0;
+}
+
 void cStats::PrintGroupAttackData(const cString& filename, const cString& inst_set) {
   Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)filename);
   
@@ -650,6 +650,7 @@ public:
   void RecordDeath() { num_deaths++; }
 
   void IncExecuted() { num_executed++; }
+  void IncExecuted(int num_insts) { num_executed += num_insts; }
 
   void AddNumOrgsKilled(long num) { sum_orgs_killed.Add(num); }
 	void AddNumUnoccupiedCellAttemptedToKill(long num) { sum_unoccupied_cell_kill_attempts.Add(num); }
@@ -823,6 +824,7 @@ public:
   int GetNumTotalPredCreatures() const;
   void SetGroupAttackInstNames(const cString& inst_set);
   Apto::Array<cString>& GetGroupAttackInsts(const cString& inst_set) { return m_group_attack_names[inst_set]; }
+  int GetNumGroupAttackInsts(const cString& inst_set) const; // read only, safe from test CPUs on worker threads
   
   // this value gets recorded when a creature with the particular
   // fitness value gets born. It will never change to a smaller value,
@@ -892,6 +894,7 @@ public:
   void PrintSpatialResData(const cString& filename, int i);
   void PrintTimeData(const cString& filename);
   void PrintDivideMutData(const cString& filename);
+  void PrintTestResultCacheData(const cString& filename);
   void PrintMutationRateData(const cString& filename);
   void PrintSenseData(const cString& filename);
   void PrintSenseExeData(const cString& filename);
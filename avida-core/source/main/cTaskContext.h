@@ -42,6 +42,7 @@ private:
   tBuffer<int>* m_received_messages;
   int m_logic_id;
   bool m_on_divide;
+  bool m_record_stats;
 
   // for optimize tasks actual value of function org is outputting, for all others nothing
   // implemented for now...
@@ -65,6 +66,7 @@ public:
     , m_received_messages(in_received_messages)
     , m_logic_id(0)
     , m_on_divide(in_on_divide)
+    , m_record_stats(true)
     , m_task_entry(NULL)
     , m_task_states(NULL)
   {
@@ -81,6 +83,8 @@ public:
   inline int GetLogicId() const { return m_logic_id; }
   inline void SetLogicId(int v) { m_logic_id = v; }
   inline bool GetOnDivide() const { return m_on_divide; }
+  inline void SetRecordStats(bool v) { m_record_stats = v; }
+  inline bool GetRecordStats() const { return m_record_stats; }
   inline void SetTaskValue(double v) { m_task_value = v; }
   inline double GetTaskValue() { return m_task_value; }
   
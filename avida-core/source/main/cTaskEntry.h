@@ -36,6 +36,9 @@ typedef double (cTaskLib::*tTaskTest)(cTaskContext&) const;
 
 class cTaskEntry
 {
+public:
+  enum { NUM_LOGIC_IDS = 256, LOGIC_MASK_WORDS = NUM_LOGIC_IDS / 32 };
+
 private:
   cString m_name;  // Short keyword for task
   cString m_desc;  // For more human-understandable output...
@@ -44,11 +47,14 @@ private:
   cArgContainer* m_args;
   Apto::String m_prop_id_ave;
   Apto::String m_prop_id_count;
+  bool m_is_logic;                              // Task result depends only on the logic id
+  unsigned int m_logic_mask[LOGIC_MASK_WORDS];  // Bit i set when logic id i satisfies the task
 
 public:
   cTaskEntry(const cString& name, const cString& desc, int in_id, tTaskTest fun, cArgContainer* args)
-    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args)
+    : m_name(name), m_desc(desc), m_id(in_id), m_test_fun(fun), m_args(args), m_is_logic(false)
   {
+    for (int i = 0; i < LOGIC_MASK_WORDS; i++) m_logic_mask[i] = 0;
     m_prop_id_ave = Apto::FormatStr("environment.triggers.%s.average", (const char*)name);
     m_prop_id_count = Apto::FormatStr("environment.triggers.%s.count", (const char*)name);
   }
@@ -62,6 +68,17 @@ public:
   int GetID() const { return m_id; }
   tTaskTest GetTestFun() const { return m_test_fun; }
   
+  bool IsLogicTask() const { return m_is_logic; }
+  bool MatchesLogicId(int logic_id) const
+  {
+    return (logic_id >= 0) && ((m_logic_mask[logic_id >> 5] >> (logic_id & 31)) & 1);
+  }
+  void SetLogicMask(const unsigned int mask[LOGIC_MASK_WORDS])
+  {
+    m_is_logic = true;
+    for (int i = 0; i < LOGIC_MASK_WORDS; i++) m_logic_mask[i] = mask[i];
+  }
+  
   const Apto::String& AveragePropertyID() const { return m_prop_id_ave; }
   const Apto::String& CountPropertyID() const { return m_prop_id_count; }
   
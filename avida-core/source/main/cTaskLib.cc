@@ -93,24 +93,24 @@ cTaskEntry* cTaskLib::AddTask(const cString& name, const cString& info, cEnvReqs
   else if (name == "dontcare")  NewTask(name, "DontCare", &cTaskLib::Task_DontCare);
   
   // All 1- and 2-Input Logic Functions
-  if (name == "not") NewTask(name, "Not", &cTaskLib::Task_Not);
-  else if (name == "not_dup") NewTask(name, "Not_dup", &cTaskLib::Task_Not);
-  else if (name == "nand") NewTask(name, "Nand", &cTaskLib::Task_Nand);
-  else if (name == "nand_dup") NewTask(name, "Nand_dup", &cTaskLib::Task_Nand);
-  else if (name == "and") NewTask(name, "And", &cTaskLib::Task_And);
-  else if (name == "and_dup") NewTask(name, "And_dup", &cTaskLib::Task_And);
-  else if (name == "orn") NewTask(name, "OrNot", &cTaskLib::Task_OrNot);
-  else if (name == "orn_dup") NewTask(name, "OrNot_dup", &cTaskLib::Task_OrNot);
-  else if (name == "or") NewTask(name, "Or", &cTaskLib::Task_Or);
-  else if (name == "or_dup") NewTask(name, "Or_dup", &cTaskLib::Task_Or);
-  else if (name == "andn") NewTask(name, "AndNot", &cTaskLib::Task_AndNot);
-  else if (name == "andn_dup") NewTask(name, "AndNot_dup", &cTaskLib::Task_AndNot);
-  else if (name == "nor") NewTask(name, "Nor", &cTaskLib::Task_Nor);
-  else if (name == "nor_dup") NewTask(name, "Nor_dup", &cTaskLib::Task_Nor);
-  else if (name == "xor") NewTask(name, "Xor", &cTaskLib::Task_Xor);
-  else if (name == "xor_dup") NewTask(name, "Xor_dup", &cTaskLib::Task_Xor);
-  else if (name == "equ") NewTask(name, "Equals", &cTaskLib::Task_Equ);
-  else if (name == "equ_dup") NewTask(name, "Equals_dup", &cTaskLib::Task_Equ);
+  if (name == "not") NewLogicTask(name, "Not", &cTaskLib::Task_Not);
+  else if (name == "not_dup") NewLogicTask(name, "Not_dup", &cTaskLib::Task_Not);
+  else if (name == "nand") NewLogicTask(name, "Nand", &cTaskLib::Task_Nand);
+  else if (name == "nand_dup") NewLogicTask(name, "Nand_dup", &cTaskLib::Task_Nand);
+  else if (name == "and") NewLogicTask(name, "And", &cTaskLib::Task_And);
+  else if (name == "and_dup") NewLogicTask(name, "And_dup", &cTaskLib::Task_And);
+  else if (name == "orn") NewLogicTask(name, "OrNot", &cTaskLib::Task_OrNot);
+  else if (name == "orn_dup") NewLogicTask(name, "OrNot_dup", &cTaskLib::Task_OrNot);
+  else if (name == "or") NewLogicTask(name, "Or", &cTaskLib::Task_Or);
+  else if (name == "or_dup") NewLogicTask(name, "Or_dup", &cTaskLib::Task_Or);
+  else if (name == "andn") NewLogicTask(name, "AndNot", &cTaskLib::Task_AndNot);
+  else if (name == "andn_dup") NewLogicTask(name, "AndNot_dup", &cTaskLib::Task_AndNot);
+  else if (name == "nor") NewLogicTask(name, "Nor", &cTaskLib::Task_Nor);
+  else if (name == "nor_dup") NewLogicTask(name, "Nor_dup", &cTaskLib::Task_Nor);
+  else if (name == "xor") NewLogicTask(name, "Xor", &cTaskLib::Task_Xor);
+  else if (name == "xor_dup") NewLogicTask(name, "Xor_dup", &cTaskLib::Task_Xor);
+  else if (name == "equ") NewLogicTask(name, "Equals", &cTaskLib::Task_Equ);
+  else if (name == "equ_dup") NewLogicTask(name, "Equals_dup", &cTaskLib::Task_Equ);
   
   else if (name == "xor-max") NewTask(name, "Xor-max", &cTaskLib::Task_XorMax);
 	// resoruce dependent version
@@ -118,74 +118,74 @@ cTaskEntry* cTaskLib::AddTask(const cString& name, const cString& info, cEnvReqs
   else if (name == "nor-resourceDependent") NewTask(name, "Nor-resourceDependent", &cTaskLib::Task_Nor_ResourceDependent);
 	
   // All 3-Input Logic Functions
-  if (name == "logic_3AA")      NewTask(name, "Logic 3AA (A+B+C == 0)", &cTaskLib::Task_Logic3in_AA);
-  else if (name == "logic_3AB") NewTask(name, "Logic 3AB (A+B+C == 1)", &cTaskLib::Task_Logic3in_AB);
-  else if (name == "logic_3AC") NewTask(name, "Logic 3AC (A+B+C <= 1)", &cTaskLib::Task_Logic3in_AC);
-  else if (name == "logic_3AD") NewTask(name, "Logic 3AD (A+B+C == 2)", &cTaskLib::Task_Logic3in_AD);
-  else if (name == "logic_3AE") NewTask(name, "Logic 3AE (A+B+C == 0,2)", &cTaskLib::Task_Logic3in_AE);
-  else if (name == "logic_3AF") NewTask(name, "Logic 3AF (A+B+C == 1,2)", &cTaskLib::Task_Logic3in_AF);
-  else if (name == "logic_3AG") NewTask(name, "Logic 3AG (A+B+C <= 2)", &cTaskLib::Task_Logic3in_AG);
-  else if (name == "logic_3AH") NewTask(name, "Logic 3AH (A+B+C == 3)", &cTaskLib::Task_Logic3in_AH);
-  else if (name == "logic_3AI") NewTask(name, "Logic 3AI (A+B+C == 0,3)", &cTaskLib::Task_Logic3in_AI);
-  else if (name == "logic_3AJ") NewTask(name, "Logic 3AJ (A+B+C == 1,3) XOR", &cTaskLib::Task_Logic3in_AJ);
-  else if (name == "logic_3AK") NewTask(name, "Logic 3AK (A+B+C != 2)", &cTaskLib::Task_Logic3in_AK);
-  else if (name == "logic_3AL") NewTask(name, "Logic 3AL (A+B+C >= 2)", &cTaskLib::Task_Logic3in_AL);
-  else if (name == "logic_3AM") NewTask(name, "Logic 3AM (A+B+C != 1)", &cTaskLib::Task_Logic3in_AM);
-  else if (name == "logic_3AN") NewTask(name, "Logic 3AN (A+B+C != 0)", &cTaskLib::Task_Logic3in_AN);
-  else if (name == "logic_3AO") NewTask(name, "Logic 3AO (A & ~B & ~C) [3]", &cTaskLib::Task_Logic3in_AO);
-  else if (name == "logic_3AP") NewTask(name, "Logic 3AP (A^B & ~C)  [3]", &cTaskLib::Task_Logic3in_AP);
-  else if (name == "logic_3AQ") NewTask(name, "Logic 3AQ (A==B & ~C) [3]", &cTaskLib::Task_Logic3in_AQ);
-  else if (name == "logic_3AR") NewTask(name, "Logic 3AR (A & B & ~C) [3]", &cTaskLib::Task_Logic3in_AR);
-  else if (name == "logic_3AS") NewTask(name, "Logic 3AS", &cTaskLib::Task_Logic3in_AS);
-  else if (name == "logic_3AT") NewTask(name, "Logic 3AT", &cTaskLib::Task_Logic3in_AT);
-  else if (name == "logic_3AU") NewTask(name, "Logic 3AU", &cTaskLib::Task_Logic3in_AU);
-  else if (name == "logic_3AV") NewTask(name, "Logic 3AV", &cTaskLib::Task_Logic3in_AV);
-  else if (name == "logic_3AW") NewTask(name, "Logic 3AW", &cTaskLib::Task_Logic3in_AW);
-  else if (name == "logic_3AX") NewTask(name, "Logic 3AX", &cTaskLib::Task_Logic3in_AX);
-  else if (name == "logic_3AY") NewTask(name, "Logic 3AY", &cTaskLib::Task_Logic3in_AY);
-  else if (name == "logic_3AZ") NewTask(name, "Logic 3AZ", &cTaskLib::Task_Logic3in_AZ);
-  else if (name == "logic_3BA") NewTask(name, "Logic 3BA", &cTaskLib::Task_Logic3in_BA);
-  else if (name == "logic_3BB") NewTask(name, "Logic 3BB", &cTaskLib::Task_Logic3in_BB);
-  else if (name == "logic_3BC") NewTask(name, "Logic 3BC", &cTaskLib::Task_Logic3in_BC);
-  else if (name == "logic_3BD") NewTask(name, "Logic 3BD", &cTaskLib::Task_Logic3in_BD);
-  else if (name == "logic_3BE") NewTask(name, "Logic 3BE", &cTaskLib::Task_Logic3in_BE);
-  else if (name == "logic_3BF") NewTask(name, "Logic 3BF", &cTaskLib::Task_Logic3in_BF);
-  else if (name == "logic_3BG") NewTask(name, "Logic 3BG", &cTaskLib::Task_Logic3in_BG);
-  else if (name == "logic_3BH") NewTask(name, "Logic 3BH", &cTaskLib::Task_Logic3in_BH);
-  else if (name == "logic_3BI") NewTask(name, "Logic 3BI", &cTaskLib::Task_Logic3in_BI);
-  else if (name == "logic_3BJ") NewTask(name, "Logic 3BJ", &cTaskLib::Task_Logic3in_BJ);
-  else if (name == "logic_3BK") NewTask(name, "Logic 3BK", &cTaskLib::Task_Logic3in_BK);
-  else if (name == "logic_3BL") NewTask(name, "Logic 3BL", &cTaskLib::Task_Logic3in_BL);
-  else if (name == "logic_3BM") NewTask(name, "Logic 3BM", &cTaskLib::Task_Logic3in_BM);
-  else if (name == "logic_3BN") NewTask(name, "Logic 3BN", &cTaskLib::Task_Logic3in_BN);
-  else if (name == "logic_3BO") NewTask(name, "Logic 3BO", &cTaskLib::Task_Logic3in_BO);
-  else if (name == "logic_3BP") NewTask(name, "Logic 3BP", &cTaskLib::Task_Logic3in_BP);
-  else if (name == "logic_3BQ") NewTask(name, "Logic 3BQ", &cTaskLib::Task_Logic3in_BQ);
-  else if (name == "logic_3BR") NewTask(name, "Logic 3BR", &cTaskLib::Task_Logic3in_BR);
-  else if (name == "logic_3BS") NewTask(name, "Logic 3BS", &cTaskLib::Task_Logic3in_BS);
-  else if (name == "logic_3BT") NewTask(name, "Logic 3BT", &cTaskLib::Task_Logic3in_BT);
-  else if (name == "logic_3BU") NewTask(name, "Logic 3BU", &cTaskLib::Task_Logic3in_BU);
-  else if (name == "logic_3BV") NewTask(name, "Logic 3BV", &cTaskLib::Task_Logic3in_BV);
-  else if (name == "logic_3BW") NewTask(name, "Logic 3BW", &cTaskLib::Task_Logic3in_BW);
-  else if (name == "logic_3BX") NewTask(name, "Logic 3BX", &cTaskLib::Task_Logic3in_BX);
-  else if (name == "logic_3BY") NewTask(name, "Logic 3BY", &cTaskLib::Task_Logic3in_BY);
-  else if (name == "logic_3BZ") NewTask(name, "Logic 3BZ", &cTaskLib::Task_Logic3in_BZ);
-  else if (name == "logic_3CA") NewTask(name, "Logic 3CA", &cTaskLib::Task_Logic3in_CA);
-  else if (name == "logic_3CB") NewTask(name, "Logic 3CB", &cTaskLib::Task_Logic3in_CB);
-  else if (name == "logic_3CC") NewTask(name, "Logic 3CC", &cTaskLib::Task_Logic3in_CC);
-  else if (name == "logic_3CD") NewTask(name, "Logic 3CD", &cTaskLib::Task_Logic3in_CD);
-  else if (name == "logic_3CE") NewTask(name, "Logic 3CE", &cTaskLib::Task_Logic3in_CE);
-  else if (name == "logic_3CF") NewTask(name, "Logic 3CF", &cTaskLib::Task_Logic3in_CF);
-  else if (name == "logic_3CG") NewTask(name, "Logic 3CG", &cTaskLib::Task_Logic3in_CG);
-  else if (name == "logic_3CH") NewTask(name, "Logic 3CH", &cTaskLib::Task_Logic3in_CH);
-  else if (name == "logic_3CI") NewTask(name, "Logic 3CI", &cTaskLib::Task_Logic3in_CI);
-  else if (name == "logic_3CJ") NewTask(name, "Logic 3CJ", &cTaskLib::Task_Logic3in_CJ);
-  else if (name == "logic_3CK") NewTask(name, "Logic 3CK", &cTaskLib::Task_Logic3in_CK);
-  else if (name == "logic_3CL") NewTask(name, "Logic 3CL", &cTaskLib::Task_Logic3in_CL);
-  else if (name == "logic_3CM") NewTask(name, "Logic 3CM", &cTaskLib::Task_Logic3in_CM);
-  else if (name == "logic_3CN") NewTask(name, "Logic 3CN", &cTaskLib::Task_Logic3in_CN);
-  else if (name == "logic_3CO") NewTask(name, "Logic 3CO", &cTaskLib::Task_Logic3in_CO);
-  else if (name == "logic_3CP") NewTask(name, "Logic 3CP", &cTaskLib::Task_Logic3in_CP);
+  if (name == "logic_3AA")      NewLogicTask(name, "Logic 3AA (A+B+C == 0)", &cTaskLib::Task_Logic3in_AA);
+  else if (name == "logic_3AB") NewLogicTask(name, "Logic 3AB (A+B+C == 1)", &cTaskLib::Task_Logic3in_AB);
+  else if (name == "logic_3AC") NewLogicTask(name, "Logic 3AC (A+B+C <= 1)", &cTaskLib::Task_Logic3in_AC);
+  else if (name == "logic_3AD") NewLogicTask(name, "Logic 3AD (A+B+C == 2)", &cTaskLib::Task_Logic3in_AD);
+  else if (name == "logic_3AE") NewLogicTask(name, "Logic 3AE (A+B+C == 0,2)", &cTaskLib::Task_Logic3in_AE);
+  else if (name == "logic_3AF") NewLogicTask(name, "Logic 3AF (A+B+C == 1,2)", &cTaskLib::Task_Logic3in_AF);
+  else if (name == "logic_3AG") NewLogicTask(name, "Logic 3AG (A+B+C <= 2)", &cTaskLib::Task_Logic3in_AG);
+  else if (name == "logic_3AH") NewLogicTask(name, "Logic 3AH (A+B+C == 3)", &cTaskLib::Task_Logic3in_AH);
+  else if (name == "logic_3AI") NewLogicTask(name, "Logic 3AI (A+B+C == 0,3)", &cTaskLib::Task_Logic3in_AI);
+  else if (name == "logic_3AJ") NewLogicTask(name, "Logic 3AJ (A+B+C == 1,3) XOR", &cTaskLib::Task_Logic3in_AJ);
+  else if (name == "logic_3AK") NewLogicTask(name, "Logic 3AK (A+B+C != 2)", &cTaskLib::Task_Logic3in_AK);
+  else if (name == "logic_3AL") NewLogicTask(name, "Logic 3AL (A+B+C >= 2)", &cTaskLib::Task_Logic3in_AL);
+  else if (name == "logic_3AM") NewLogicTask(name, "Logic 3AM (A+B+C != 1)", &cTaskLib::Task_Logic3in_AM);
+  else if (name == "logic_3AN") NewLogicTask(name, "Logic 3AN (A+B+C != 0)", &cTaskLib::Task_Logic3in_AN);
+  else if (name == "logic_3AO") NewLogicTask(name, "Logic 3AO (A & ~B & ~C) [3]", &cTaskLib::Task_Logic3in_AO);
+  else if (name == "logic_3AP") NewLogicTask(name, "Logic 3AP (A^B & ~C)  [3]", &cTaskLib::Task_Logic3in_AP);
+  else if (name == "logic_3AQ") NewLogicTask(name, "Logic 3AQ (A==B & ~C) [3]", &cTaskLib::Task_Logic3in_AQ);
+  else if (name == "logic_3AR") NewLogicTask(name, "Logic 3AR (A & B & ~C) [3]", &cTaskLib::Task_Logic3in_AR);
+  else if (name == "logic_3AS") NewLogicTask(name, "Logic 3AS", &cTaskLib::Task_Logic3in_AS);
+  else if (name == "logic_3AT") NewLogicTask(name, "Logic 3AT", &cTaskLib::Task_Logic3in_AT);
+  else if (name == "logic_3AU") NewLogicTask(name, "Logic 3AU", &cTaskLib::Task_Logic3in_AU);
+  else if (name == "logic_3AV") NewLogicTask(name, "Logic 3AV", &cTaskLib::Task_Logic3in_AV);
+  else if (name == "logic_3AW") NewLogicTask(name, "Logic 3AW", &cTaskLib::Task_Logic3in_AW);
+  else if (name == "logic_3AX") NewLogicTask(name, "Logic 3AX", &cTaskLib::Task_Logic3in_AX);
+  else if (name == "logic_3AY") NewLogicTask(name, "Logic 3AY", &cTaskLib::Task_Logic3in_AY);
+  else if (name == "logic_3AZ") NewLogicTask(name, "Logic 3AZ", &cTaskLib::Task_Logic3in_AZ);
+  else if (name == "logic_3BA") NewLogicTask(name, "Logic 3BA", &cTaskLib::Task_Logic3in_BA);
+  else if (name == "logic_3BB") NewLogicTask(name, "Logic 3BB", &cTaskLib::Task_Logic3in_BB);
+  else if (name == "logic_3BC") NewLogicTask(name, "Logic 3BC", &cTaskLib::Task_Logic3in_BC);
+  else if (name == "logic_3BD") NewLogicTask(name, "Logic 3BD", &cTaskLib::Task_Logic3in_BD);
+  else if (name == "logic_3BE") NewLogicTask(name, "Logic 3BE", &cTaskLib::Task_Logic3in_BE);
+  else if (name == "logic_3BF") NewLogicTask(name, "Logic 3BF", &cTaskLib::Task_Logic3in_BF);
+  else if (name == "logic_3BG") NewLogicTask(name, "Logic 3BG", &cTaskLib::Task_Logic3in_BG);
+  else if (name == "logic_3BH") NewLogicTask(name, "Logic 3BH", &cTaskLib::Task_Logic3in_BH);
+  else if (name == "logic_3BI") NewLogicTask(name, "Logic 3BI", &cTaskLib::Task_Logic3in_BI);
+  else if (name == "logic_3BJ") NewLogicTask(name, "Logic 3BJ", &cTaskLib::Task_Logic3in_BJ);
+  else if (name == "logic_3BK") NewLogicTask(name, "Logic 3BK", &cTaskLib::Task_Logic3in_BK);
+  else if (name == "logic_3BL") NewLogicTask(name, "Logic 3BL", &cTaskLib::Task_Logic3in_BL);
+  else if (name == "logic_3BM") NewLogicTask(name, "Logic 3BM", &cTaskLib::Task_Logic3in_BM);
+  else if (name == "logic_3BN") NewLogicTask(name, "Logic 3BN", &cTaskLib::Task_Logic3in_BN);
+  else if (name == "logic_3BO") NewLogicTask(name, "Logic 3BO", &cTaskLib::Task_Logic3in_BO);
+  else if (name == "logic_3BP") NewLogicTask(name, "Logic 3BP", &cTaskLib::Task_Logic3in_BP);
+  else if (name == "logic_3BQ") NewLogicTask(name, "Logic 3BQ", &cTaskLib::Task_Logic3in_BQ);
+  else if (name == "logic_3BR") NewLogicTask(name, "Logic 3BR", &cTaskLib::Task_Logic3in_BR);
+  else if (name == "logic_3BS") NewLogicTask(name, "Logic 3BS", &cTaskLib::Task_Logic3in_BS);
+  else if (name == "logic_3BT") NewLogicTask(name, "Logic 3BT", &cTaskLib::Task_Logic3in_BT);
+  else if (name == "logic_3BU") NewLogicTask(name, "Logic 3BU", &cTaskLib::Task_Logic3in_BU);
+  else if (name == "logic_3BV") NewLogicTask(name, "Logic 3BV", &cTaskLib::Task_Logic3in_BV);
+  else if (name == "logic_3BW") NewLogicTask(name, "Logic 3BW", &cTaskLib::Task_Logic3in_BW);
+  else if (name == "logic_3BX") NewLogicTask(name, "Logic 3BX", &cTaskLib::Task_Logic3in_BX);
+  else if (name == "logic_3BY") NewLogicTask(name, "Logic 3BY", &cTaskLib::Task_Logic3in_BY);
+  else if (name == "logic_3BZ") NewLogicTask(name, "Logic 3BZ", &cTaskLib::Task_Logic3in_BZ);
+  else if (name == "logic_3CA") NewLogicTask(name, "Logic 3CA", &cTaskLib::Task_Logic3in_CA);
+  else if (name == "logic_3CB") NewLogicTask(name, "Logic 3CB", &cTaskLib::Task_Logic3in_CB);
+  else if (name == "logic_3CC") NewLogicTask(name, "Logic 3CC", &cTaskLib::Task_Logic3in_CC);
+  else if (name == "logic_3CD") NewLogicTask(name, "Logic 3CD", &cTaskLib::Task_Logic3in_CD);
+  else if (name == "logic_3CE") NewLogicTask(name, "Logic 3CE", &cTaskLib::Task_Logic3in_CE);
+  else if (name == "logic_3CF") NewLogicTask(name, "Logic 3CF", &cTaskLib::Task_Logic3in_CF);
+  else if (name == "logic_3CG") NewLogicTask(name, "Logic 3CG", &cTaskLib::Task_Logic3in_CG);
+  else if (name == "logic_3CH") NewLogicTask(name, "Logic 3CH", &cTaskLib::Task_Logic3in_CH);
+  else if (name == "logic_3CI") NewLogicTask(name, "Logic 3CI", &cTaskLib::Task_Logic3in_CI);
+  else if (name == "logic_3CJ") NewLogicTask(name, "Logic 3CJ", &cTaskLib::Task_Logic3in_CJ);
+  else if (name == "logic_3CK") NewLogicTask(name, "Logic 3CK", &cTaskLib::Task_Logic3in_CK);
+  else if (name == "logic_3CL") NewLogicTask(name, "Logic 3CL", &cTaskLib::Task_Logic3in_CL);
+  else if (name == "logic_3CM") NewLogicTask(name, "Logic 3CM", &cTaskLib::Task_Logic3in_CM);
+  else if (name == "logic_3CN") NewLogicTask(name, "Logic 3CN", &cTaskLib::Task_Logic3in_CN);
+  else if (name == "logic_3CO") NewLogicTask(name, "Logic 3CO", &cTaskLib::Task_Logic3in_CO);
+  else if (name == "logic_3CP") NewLogicTask(name, "Logic 3CP", &cTaskLib::Task_Logic3in_CP);
   
   // Arbitrary 1-Input Math Tasks
   else if (name == "math_1AA") NewTask(name, "Math 1AA (2X)", &cTaskLib::Task_Math1in_AA);
@@ -366,17 +366,36 @@ void cTaskLib::NewTask(const cString& name, const cString& desc, tTaskTest task_
 }
 
 
+void cTaskLib::NewLogicTask(const cString& name, const cString& desc, tTaskTest task_fun)
+{
+  NewTask(name, desc, task_fun);
+  
+  // Logic tasks depend on nothing but the logic id, so tabulate the ids that satisfy this one up front
+  tBuffer<int> empty_buf(1);
+  tList<tBuffer<int> > empty_other;
+  Apto::Array<int, Apto::Smart> empty_mem;
+  cTaskContext taskctx(NULL, empty_buf, empty_buf, empty_other, empty_other, empty_mem);
+  
+  unsigned int mask[cTaskEntry::LOGIC_MASK_WORDS] = { 0 };
+  for (int logic_id = 0; logic_id < cTaskEntry::NUM_LOGIC_IDS; logic_id++) {
+    taskctx.SetLogicId(logic_id);
+    if ((this->*task_fun)(taskctx) != 0.0) mask[logic_id >> 5] |= 1u << (logic_id & 31);
+  }
+  task_array[task_array.GetSize() - 1]->SetLogicMask(mask);
+}
+
+
 void cTaskLib::SetupTests(cTaskContext& ctx) const
 {
   const tBuffer<int>& input_buffer = ctx.GetInputBuffer();
   // Collect the inputs in a useful form.
   const int num_inputs = input_buffer.GetNumStored();
-  int test_inputs[3];
+  unsigned int test_inputs[3];
   for (int i = 0; i < 3; i++) {
-    test_inputs[i] = (num_inputs > i) ? input_buffer[i] : 0;
+    test_inputs[i] = (num_inputs > i) ? (unsigned int)input_buffer[i] : 0;
   }
 
-  int test_output = 0;
+  unsigned int test_output = 0;
   if (ctx.GetOutputBuffer().GetNumStored()) test_output = ctx.GetOutputBuffer()[0];
   
   
@@ -387,33 +406,29 @@ void cTaskLib::SetupTests(cTaskContext& ctx) const
   //       Input C: 1 1 1 1 0 0 0 0
   //       Input B: 1 1 0 0 1 1 0 0
   //       Input A: 1 0 1 0 1 0 1 0
+  //
+  // All 32 bit positions are tested at once: select[i][v] has a bit set at every position where input i is v, so
+  // ANDing one selector per input yields the positions exercising a given input combination.  The output must then
+  // be all ones or all zeros over those positions (or the combination was never tested, leaving -1).
   
-  int logic_out[8];
-  for (int i = 0; i < 8; i++) logic_out[i] = -1;
+  const unsigned int select[3][2] = {
+    { ~test_inputs[0], test_inputs[0] },
+    { ~test_inputs[1], test_inputs[1] },
+    { ~test_inputs[2], test_inputs[2] }
+  };
   
-  // Test all input combos!
-  bool func_OK = true;  // Have all outputs been consistant?
-  for (int test_pos = 0; test_pos < 32; test_pos++) {
-    int logic_pos = 0;
-    for (int i = 0; i < 3; i++)  logic_pos += (test_inputs[i] & 1) << i;
+  int logic_out[8];
+  for (int i = 0; i < 8; i++) {
+    const unsigned int positions = select[0][i & 1] & select[1][(i >> 1) & 1] & select[2][(i >> 2) & 1];
+    const unsigned int ones = positions & test_output;
+    const unsigned int zeros = positions & ~test_output;
     
-    if ( logic_out[logic_pos] != -1 &&
-        logic_out[logic_pos] != (test_output & 1) ) {
-      func_OK = false;
-      break;
+    // If there were any inconsistancies, deal with them.
+    if (ones && zeros) {
+      ctx.SetLogicId(-1);
+      return;
     }
-    else {
-      logic_out[logic_pos] = test_output & 1;
-    }
-    
-    test_output >>= 1;
-    for (int i = 0; i < 3; i++) test_inputs[i] >>= 1;
-  }
-  
-  // If there were any inconsistancies, deal with them.
-  if (func_OK == false) {
-    ctx.SetLogicId(-1);
-    return;
+    logic_out[i] = (ones) ? 1 : ((zeros) ? 0 : -1);
   }
   
   // Determine the logic ID number of this task.
@@ -2241,8 +2256,10 @@ void cTaskLib::Load_MatchProdStr(const cString& name, const cString& argstr, cEn
 double cTaskLib::Task_MatchProdStr(cTaskContext& ctx) const
 {
   // These even out the stats tracking.
-  m_world->GetStats().AddTag(ctx.GetTaskEntry()->GetArguments().GetInt(2), 0);
-  m_world->GetStats().AddTag(-1, 0);
+  if (ctx.GetRecordStats()) {
+    m_world->GetStats().AddTag(ctx.GetTaskEntry()->GetArguments().GetInt(2), 0);
+    m_world->GetStats().AddTag(-1, 0);
+  }
 	
   tBuffer<int> temp_buf(ctx.GetOutputBuffer());
   
@@ -2301,7 +2318,7 @@ double cTaskLib::Task_MatchProdStr(cTaskContext& ctx) const
   name = "[produced"; 
   name += string_to_match;
   name += "]";
-  m_world->GetStats().AddStringBitsMatchedValue(name, max_num_matched);
+  if (ctx.GetRecordStats()) m_world->GetStats().AddStringBitsMatchedValue(name, max_num_matched);
   
   // if the organism hasn't donated, then zero out its reputation. 
   if ((ctx.GetOrganism()->GetReputation() > 0) && 
@@ -3531,8 +3548,10 @@ double cTaskLib::Task_CreatePerfectStrings(cTaskContext& ctx) const
   } 
   
   // Update stats
-  m_world->GetStats().IncPerfectMatch(min);
-  if (min > 0) m_world->GetStats().IncPerfectMatchOrg();
+  if (ctx.GetRecordStats()) {
+    m_world->GetStats().IncPerfectMatch(min);
+    if (min > 0) m_world->GetStats().IncPerfectMatchOrg();
+  }
   
   return bonus; 
 }
@@ -0,0 +1,117 @@
+/*
+ *  cUpdateWorkerPool.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cUpdateWorkerPool.h"
+
+#include "apto/rng.h"
+
+#include "cAvidaContext.h"
+#include "cWorld.h"
+
+
+cUpdateWorkerPool::cUpdateWorkerPool(cWorld* world, int num_workers)
+: m_world(world), m_job(NULL), m_seeds(NULL), m_num_jobs(0), m_next_job(0), m_pending(0), m_terminate(false)
+{
+  if (num_workers > 1) {
+    m_workers.Resize(num_workers);
+    for (int i = 0; i < m_workers.GetSize(); i++) {
+      m_workers[i] = new Worker(this);
+      m_workers[i]->Start();
+    }
+  }
+}
+
+cUpdateWorkerPool::~cUpdateWorkerPool()
+{
+  m_mutex.Lock();
+  m_terminate = true;
+  m_mutex.Unlock();
+
+  // Signal all workers to check the terminate flag
+  m_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+}
+
+
+void cUpdateWorkerPool::Execute(Job& job, int num_jobs, const int* seeds)
+{
+  if (num_jobs <= 0) return;
+
+  if (m_workers.GetSize() == 0) {
+    // No workers, run every job on the calling thread
+    Apto::RNG::AvidaRNG rng;
+    cAvidaContext ctx(&m_world->GetDriver(), rng);
+    for (int job_id = 0; job_id < num_jobs; job_id++) {
+      if (seeds) rng.ResetSeed(seeds[job_id]);
+      job.Run(ctx, job_id);
+    }
+    return;
+  }
+
+  m_mutex.Lock();
+  m_job = &job;
+  m_seeds = seeds;
+  m_next_job = 0;
+  m_pending = num_jobs;
+  m_num_jobs = num_jobs;
+  m_mutex.Unlock(); // should unlock prior to signaling condition variable
+  m_cond.Broadcast();
+
+  // Wait for all jobs in the batch to complete
+  m_mutex.Lock();
+  while (m_pending > 0) m_term_cond.Wait(m_mutex);
+  m_job = NULL;
+  m_seeds = NULL;
+  m_mutex.Unlock();
+}
+
+
+void cUpdateWorkerPool::Worker::Run()
+{
+  Apto::RNG::AvidaRNG rng;
+  cAvidaContext ctx(&m_pool->m_world->GetDriver(), rng);
+
+  while (1) {
+    m_pool->m_mutex.Lock();
+    while (!m_pool->m_terminate && m_pool->m_next_job >= m_pool->m_num_jobs) {
+      m_pool->m_cond.Wait(m_pool->m_mutex);
+    }
+    if (m_pool->m_terminate) {
+      m_pool->m_mutex.Unlock();
+      break;
+    }
+    const int job_id = m_pool->m_next_job++;
+    Job* job = m_pool->m_job;
+    const int* seeds = m_pool->m_seeds;
+    m_pool->m_mutex.Unlock();
+
+    if (seeds) rng.ResetSeed(seeds[job_id]);
+    job->Run(ctx, job_id);
+
+    m_pool->m_mutex.Lock();
+    int pending = --m_pool->m_pending;
+    m_pool->m_mutex.Unlock();
+    if (!pending) m_pool->m_term_cond.Signal();
+  }
+}
@@ -0,0 +1,90 @@
+/*
+ *  cUpdateWorkerPool.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cUpdateWorkerPool_h
+#define cUpdateWorkerPool_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+
+class cAvidaContext;
+class cWorld;
+
+
+// cUpdateWorkerPool - persistent set of worker threads used to run independent pieces of an update concurrently.
+//
+// Work is submitted as a batch of numbered jobs that are each run exactly once.  Every worker owns its own
+// cAvidaContext and RNG; when seeds are supplied the RNG is reset to seeds[job_id] before the job runs, so the
+// random stream seen by a job depends only on its id and not on which thread happens to pick it up.
+
+class cUpdateWorkerPool
+{
+public:
+  class Job
+  {
+  public:
+    virtual ~Job() { ; }
+    virtual void Run(cAvidaContext& ctx, int job_id) = 0;
+  };
+
+private:
+  class Worker : public Apto::Thread
+  {
+  private:
+    cUpdateWorkerPool* m_pool;
+
+    void Run();
+
+  public:
+    Worker(cUpdateWorkerPool* pool) : m_pool(pool) { ; }
+  };
+  friend class Worker;
+
+
+  cWorld* m_world;
+  Apto::Array<Worker*> m_workers;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;
+  Apto::ConditionVariable m_term_cond;
+
+  Job* m_job;
+  const int* m_seeds;
+  volatile int m_num_jobs;
+  volatile int m_next_job;
+  volatile int m_pending;
+  volatile bool m_terminate;
+
+
+  cUpdateWorkerPool(); // @not_implemented
+  cUpdateWorkerPool(const cUpdateWorkerPool&); // @not_implemented
+  cUpdateWorkerPool& operator=(const cUpdateWorkerPool&); // @not_implemented
+
+public:
+  cUpdateWorkerPool(cWorld* world, int num_workers);
+  ~cUpdateWorkerPool();
+
+  int GetNumWorkers() const { return m_workers.GetSize(); }
+
+  // Run job ids [0, num_jobs), blocking until all have completed.  seeds may be NULL if the jobs draw no random numbers.
+  void Execute(Job& job, int num_jobs, const int* seeds = NULL);
+};
+
+#endif
@@ -21,12 +21,25 @@
 
 #include "ASTree.h"
 
+#include "cASBytecode.h"
 #include "cASTVisitor.h"
 
 
 const sASTypeInfo cASTNode::s_invalid_type(AS_TYPE_INVALID);
 
 
+cASTNode::~cASTNode()
+{
+  delete m_bytecode;
+}
+
+void cASTNode::SetBytecode(cASBytecode* bytecode)
+{
+  delete m_bytecode;
+  m_bytecode = bytecode;
+}
+
+
 void cASTAssignment::Accept(cASTVisitor& visitor) { visitor.VisitAssignment(*this); }
 void cASTArgumentList::Accept(cASTVisitor& visitor) { visitor.VisitArgumentList(*this); }
 void cASTObjectAssignment::Accept(cASTVisitor& visitor) { visitor.VisitObjectAssignment(*this); }
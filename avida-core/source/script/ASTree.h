@@ -30,6 +30,7 @@
 #include "tList.h"
 
 
+class cASBytecode;
 class cASFunction;
 class cASTVisitor;
 
@@ -74,17 +75,22 @@ private:
   
 protected:
   cASFilePosition m_file_pos;
+  cASBytecode* m_bytecode;
 
-  cASTNode(const cASFilePosition& fp) : m_file_pos(fp) { ; }
+  cASTNode(const cASFilePosition& fp) : m_file_pos(fp), m_bytecode(NULL) { ; }
 
   
 public:
-  virtual ~cASTNode() { ; }
+  virtual ~cASTNode();
   
   virtual const sASTypeInfo& GetType() const { return s_invalid_type; }
 
   inline const cASFilePosition& GetFilePosition() const { return m_file_pos; }
   
+  // Compiled form of this node, if any (see cCompileASTVisitor).  The node takes ownership.
+  inline cASBytecode* GetBytecode() const { return m_bytecode; }
+  void SetBytecode(cASBytecode* bytecode);
+  
   virtual bool IsOutputSuppressed() const { return false; }
   virtual void SuppressOutput() { ; }
   
@@ -0,0 +1,70 @@
+/*
+ *  cASBytecode.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cASBytecode.h"
+
+#include <cassert>
+
+
+int cASBytecode::AddBinding(int var_id, bool global, ASType_t type)
+{
+  sBinding binding;
+  binding.reg = AddRegister();
+  binding.var_id = var_id;
+  binding.global = global;
+  binding.stored = false;
+  binding.type = type;
+  m_bindings.Push(binding);
+  return m_bindings.GetSize() - 1;
+}
+
+
+int cASBytecode::AddConstant(uRegister value)
+{
+  sConstant constant;
+  constant.reg = AddRegister();
+  constant.value = value;
+  m_constants.Push(constant);
+  return constant.reg;
+}
+
+
+int cASBytecode::Emit(eOpcode op, int dst, int a, int b, cASTNode* error_site)
+{
+  sInstruction inst;
+  inst.op = op;
+  inst.dst = dst;
+  inst.a = a;
+  inst.b = b;
+  m_program.Push(inst);
+  m_error_sites.Push(error_site);
+  return m_program.GetSize() - 1;
+}
+
+
+void cASBytecode::PatchTarget(int addr, int target)
+{
+  sInstruction& inst = m_program[addr];
+  switch (inst.op) {
+    case OP_JMP:        inst.a = target; break;
+    case OP_JMP_FALSE:  inst.b = target; break;
+    default:            assert(false);
+  }
+}
@@ -0,0 +1,138 @@
+/*
+ *  cASBytecode.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cASBytecode_h
+#define cASBytecode_h
+
+#include "apto/core.h"
+
+#include "AvidaScript.h"
+
+class cASTNode;
+
+
+// Opcode list.  Operands are register indices unless noted; 'a' and 'b' are the sources and 'dst' the destination.
+//   JMP           - jump to instruction a
+//   JMP_FALSE     - jump to instruction b if bool register a is false
+//   RANGE_SIZE    - number of elements in the range from int register a to int register a + 1
+//   RANGE_VALUE   - element b (an int register) of the range starting at int register a
+#define AS_BYTECODE_OPCODES(OP) \
+  OP(HALT) OP(JMP) OP(JMP_FALSE) OP(MOV) \
+  OP(BOOL_FROM_CHAR) OP(BOOL_FROM_INT) OP(BOOL_FROM_FLOAT) \
+  OP(CHAR_FROM_BOOL) OP(CHAR_FROM_INT) \
+  OP(INT_FROM_BOOL) OP(INT_FROM_CHAR) OP(INT_FROM_FLOAT) \
+  OP(FLOAT_FROM_BOOL) OP(FLOAT_FROM_CHAR) OP(FLOAT_FROM_INT) \
+  OP(ADD_CHAR) OP(ADD_INT) OP(ADD_FLOAT) \
+  OP(SUB_CHAR) OP(SUB_INT) OP(SUB_FLOAT) \
+  OP(MUL_CHAR) OP(MUL_INT) OP(MUL_FLOAT) \
+  OP(DIV_CHAR) OP(DIV_INT) OP(DIV_FLOAT) \
+  OP(MOD_CHAR) OP(MOD_INT) OP(MOD_FLOAT) \
+  OP(BIT_AND_CHAR) OP(BIT_AND_INT) OP(BIT_OR_CHAR) OP(BIT_OR_INT) OP(BIT_NOT_CHAR) OP(BIT_NOT_INT) \
+  OP(NEG_CHAR) OP(NEG_INT) OP(NEG_FLOAT) \
+  OP(LOGIC_NOT) OP(LOGIC_AND) OP(LOGIC_OR) \
+  OP(EQ_BOOL) OP(NEQ_BOOL) \
+  OP(EQ_INT) OP(NEQ_INT) OP(LT_INT) OP(LE_INT) OP(GT_INT) OP(GE_INT) \
+  OP(EQ_FLOAT) OP(NEQ_FLOAT) OP(LT_FLOAT) OP(LE_FLOAT) OP(GT_FLOAT) OP(GE_FLOAT) \
+  OP(RANGE_SIZE) OP(RANGE_VALUE)
+
+
+// cASBytecode - compiled form of an AvidaScript loop, executed by cDirectInterpretASTVisitor in place of the tree.
+//
+// Programs are produced by cCompileASTVisitor for loops whose statements only involve scalar (bool, char, int and
+// float) values.  Every script variable touched by the loop is bound to a register, loaded from the call stack when
+// the program starts and, if the program assigns it, written back when it halts.  Literals are held in registers that
+// are initialized from the constant table.  Instructions that can fail record the tree node used to report the error.
+
+class cASBytecode
+{
+public:
+  enum eOpcode {
+#define AS_BYTECODE_ENUM(NAME) OP_ ## NAME,
+    AS_BYTECODE_OPCODES(AS_BYTECODE_ENUM)
+#undef AS_BYTECODE_ENUM
+    NUM_OPCODES
+  };
+
+  typedef union {
+    bool as_bool;
+    char as_char;
+    int as_int;
+    double as_float;
+  } uRegister;
+
+  struct sInstruction
+  {
+    int op;
+    int dst;
+    int a;
+    int b;
+  };
+
+  struct sBinding
+  {
+    int reg;
+    int var_id;
+    bool global;
+    bool stored;
+    ASType_t type;
+  };
+
+  struct sConstant
+  {
+    int reg;
+    uRegister value;
+  };
+
+private:
+  Apto::Array<sInstruction> m_program;
+  Apto::Array<cASTNode*> m_error_sites;
+  Apto::Array<sBinding> m_bindings;
+  Apto::Array<sConstant> m_constants;
+  int m_num_registers;
+
+
+  cASBytecode(const cASBytecode&); // @not_implemented
+  cASBytecode& operator=(const cASBytecode&); // @not_implemented
+
+public:
+  cASBytecode() : m_num_registers(0) { ; }
+
+  int AddRegister() { return m_num_registers++; }
+  int AddBinding(int var_id, bool global, ASType_t type);
+  int AddConstant(uRegister value);
+
+  int Emit(eOpcode op, int dst, int a = 0, int b = 0, cASTNode* error_site = NULL);
+  int GetNextAddress() const { return m_program.GetSize(); }
+  void PatchTarget(int addr, int target);
+
+  int GetNumRegisters() const { return m_num_registers; }
+  int GetSize() const { return m_program.GetSize(); }
+  const sInstruction* GetProgram() const { return &m_program[0]; }
+  cASTNode* GetErrorSite(int addr) const { return m_error_sites[addr]; }
+
+  int GetNumBindings() const { return m_bindings.GetSize(); }
+  const sBinding& GetBinding(int idx) const { return m_bindings[idx]; }
+  void SetBindingStored(int idx) { m_bindings[idx].stored = true; }
+
+  int GetNumConstants() const { return m_constants.GetSize(); }
+  const sConstant& GetConstant(int idx) const { return m_constants[idx]; }
+};
+
+#endif
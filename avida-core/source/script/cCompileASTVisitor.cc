@@ -0,0 +1,613 @@
+/*
+ *  cCompileASTVisitor.cc
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cCompileASTVisitor.h"
+
+#include <cassert>
+
+#include "cSymbolTable.h"
+
+
+#define TOKEN(x) AS_TOKEN_ ## x
+#define TYPE(x) AS_TYPE_ ## x
+#define OP(x) cASBytecode::OP_ ## x
+
+
+static cASBytecode::eOpcode conversionOp(ASType_t from, ASType_t to)
+{
+  switch (to) {
+    case TYPE(BOOL):
+      if (from == TYPE(CHAR)) return OP(BOOL_FROM_CHAR);
+      if (from == TYPE(INT)) return OP(BOOL_FROM_INT);
+      if (from == TYPE(FLOAT)) return OP(BOOL_FROM_FLOAT);
+      break;
+    case TYPE(CHAR):
+      // Float to char is a cast error in the interpreter
+      if (from == TYPE(BOOL)) return OP(CHAR_FROM_BOOL);
+      if (from == TYPE(INT)) return OP(CHAR_FROM_INT);
+      break;
+    case TYPE(INT):
+      if (from == TYPE(BOOL)) return OP(INT_FROM_BOOL);
+      if (from == TYPE(CHAR)) return OP(INT_FROM_CHAR);
+      if (from == TYPE(FLOAT)) return OP(INT_FROM_FLOAT);
+      break;
+    case TYPE(FLOAT):
+      if (from == TYPE(BOOL)) return OP(FLOAT_FROM_BOOL);
+      if (from == TYPE(CHAR)) return OP(FLOAT_FROM_CHAR);
+      if (from == TYPE(INT)) return OP(FLOAT_FROM_INT);
+      break;
+    default:
+      break;
+  }
+
+  return cASBytecode::NUM_OPCODES;
+}
+
+static cASBytecode::eOpcode typedOp(ASType_t type, cASBytecode::eOpcode char_op, cASBytecode::eOpcode int_op,
+                                    cASBytecode::eOpcode float_op)
+{
+  switch (type) {
+    case TYPE(CHAR):  return char_op;
+    case TYPE(INT):   return int_op;
+    case TYPE(FLOAT): return float_op;
+    default:          return cASBytecode::NUM_OPCODES;
+  }
+}
+
+
+cCompileASTVisitor::cCompileASTVisitor(cSymbolTable* global_symtbl)
+  : m_global_symtbl(global_symtbl), m_cur_symtbl(global_symtbl), m_code(NULL), m_failed(false), m_result_reg(-1)
+  , m_result_type(TYPE(INVALID)), m_num_compiled(0)
+{
+}
+
+
+void cCompileASTVisitor::Compile()
+{
+  compileFunctions(m_global_symtbl);
+  m_cur_symtbl = m_global_symtbl;
+}
+
+
+void cCompileASTVisitor::compileFunctions(cSymbolTable* symtbl)
+{
+  for (int fun_id = 0; fun_id < symtbl->GetNumFunctions(); fun_id++) {
+    // The main program is registered with the global table as a function without a symbol table of its own
+    cSymbolTable* fun_symtbl = symtbl->GetFunctionSymbolTable(fun_id);
+    m_cur_symtbl = (fun_symtbl) ? fun_symtbl : m_global_symtbl;
+    findLoops(symtbl->GetFunctionDefinition(fun_id));
+    if (fun_symtbl) compileFunctions(fun_symtbl);
+  }
+}
+
+
+void cCompileASTVisitor::findLoops(cASTNode* node)
+{
+  if (!node) return;
+
+  if (cASTStatementList* list = dynamic_cast<cASTStatementList*>(node)) {
+    tListIterator<cASTNode> it = list->Iterator();
+    cASTNode* stmt = NULL;
+    while ((stmt = it.Next())) findLoops(stmt);
+  } else if (cASTIfBlock* block = dynamic_cast<cASTIfBlock*>(node)) {
+    findLoops(block->GetCode());
+    tListIterator<cASTIfBlock::cElseIf> it = block->ElseIfIterator();
+    cASTIfBlock::cElseIf* ei = NULL;
+    while ((ei = it.Next())) findLoops(ei->GetCode());
+    findLoops(block->GetElseCode());
+  } else if (cASTWhileBlock* block = dynamic_cast<cASTWhileBlock*>(node)) {
+    if (!compileLoop(*block)) findLoops(block->GetCode());
+  } else if (cASTForeachBlock* block = dynamic_cast<cASTForeachBlock*>(node)) {
+    if (!compileLoop(*block)) findLoops(block->GetCode());
+  }
+}
+
+
+bool cCompileASTVisitor::compileLoop(cASTNode& loop)
+{
+  m_code = new cASBytecode;
+  m_var_bindings.Clear();
+  m_failed = false;
+
+  loop.Accept(*this);
+
+  if (m_failed) {
+    delete m_code;
+    m_code = NULL;
+    return false;
+  }
+
+  m_code->Emit(OP(HALT), 0);
+  loop.SetBytecode(m_code);
+  m_code = NULL;
+  m_num_compiled++;
+  return true;
+}
+
+
+
+void cCompileASTVisitor::VisitAssignment(cASTAssignment& node)
+{
+  cSymbolTable* symtbl = node.IsVarGlobal() ? m_global_symtbl : m_cur_symtbl;
+  ASType_t type = symtbl->GetVariableType(node.GetVarID()).type;
+  if (!isScalar(type)) {
+    m_failed = true;
+    return;
+  }
+
+  node.GetExpression()->Accept(*this);
+  if (m_failed) return;
+
+  convertInto(variableRegister(node.GetVarID(), node.IsVarGlobal(), type, true), m_result_reg, m_result_type, type);
+}
+
+
+void cCompileASTVisitor::VisitArgumentList(cASTArgumentList& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitObjectAssignment(cASTObjectAssignment& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitReturnStatement(cASTReturnStatement& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitStatementList(cASTStatementList& node)
+{
+  tListIterator<cASTNode> it = node.Iterator();
+
+  cASTNode* stmt = NULL;
+  while (!m_failed && (stmt = it.Next())) stmt->Accept(*this);
+}
+
+
+
+void cCompileASTVisitor::VisitForeachBlock(cASTForeachBlock& node)
+{
+  cASTVariableDefinition* var = node.GetVariable();
+  ASType_t var_type = var->GetType().type;
+  cASTExpressionBinary* range = dynamic_cast<cASTExpressionBinary*>(node.GetValues());
+  if (!isScalar(var_type) || !range || range->GetOperator() != TOKEN(ARR_RANGE)) {
+    m_failed = true;
+    return;
+  }
+
+  range->GetLeft()->Accept(*this);
+  if (m_failed) return;
+  const int lreg = m_result_reg;
+  const ASType_t ltype = m_result_type;
+  range->GetRight()->Accept(*this);
+  if (m_failed) return;
+
+  // The bounds are copied, since the interpreter builds the whole range before the body can change them
+  const int first = m_code->AddRegister();
+  const int last = m_code->AddRegister();
+  assert(last == first + 1);
+  convertInto(first, lreg, ltype, TYPE(INT));
+  convertInto(last, m_result_reg, m_result_type, TYPE(INT));
+
+  const int size = m_code->AddRegister();
+  const int idx = m_code->AddRegister();
+  const int cond = m_code->AddRegister();
+  const int value = m_code->AddRegister();
+  const int var_reg = variableRegister(var->GetVarID(), false, var_type, true);
+  m_code->Emit(OP(RANGE_SIZE), size, first);
+  m_code->Emit(OP(MOV), idx, intConstant(0));
+
+  const int top = m_code->Emit(OP(LT_INT), cond, idx, size);
+  const int exit_jump = m_code->Emit(OP(JMP_FALSE), 0, cond);
+  m_code->Emit(OP(RANGE_VALUE), value, first, idx);
+  convertInto(var_reg, value, TYPE(INT), var_type);
+
+  node.GetCode()->Accept(*this);
+  if (m_failed) return;
+
+  m_code->Emit(OP(ADD_INT), idx, idx, intConstant(1));
+  m_code->Emit(OP(JMP), 0, top);
+  m_code->PatchTarget(exit_jump, m_code->GetNextAddress());
+}
+
+
+void cCompileASTVisitor::VisitIfBlock(cASTIfBlock& node)
+{
+  Apto::Array<int> end_jumps;
+
+  node.GetCondition()->Accept(*this);
+  int cond = convert(m_result_reg, m_result_type, TYPE(BOOL));
+  if (m_failed) return;
+  int next_jump = m_code->Emit(OP(JMP_FALSE), 0, cond);
+  node.GetCode()->Accept(*this);
+  if (m_failed) return;
+  end_jumps.Push(m_code->Emit(OP(JMP), 0));
+
+  tListIterator<cASTIfBlock::cElseIf> it = node.ElseIfIterator();
+  cASTIfBlock::cElseIf* ei = NULL;
+  while ((ei = it.Next())) {
+    m_code->PatchTarget(next_jump, m_code->GetNextAddress());
+    ei->GetCondition()->Accept(*this);
+    cond = convert(m_result_reg, m_result_type, TYPE(BOOL));
+    if (m_failed) return;
+    next_jump = m_code->Emit(OP(JMP_FALSE), 0, cond);
+    ei->GetCode()->Accept(*this);
+    if (m_failed) return;
+    end_jumps.Push(m_code->Emit(OP(JMP), 0));
+  }
+
+  m_code->PatchTarget(next_jump, m_code->GetNextAddress());
+  if (node.HasElse()) node.GetElseCode()->Accept(*this);
+
+  for (int i = 0; i < end_jumps.GetSize(); i++) m_code->PatchTarget(end_jumps[i], m_code->GetNextAddress());
+}
+
+
+void cCompileASTVisitor::VisitWhileBlock(cASTWhileBlock& node)
+{
+  const int top = m_code->GetNextAddress();
+  node.GetCondition()->Accept(*this);
+  const int cond = convert(m_result_reg, m_result_type, TYPE(BOOL));
+  if (m_failed) return;
+  const int exit_jump = m_code->Emit(OP(JMP_FALSE), 0, cond);
+
+  node.GetCode()->Accept(*this);
+  if (m_failed) return;
+
+  m_code->Emit(OP(JMP), 0, top);
+  m_code->PatchTarget(exit_jump, m_code->GetNextAddress());
+}
+
+
+
+void cCompileASTVisitor::VisitFunctionDefinition(cASTFunctionDefinition& node)
+{
+  // Function bodies have been moved to the symbol tables, and are compiled separately
+}
+
+
+void cCompileASTVisitor::VisitVariableDefinition(cASTVariableDefinition& node)
+{
+  if (node.GetAssignmentExpression()) {
+    ASType_t type = node.GetType().type;
+    if (!isScalar(type)) {
+      m_failed = true;
+      return;
+    }
+
+    node.GetAssignmentExpression()->Accept(*this);
+    if (m_failed) return;
+
+    convertInto(variableRegister(node.GetVarID(), false, type, true), m_result_reg, m_result_type, type);
+  } else if (node.GetDimensions()) {
+    m_failed = true;
+  }
+
+  // Definitions without an initial value leave the variable untouched, as in the interpreter
+}
+
+
+void cCompileASTVisitor::VisitVariableDefinitionList(cASTVariableDefinitionList& node)
+{
+  m_failed = true;
+}
+
+
+
+void cCompileASTVisitor::VisitExpressionBinary(cASTExpressionBinary& node)
+{
+  node.GetLeft()->Accept(*this);
+  if (m_failed) return;
+  const int lreg = m_result_reg;
+  const ASType_t ltype = m_result_type;
+  node.GetRight()->Accept(*this);
+  if (m_failed) return;
+  const int rreg = m_result_reg;
+  const ASType_t rtype = m_result_type;
+
+  switch (node.GetOperator()) {
+    case TOKEN(OP_LOGIC_AND):
+      emitBinary(OP(LOGIC_AND), TYPE(BOOL), TYPE(BOOL), lreg, ltype, rreg, rtype);
+      break;
+    case TOKEN(OP_LOGIC_OR):
+      emitBinary(OP(LOGIC_OR), TYPE(BOOL), TYPE(BOOL), lreg, ltype, rreg, rtype);
+      break;
+
+    case TOKEN(OP_BIT_AND):
+    case TOKEN(OP_BIT_OR):
+      {
+        ASType_t type = node.GetType().type;
+        cASBytecode::eOpcode op = (node.GetOperator() == TOKEN(OP_BIT_AND)) ?
+          typedOp(type, OP(BIT_AND_CHAR), OP(BIT_AND_INT), cASBytecode::NUM_OPCODES) :
+          typedOp(type, OP(BIT_OR_CHAR), OP(BIT_OR_INT), cASBytecode::NUM_OPCODES);
+        emitBinary(op, type, type, lreg, ltype, rreg, rtype);
+      }
+      break;
+
+    case TOKEN(OP_EQ):
+    case TOKEN(OP_NEQ):
+      {
+        const bool eq = (node.GetOperator() == TOKEN(OP_EQ));
+        switch (node.GetCompareType().type) {
+          case TYPE(BOOL):
+            emitBinary(eq ? OP(EQ_BOOL) : OP(NEQ_BOOL), TYPE(BOOL), TYPE(BOOL), lreg, ltype, rreg, rtype);
+            break;
+          case TYPE(CHAR):
+          case TYPE(INT):
+            // Handle both char and int as integers
+            emitBinary(eq ? OP(EQ_INT) : OP(NEQ_INT), TYPE(INT), TYPE(BOOL), lreg, ltype, rreg, rtype);
+            break;
+          case TYPE(FLOAT):
+            emitBinary(eq ? OP(EQ_FLOAT) : OP(NEQ_FLOAT), TYPE(FLOAT), TYPE(BOOL), lreg, ltype, rreg, rtype);
+            break;
+          default:
+            m_failed = true;
+        }
+      }
+      break;
+
+    case TOKEN(OP_LE):
+    case TOKEN(OP_GE):
+    case TOKEN(OP_LT):
+    case TOKEN(OP_GT):
+      {
+        ASType_t type = node.GetCompareType().type;
+        if (type == TYPE(CHAR)) type = TYPE(INT);
+        const bool as_float = (type == TYPE(FLOAT));
+        cASBytecode::eOpcode op = cASBytecode::NUM_OPCODES;
+        switch (node.GetOperator()) {
+          case TOKEN(OP_LE): op = as_float ? OP(LE_FLOAT) : OP(LE_INT); break;
+          case TOKEN(OP_GE): op = as_float ? OP(GE_FLOAT) : OP(GE_INT); break;
+          case TOKEN(OP_LT): op = as_float ? OP(LT_FLOAT) : OP(LT_INT); break;
+          case TOKEN(OP_GT): op = as_float ? OP(GT_FLOAT) : OP(GT_INT); break;
+          default: break;
+        }
+        if (type != TYPE(INT) && type != TYPE(FLOAT)) op = cASBytecode::NUM_OPCODES;
+        emitBinary(op, type, TYPE(BOOL), lreg, ltype, rreg, rtype);
+      }
+      break;
+
+    case TOKEN(OP_ADD):
+      emitBinary(typedOp(node.GetType().type, OP(ADD_CHAR), OP(ADD_INT), OP(ADD_FLOAT)), node.GetType().type,
+                 node.GetType().type, lreg, ltype, rreg, rtype);
+      break;
+    case TOKEN(OP_SUB):
+      emitBinary(typedOp(node.GetType().type, OP(SUB_CHAR), OP(SUB_INT), OP(SUB_FLOAT)), node.GetType().type,
+                 node.GetType().type, lreg, ltype, rreg, rtype);
+      break;
+    case TOKEN(OP_MUL):
+      emitBinary(typedOp(node.GetType().type, OP(MUL_CHAR), OP(MUL_INT), OP(MUL_FLOAT)), node.GetType().type,
+                 node.GetType().type, lreg, ltype, rreg, rtype);
+      break;
+    case TOKEN(OP_DIV):
+      emitBinary(typedOp(node.GetType().type, OP(DIV_CHAR), OP(DIV_INT), OP(DIV_FLOAT)), node.GetType().type,
+                 node.GetType().type, lreg, ltype, rreg, rtype, &node);
+      break;
+    case TOKEN(OP_MOD):
+      emitBinary(typedOp(node.GetType().type, OP(MOD_CHAR), OP(MOD_INT), OP(MOD_FLOAT)), node.GetType().type,
+                 node.GetType().type, lreg, ltype, rreg, rtype, &node);
+      break;
+
+    default:
+      // Ranges outside of foreach, expansions and indexing produce aggregates
+      m_failed = true;
+  }
+}
+
+
+void cCompileASTVisitor::VisitExpressionUnary(cASTExpressionUnary& node)
+{
+  node.GetExpression()->Accept(*this);
+  if (m_failed) return;
+  const int reg = m_result_reg;
+  const ASType_t type = m_result_type;
+
+  cASBytecode::eOpcode op = cASBytecode::NUM_OPCODES;
+  ASType_t op_type = type;
+  switch (node.GetOperator()) {
+    case TOKEN(OP_BIT_NOT): op = typedOp(type, OP(BIT_NOT_CHAR), OP(BIT_NOT_INT), cASBytecode::NUM_OPCODES); break;
+    case TOKEN(OP_LOGIC_NOT): op = OP(LOGIC_NOT); op_type = TYPE(BOOL); break;
+    case TOKEN(OP_SUB): op = typedOp(type, OP(NEG_CHAR), OP(NEG_INT), OP(NEG_FLOAT)); break;
+    default: break;
+  }
+  if (op == cASBytecode::NUM_OPCODES) {
+    m_failed = true;
+    return;
+  }
+
+  const int src = convert(reg, type, op_type);
+  if (m_failed) return;
+  const int dst = m_code->AddRegister();
+  m_code->Emit(op, dst, src);
+  setResult(dst, op_type);
+}
+
+
+
+void cCompileASTVisitor::VisitBuiltInCall(cASTBuiltInCall& node)
+{
+  ASType_t type = TYPE(INVALID);
+  switch (node.GetBuiltIn()) {
+    case AS_BUILTIN_CAST_BOOL:  type = TYPE(BOOL); break;
+    case AS_BUILTIN_CAST_CHAR:  type = TYPE(CHAR); break;
+    case AS_BUILTIN_CAST_INT:   type = TYPE(INT); break;
+    case AS_BUILTIN_CAST_FLOAT: type = TYPE(FLOAT); break;
+
+    default:
+      m_failed = true;
+      return;
+  }
+
+  node.GetArguments()->Iterator().Next()->Accept(*this);
+  const int reg = convert(m_result_reg, m_result_type, type);
+  if (m_failed) return;
+
+  setResult(reg, type);
+}
+
+
+void cCompileASTVisitor::VisitFunctionCall(cASTFunctionCall& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitLiteral(cASTLiteral& node)
+{
+  cASBytecode::uRegister value;
+  switch (node.GetType().type) {
+    case TYPE(BOOL):  value.as_bool = (node.GetValue() == "true"); break;
+    case TYPE(CHAR):  value.as_char = node.GetValue()[0]; break;
+    case TYPE(INT):   value.as_int = node.GetValue().AsInt(); break;
+    case TYPE(FLOAT): value.as_float = node.GetValue().AsDouble(); break;
+
+    default:
+      m_failed = true;
+      return;
+  }
+
+  setResult(m_code->AddConstant(value), node.GetType().type);
+}
+
+
+void cCompileASTVisitor::VisitLiteralArray(cASTLiteralArray& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitLiteralDict(cASTLiteralDict& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitObjectCall(cASTObjectCall& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitObjectReference(cASTObjectReference& node)
+{
+  m_failed = true;
+}
+
+
+void cCompileASTVisitor::VisitVariableReference(cASTVariableReference& node)
+{
+  ASType_t type = node.GetType().type;
+  if (!isScalar(type)) {
+    m_failed = true;
+    return;
+  }
+
+  setResult(variableRegister(node.GetVarID(), node.IsVarGlobal(), type, false), type);
+}
+
+
+void cCompileASTVisitor::VisitUnpackTarget(cASTUnpackTarget& node)
+{
+  m_failed = true;
+}
+
+
+
+int cCompileASTVisitor::variableRegister(int var_id, bool global, ASType_t type, bool store)
+{
+  // Variables of the main program live at the base of the call stack however they are referenced
+  if (m_cur_symtbl == m_global_symtbl) global = true;
+
+  const int key = (global) ? var_id : -1 - var_id;
+  int idx = -1;
+  if (!m_var_bindings.Get(key, idx)) {
+    idx = m_code->AddBinding(var_id, global, type);
+    m_var_bindings.Set(key, idx);
+  }
+  if (store) m_code->SetBindingStored(idx);
+
+  return m_code->GetBinding(idx).reg;
+}
+
+
+int cCompileASTVisitor::intConstant(int value)
+{
+  cASBytecode::uRegister reg;
+  reg.as_int = value;
+  return m_code->AddConstant(reg);
+}
+
+
+int cCompileASTVisitor::convert(int reg, ASType_t from, ASType_t to)
+{
+  if (m_failed) return -1;
+  if (from == to) return reg;
+
+  const int dst = m_code->AddRegister();
+  convertInto(dst, reg, from, to);
+  return dst;
+}
+
+
+void cCompileASTVisitor::convertInto(int dst, int reg, ASType_t from, ASType_t to)
+{
+  if (m_failed) return;
+
+  if (from == to) {
+    if (dst != reg) m_code->Emit(OP(MOV), dst, reg);
+    return;
+  }
+
+  cASBytecode::eOpcode op = conversionOp(from, to);
+  if (op == cASBytecode::NUM_OPCODES) {
+    m_failed = true;
+    return;
+  }
+  m_code->Emit(op, dst, reg);
+}
+
+
+void cCompileASTVisitor::emitBinary(cASBytecode::eOpcode op, ASType_t op_type, ASType_t ret_type, int lreg,
+                                    ASType_t ltype, int rreg, ASType_t rtype, cASTNode* error_site)
+{
+  if (op == cASBytecode::NUM_OPCODES) {
+    m_failed = true;
+    return;
+  }
+
+  const int l = convert(lreg, ltype, op_type);
+  const int r = convert(rreg, rtype, op_type);
+  if (m_failed) return;
+
+  const int dst = m_code->AddRegister();
+  m_code->Emit(op, dst, l, r, error_site);
+  setResult(dst, ret_type);
+}
+
+
+bool cCompileASTVisitor::isScalar(ASType_t type)
+{
+  return (type == TYPE(BOOL) || type == TYPE(CHAR) || type == TYPE(INT) || type == TYPE(FLOAT));
+}
@@ -0,0 +1,112 @@
+/*
+ *  cCompileASTVisitor.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cCompileASTVisitor_h
+#define cCompileASTVisitor_h
+
+#include "cASBytecode.h"
+#include "cASTVisitor.h"
+
+class cSymbolTable;
+
+
+// cCompileASTVisitor - lowers loops of a semantically checked tree to register bytecode.
+//
+// Each while and foreach loop, in the main program and in every function body (found through the symbol tables), is
+// compiled as a whole if all of its statements can be expressed in cASBytecode; otherwise the loops nested within it
+// are tried in turn.  Compiled programs are attached to their loop node and run by cDirectInterpretASTVisitor, which
+// interprets everything else.  Only statically typed scalar values are supported, and foreach loops only over a range
+// ('l:r') expression; calls, returns, strings and aggregates leave the enclosing loop on the tree.  Code is emitted in
+// the evaluation order of the interpreter, and conversions follow the interpreter's as*() rules, so results are
+// identical.
+
+class cCompileASTVisitor : public cASTVisitor
+{
+private:
+  cSymbolTable* m_global_symtbl;
+  cSymbolTable* m_cur_symtbl;
+
+  cASBytecode* m_code;
+  Apto::Map<int, int> m_var_bindings;
+  bool m_failed;
+
+  int m_result_reg;
+  ASType_t m_result_type;
+
+  int m_num_compiled;
+
+
+  cCompileASTVisitor(); // @not_implemented
+  cCompileASTVisitor(const cCompileASTVisitor&); // @not_implemented
+  cCompileASTVisitor& operator=(const cCompileASTVisitor&); // @not_implemented
+
+public:
+  cCompileASTVisitor(cSymbolTable* global_symtbl);
+
+  void Compile();
+  int GetNumCompiled() const { return m_num_compiled; }
+
+
+  void VisitAssignment(cASTAssignment&);
+  void VisitArgumentList(cASTArgumentList&);
+  void VisitObjectAssignment(cASTObjectAssignment&);
+
+  void VisitReturnStatement(cASTReturnStatement&);
+  void VisitStatementList(cASTStatementList&);
+
+  void VisitForeachBlock(cASTForeachBlock&);
+  void VisitIfBlock(cASTIfBlock&);
+  void VisitWhileBlock(cASTWhileBlock&);
+
+  void VisitFunctionDefinition(cASTFunctionDefinition&);
+  void VisitVariableDefinition(cASTVariableDefinition&);
+  void VisitVariableDefinitionList(cASTVariableDefinitionList&);
+
+  void VisitExpressionBinary(cASTExpressionBinary&);
+  void VisitExpressionUnary(cASTExpressionUnary&);
+
+  void VisitBuiltInCall(cASTBuiltInCall&);
+  void VisitFunctionCall(cASTFunctionCall&);
+  void VisitLiteral(cASTLiteral&);
+  void VisitLiteralArray(cASTLiteralArray&);
+  void VisitLiteralDict(cASTLiteralDict&);
+  void VisitObjectCall(cASTObjectCall&);
+  void VisitObjectReference(cASTObjectReference&);
+  void VisitVariableReference(cASTVariableReference&);
+  void VisitUnpackTarget(cASTUnpackTarget&);
+
+
+private:
+  void compileFunctions(cSymbolTable* symtbl);
+  void findLoops(cASTNode* node);
+  bool compileLoop(cASTNode& loop);
+
+  int variableRegister(int var_id, bool global, ASType_t type, bool store);
+  int intConstant(int value);
+  int convert(int reg, ASType_t from, ASType_t to);
+  void convertInto(int dst, int reg, ASType_t from, ASType_t to);
+  void emitBinary(cASBytecode::eOpcode op, ASType_t op_type, ASType_t ret_type, int lreg, ASType_t ltype, int rreg,
+                  ASType_t rtype, cASTNode* error_site = NULL);
+  void setResult(int reg, ASType_t type) { m_result_reg = reg; m_result_type = type; }
+
+  static bool isScalar(ASType_t type);
+};
+
+#endif
@@ -202,6 +202,11 @@ void cDirectInterpretASTVisitor::VisitStatementList(cASTStatementList& node)
 
 void cDirectInterpretASTVisitor::VisitForeachBlock(cASTForeachBlock& node)
 {
+  if (node.GetBytecode()) {
+    executeBytecode(*node.GetBytecode());
+    return;
+  }
+  
   int var_id = node.GetVariable()->GetVarID();
   sASTypeInfo var_type = node.GetVariable()->GetType();
   
@@ -285,6 +290,11 @@ void cDirectInterpretASTVisitor::VisitIfBlock(cASTIfBlock& node)
 
 void cDirectInterpretASTVisitor::VisitWhileBlock(cASTWhileBlock& node)
 {
+  if (node.GetBytecode()) {
+    executeBytecode(*node.GetBytecode());
+    return;
+  }
+  
   node.GetCondition()->Accept(*this);
   while (asBool(m_rtype, m_rvalue, node)) {
     node.GetCode()->Accept(*this);
@@ -1974,6 +1984,145 @@ ASType_t cDirectInterpretASTVisitor::getRuntimeType(ASType_t ltype, ASType_t rty
 }
 
 
+void cDirectInterpretASTVisitor::executeBytecode(const cASBytecode& code)
+{
+  m_registers.Resize(code.GetNumRegisters());
+  cASBytecode::uRegister* reg = &m_registers[0];
+  
+  for (int i = 0; i < code.GetNumConstants(); i++) reg[code.GetConstant(i).reg] = code.GetConstant(i).value;
+  for (int i = 0; i < code.GetNumBindings(); i++) {
+    const cASBytecode::sBinding& binding = code.GetBinding(i);
+    const uAnyType& value = m_call_stack[(binding.global) ? binding.var_id : m_sp + binding.var_id].value;
+    switch (binding.type) {
+      case TYPE(BOOL):        reg[binding.reg].as_bool = value.as_bool; break;
+      case TYPE(CHAR):        reg[binding.reg].as_char = value.as_char; break;
+      case TYPE(FLOAT):       reg[binding.reg].as_float = value.as_float; break;
+      case TYPE(INT):         reg[binding.reg].as_int = value.as_int; break;
+      default: break;
+    }
+  }
+  
+  const cASBytecode::sInstruction* const program = code.GetProgram();
+  const cASBytecode::sInstruction* ip = program;
+  
+#if defined(__GNUC__)
+  // Threaded dispatch, each handler jumps straight to the handler of the following instruction
+# define AS_BYTECODE_LABEL(NAME) &&BC_ ## NAME,
+  static void* const s_dispatch[] = { AS_BYTECODE_OPCODES(AS_BYTECODE_LABEL) };
+# undef AS_BYTECODE_LABEL
+# define BC_CASE(NAME) BC_ ## NAME:
+# define BC_DISPATCH goto *s_dispatch[ip->op]
+  BC_DISPATCH;
+#else
+# define BC_CASE(NAME) case cASBytecode::OP_ ## NAME:
+# define BC_DISPATCH continue
+  while (true) switch (ip->op) {
+#endif
+#define BC_NEXT ip++; BC_DISPATCH
+#define R(x) reg[ip->x]
+#define BC_CHECK_DIVISOR(x) \
+  if (!(x)) { cASTNode& node = *code.GetErrorSite(ip - program); INTERPRET_ERROR(DIVISION_BY_ZERO); }
+  
+  BC_CASE(HALT)             goto halt;
+  BC_CASE(JMP)              ip = program + ip->a; BC_DISPATCH;
+  BC_CASE(JMP_FALSE)        if (!R(a).as_bool) { ip = program + ip->b; BC_DISPATCH; } BC_NEXT;
+  BC_CASE(MOV)              R(dst) = R(a); BC_NEXT;
+  
+  BC_CASE(BOOL_FROM_CHAR)   R(dst).as_bool = (R(a).as_char != 0); BC_NEXT;
+  BC_CASE(BOOL_FROM_INT)    R(dst).as_bool = (R(a).as_int != 0); BC_NEXT;
+  BC_CASE(BOOL_FROM_FLOAT)  R(dst).as_bool = (R(a).as_float != 0); BC_NEXT;
+  BC_CASE(CHAR_FROM_BOOL)   R(dst).as_char = (R(a).as_bool) ? 1 : 0; BC_NEXT;
+  BC_CASE(CHAR_FROM_INT)    R(dst).as_char = (char)R(a).as_int; BC_NEXT;
+  BC_CASE(INT_FROM_BOOL)    R(dst).as_int = (R(a).as_bool) ? 1 : 0; BC_NEXT;
+  BC_CASE(INT_FROM_CHAR)    R(dst).as_int = (int)R(a).as_char; BC_NEXT;
+  BC_CASE(INT_FROM_FLOAT)   R(dst).as_int = (int)R(a).as_float; BC_NEXT;
+  BC_CASE(FLOAT_FROM_BOOL)  R(dst).as_float = (R(a).as_bool) ? 1.0 : 0.0; BC_NEXT;
+  BC_CASE(FLOAT_FROM_CHAR)  R(dst).as_float = (double)R(a).as_char; BC_NEXT;
+  BC_CASE(FLOAT_FROM_INT)   R(dst).as_float = (double)R(a).as_int; BC_NEXT;
+  
+  BC_CASE(ADD_CHAR)         R(dst).as_char = R(a).as_char + R(b).as_char; BC_NEXT;
+  BC_CASE(ADD_INT)          R(dst).as_int = R(a).as_int + R(b).as_int; BC_NEXT;
+  BC_CASE(ADD_FLOAT)        R(dst).as_float = R(a).as_float + R(b).as_float; BC_NEXT;
+  BC_CASE(SUB_CHAR)         R(dst).as_char = R(a).as_char - R(b).as_char; BC_NEXT;
+  BC_CASE(SUB_INT)          R(dst).as_int = R(a).as_int - R(b).as_int; BC_NEXT;
+  BC_CASE(SUB_FLOAT)        R(dst).as_float = R(a).as_float - R(b).as_float; BC_NEXT;
+  BC_CASE(MUL_CHAR)         R(dst).as_char = R(a).as_char * R(b).as_char; BC_NEXT;
+  BC_CASE(MUL_INT)          R(dst).as_int = R(a).as_int * R(b).as_int; BC_NEXT;
+  BC_CASE(MUL_FLOAT)        R(dst).as_float = R(a).as_float * R(b).as_float; BC_NEXT;
+  BC_CASE(DIV_CHAR)         BC_CHECK_DIVISOR(R(b).as_char != 0); R(dst).as_char = R(a).as_char / R(b).as_char; BC_NEXT;
+  BC_CASE(DIV_INT)          BC_CHECK_DIVISOR(R(b).as_int != 0); R(dst).as_int = R(a).as_int / R(b).as_int; BC_NEXT;
+  BC_CASE(DIV_FLOAT)
+    BC_CHECK_DIVISOR(R(b).as_float != 0.0);
+    R(dst).as_float = R(a).as_float / R(b).as_float;
+    BC_NEXT;
+  BC_CASE(MOD_CHAR)         BC_CHECK_DIVISOR(R(b).as_char != 0); R(dst).as_char = R(a).as_char % R(b).as_char; BC_NEXT;
+  BC_CASE(MOD_INT)          BC_CHECK_DIVISOR(R(b).as_int != 0); R(dst).as_int = R(a).as_int % R(b).as_int; BC_NEXT;
+  BC_CASE(MOD_FLOAT)
+    BC_CHECK_DIVISOR(R(b).as_float != 0.0);
+    R(dst).as_float = fmod(R(a).as_float, R(b).as_float);
+    BC_NEXT;
+  
+  BC_CASE(BIT_AND_CHAR)     R(dst).as_char = R(a).as_char & R(b).as_char; BC_NEXT;
+  BC_CASE(BIT_AND_INT)      R(dst).as_int = R(a).as_int & R(b).as_int; BC_NEXT;
+  BC_CASE(BIT_OR_CHAR)      R(dst).as_char = R(a).as_char | R(b).as_char; BC_NEXT;
+  BC_CASE(BIT_OR_INT)       R(dst).as_int = R(a).as_int | R(b).as_int; BC_NEXT;
+  BC_CASE(BIT_NOT_CHAR)     R(dst).as_char = ~R(a).as_char; BC_NEXT;
+  BC_CASE(BIT_NOT_INT)      R(dst).as_int = ~R(a).as_int; BC_NEXT;
+  BC_CASE(NEG_CHAR)         R(dst).as_char = -R(a).as_char; BC_NEXT;
+  BC_CASE(NEG_INT)          R(dst).as_int = -R(a).as_int; BC_NEXT;
+  BC_CASE(NEG_FLOAT)        R(dst).as_float = -R(a).as_float; BC_NEXT;
+  
+  BC_CASE(LOGIC_NOT)        R(dst).as_bool = !R(a).as_bool; BC_NEXT;
+  BC_CASE(LOGIC_AND)        R(dst).as_bool = (R(a).as_bool && R(b).as_bool); BC_NEXT;
+  BC_CASE(LOGIC_OR)         R(dst).as_bool = (R(a).as_bool || R(b).as_bool); BC_NEXT;
+  
+  BC_CASE(EQ_BOOL)          R(dst).as_bool = (R(a).as_bool == R(b).as_bool); BC_NEXT;
+  BC_CASE(NEQ_BOOL)         R(dst).as_bool = (R(a).as_bool != R(b).as_bool); BC_NEXT;
+  BC_CASE(EQ_INT)           R(dst).as_bool = (R(a).as_int == R(b).as_int); BC_NEXT;
+  BC_CASE(NEQ_INT)          R(dst).as_bool = (R(a).as_int != R(b).as_int); BC_NEXT;
+  BC_CASE(LT_INT)           R(dst).as_bool = (R(a).as_int < R(b).as_int); BC_NEXT;
+  BC_CASE(LE_INT)           R(dst).as_bool = (R(a).as_int <= R(b).as_int); BC_NEXT;
+  BC_CASE(GT_INT)           R(dst).as_bool = (R(a).as_int > R(b).as_int); BC_NEXT;
+  BC_CASE(GE_INT)           R(dst).as_bool = (R(a).as_int >= R(b).as_int); BC_NEXT;
+  BC_CASE(EQ_FLOAT)         R(dst).as_bool = (R(a).as_float == R(b).as_float); BC_NEXT;
+  BC_CASE(NEQ_FLOAT)        R(dst).as_bool = (R(a).as_float != R(b).as_float); BC_NEXT;
+  BC_CASE(LT_FLOAT)         R(dst).as_bool = (R(a).as_float < R(b).as_float); BC_NEXT;
+  BC_CASE(LE_FLOAT)         R(dst).as_bool = (R(a).as_float <= R(b).as_float); BC_NEXT;
+  BC_CASE(GT_FLOAT)         R(dst).as_bool = (R(a).as_float > R(b).as_float); BC_NEXT;
+  BC_CASE(GE_FLOAT)         R(dst).as_bool = (R(a).as_float >= R(b).as_float); BC_NEXT;
+  
+  BC_CASE(RANGE_SIZE)       R(dst).as_int = abs(reg[ip->a + 1].as_int - R(a).as_int) + 1; BC_NEXT;
+  BC_CASE(RANGE_VALUE)
+    if (reg[ip->a + 1].as_int > R(a).as_int) R(dst).as_int = R(a).as_int + R(b).as_int;
+    else R(dst).as_int = R(a).as_int - R(b).as_int;
+    BC_NEXT;
+  
+#if !defined(__GNUC__)
+  }
+#endif
+#undef BC_CHECK_DIVISOR
+#undef R
+#undef BC_NEXT
+#undef BC_DISPATCH
+#undef BC_CASE
+  
+halt:
+  for (int i = 0; i < code.GetNumBindings(); i++) {
+    const cASBytecode::sBinding& binding = code.GetBinding(i);
+    if (!binding.stored) continue;
+    
+    uAnyType& value = m_call_stack[(binding.global) ? binding.var_id : m_sp + binding.var_id].value;
+    switch (binding.type) {
+      case TYPE(BOOL):        value.as_bool = reg[binding.reg].as_bool; break;
+      case TYPE(CHAR):        value.as_char = reg[binding.reg].as_char; break;
+      case TYPE(FLOAT):       value.as_float = reg[binding.reg].as_float; break;
+      case TYPE(INT):         value.as_int = reg[binding.reg].as_int; break;
+      default: break;
+    }
+  }
+}
+
+
 void cDirectInterpretASTVisitor::matrixAdd(cLocalMatrix* m1, cLocalMatrix* m2, cASTNode& node)
 {
   INTERPRET_ERROR(INTERNAL); // @AS_TODO - handle matrix add
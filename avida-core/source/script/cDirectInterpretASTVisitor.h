@@ -22,6 +22,7 @@
 #ifndef cDirectInterpretASTVisitor_h
 #define cDirectInterpretASTVisitor_h
 
+#include "cASBytecode.h"
 #include "cASNativeObject.h"
 #include "cASTVisitor.h"
 
@@ -77,6 +78,8 @@ private:
   bool m_has_returned;
   bool m_obj_assign;
   
+  Apto::Array<cASBytecode::uRegister> m_registers;
+  
   
   // --------  Private Constructors  --------
   cDirectInterpretASTVisitor(const cDirectInterpretASTVisitor&); // @not_implemented
@@ -132,6 +135,8 @@ private:
   
   ASType_t getRuntimeType(ASType_t ltype, ASType_t rtype, bool allow_str = false);
   
+  void executeBytecode(const cASBytecode& code);
+  
   void matrixAdd(cLocalMatrix* m1, cLocalMatrix* m2, cASTNode& node);
   void matrixSubtract(cLocalMatrix* m1, cLocalMatrix* m2, cASTNode& node);
   
@@ -24,10 +24,13 @@
 #include "avida/private/systematics/GenomeTestMetrics.h"
 
 #include "avida/core/Genome.h"
+#include "avida/private/systematics/Genotype.h"
 
 #include "cAvidaContext.h"
+#include "cGenomeTestService.h"
 #include "cHardwareManager.h"
 #include "cPhenotype.h"
+#include "cPopulation.h"
 #include "cTestCPU.h"
 #include "cWorld.h"
 
@@ -35,12 +38,31 @@ const Apto::String Avida::Systematics::GenomeTestMetrics::ObjectKey("Avida::Syst
 
 
 
+Avida::Systematics::GenomeTestMetrics::GenomeTestMetrics()
+  : m_pending(false), m_done(false), m_is_viable(false), m_fitness(0.0), m_colony_fitness(0.0), m_merit(0.0)
+  , m_copied_size(0), m_executed_size(0), m_gestation_time(0)
+{
+}
+
+
 Avida::Systematics::GenomeTestMetrics::GenomeTestMetrics(cWorld* world, cAvidaContext& ctx, GroupPtr g)
+  : m_pending(false), m_done(true)
+{
+  // Genotypes carry their genome directly, which spares re-parsing it from the "genome" property string
+  GenotypePtr genotype;
+  genotype.DynamicCastFrom(g);
+  if (genotype) evaluate(world, ctx, genotype->GroupGenome());
+  else evaluate(world, ctx, Genome(g->Properties().Get("genome").StringValue()));
+}
+
+
+void Avida::Systematics::GenomeTestMetrics::evaluate(cWorld* world, cAvidaContext& ctx, const Genome& genome)
 {
-  Apto::SmartPtr<cTestCPU> testcpu(world->GetHardwareManager().CreateTestCPU(ctx));
+  cTestCPU* testcpu = world->GetHardwareManager().AcquireTestCPU(ctx);
   
   cCPUTestInfo test_info;
-  testcpu->TestGenome(ctx, test_info, Genome(g->Properties().Get("genome").StringValue()));
+  testcpu->TestGenome(ctx, test_info, genome);
+  world->GetHardwareManager().ReleaseTestCPU(testcpu);
   
   m_is_viable = test_info.IsViable();
   
@@ -68,8 +90,19 @@ bool Avida::Systematics::GenomeTestMetrics::Serialize(ArchivePtr) const
 Avida::Systematics::GenomeTestMetricsPtr Avida::Systematics::GenomeTestMetrics::GetMetrics(cWorld* world, cAvidaContext& ctx,
                                                                                            GroupPtr g)
 {
+  cGenomeTestService* service = world->GetPopulation().GetGenomeTestService();
   GenomeTestMetricsPtr metrics = g->GetData<GenomeTestMetrics>();
-  if (!metrics && g->Properties().Has("genome")) {
+  
+  // With the service running every test goes through it, so results come from the per-genotype streams however the
+  // test ends up being run; a queued test no worker has started yet is run on this thread by Wait()
+  if (!metrics && service) {
+    RequestMetrics(world, g);
+    metrics = g->GetData<GenomeTestMetrics>();
+  }
+  
+  if (metrics) {
+    if (metrics->m_pending) service->Wait(metrics.Get());
+  } else if (g->Properties().Has("genome")) {
     metrics = GenomeTestMetricsPtr(new GenomeTestMetrics(world, ctx, g));
     assert(metrics);
     g->AttachData(metrics);
@@ -77,3 +110,37 @@ Avida::Systematics::GenomeTestMetricsPtr Avida::Systematics::GenomeTestMetrics::
 
   return metrics;
 }
+
+
+Avida::Systematics::GenomeTestMetricsPtr Avida::Systematics::GenomeTestMetrics::GetMetricsIfReady(cWorld* world, cAvidaContext& ctx,
+                                                                                                  GroupPtr g)
+{
+  if (!world->GetPopulation().GetGenomeTestService()) return GetMetrics(world, ctx, g);
+  
+  GenomeTestMetricsPtr metrics = g->GetData<GenomeTestMetrics>();
+  if (!metrics) {
+    RequestMetrics(world, g);
+    return GenomeTestMetricsPtr(NULL);
+  }
+  
+  if (metrics->m_pending && !world->GetPopulation().GetGenomeTestService()->IsReady(metrics.Get())) {
+    return GenomeTestMetricsPtr(NULL);
+  }
+  
+  return metrics;
+}
+
+
+void Avida::Systematics::GenomeTestMetrics::RequestMetrics(cWorld* world, GroupPtr g)
+{
+  cGenomeTestService* service = world->GetPopulation().GetGenomeTestService();
+  if (!service || g->GetData<GenomeTestMetrics>() || !g->Properties().Has("genome")) return;
+  
+  GenomeTestMetricsPtr metrics(new GenomeTestMetrics);
+  g->AttachData(metrics);
+  
+  GenotypePtr genotype;
+  genotype.DynamicCastFrom(g);
+  if (genotype) service->Submit(metrics, genotype->GroupGenome(), g->ID());
+  else service->Submit(metrics, Genome(g->Properties().Get("genome").StringValue()), g->ID());
+}
@@ -34,11 +34,32 @@
 #include "cStringUtil.h"
 
 
-static const Apto::BasicString<Apto::ThreadSafe> s_unit_prop_name_last_copied_size("last_copied_size");
-static const Apto::BasicString<Apto::ThreadSafe> s_unit_prop_name_last_executed_size("last_executed_size");
-static const Apto::BasicString<Apto::ThreadSafe> s_unit_prop_name_last_gestation_time("last_gestation_time");
-static const Apto::BasicString<Apto::ThreadSafe> s_unit_prop_name_last_metabolic_rate("last_metabolic_rate");
-static const Apto::BasicString<Apto::ThreadSafe> s_unit_prop_name_last_fitness("last_fitness");
+// Unit properties read on every birth and gestation, interned on first use so that the reads skip the name lookup
+struct UnitPropIndices
+{
+  int generation;
+  int last_copied_size;
+  int last_executed_size;
+  int last_gestation_time;
+  int last_metabolic_rate;
+  int last_fitness;
+  
+  UnitPropIndices()
+    : generation(Avida::PropertyMap::Intern("generation"))
+    , last_copied_size(Avida::PropertyMap::Intern("last_copied_size"))
+    , last_executed_size(Avida::PropertyMap::Intern("last_executed_size"))
+    , last_gestation_time(Avida::PropertyMap::Intern("last_gestation_time"))
+    , last_metabolic_rate(Avida::PropertyMap::Intern("last_metabolic_rate"))
+    , last_fitness(Avida::PropertyMap::Intern("last_fitness"))
+  {
+  }
+};
+
+static const UnitPropIndices& unitProps()
+{
+  static const UnitPropIndices s_unit_props;
+  return s_unit_props;
+}
 
 
 static Avida::PropertyDescriptionMap s_prop_desc_map;
@@ -134,7 +155,7 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, Un
   , m_name("001-no_name")
   , m_threshold(false)
   , m_active(true)
-  , m_generation_born(founder->Properties().Get("generation").IntValue())
+  , m_generation_born(founder->Properties().GetInt(unitProps().generation))
   , m_update_born(update)
   , m_update_deactivated(-1)
   , m_depth(0)
@@ -142,6 +163,9 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, Un
   , m_num_organisms(1)
   , m_last_num_organisms(0)
   , m_total_organisms(1)
+  , m_stats_units(0)
+  , m_stats_threshold(false)
+  , m_genome_size(-1)
   , m_last_birth_cell(0)
   , m_last_group_id(-1)
   , m_last_forager_type(-1)
@@ -197,6 +221,9 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, vo
 , m_num_organisms(0)
 , m_last_num_organisms(0)
 , m_total_organisms(0)
+, m_stats_units(0)
+, m_stats_threshold(false)
+, m_genome_size(-1)
 , m_last_birth_cell(0)
 , m_last_group_id(-1)
 , m_last_forager_type(-1)
@@ -290,14 +317,17 @@ void Avida::Systematics::Genotype::HandleUnitGestation(UnitPtr u)
 {
   m_gestation_count.Inc();
   
-  m_copied_size.Add(u->Properties().Get(s_unit_prop_name_last_copied_size));
-  m_exe_size.Add(u->Properties().Get(s_unit_prop_name_last_executed_size));
+  const PropertyMap& props = u->Properties();
+  const UnitPropIndices& idx = unitProps();
+  
+  m_copied_size.Add(props.GetDouble(idx.last_copied_size));
+  m_exe_size.Add(props.GetDouble(idx.last_executed_size));
   
-  double last_gestation_time = u->Properties().Get(s_unit_prop_name_last_gestation_time);
+  double last_gestation_time = props.GetDouble(idx.last_gestation_time);
   m_gestation_time.Add(last_gestation_time);
   m_repro_rate.Add(1.0 / last_gestation_time);
-  m_merit.Add(u->Properties().Get(s_unit_prop_name_last_metabolic_rate));
-  m_fitness.Add(u->Properties().Get(s_unit_prop_name_last_fitness));
+  m_merit.Add(props.GetDouble(idx.last_metabolic_rate));
+  m_fitness.Add(props.GetDouble(idx.last_fitness));
 
   // Collect all relevant action trigger counts
 //  for (int i = 0; i < m_mgr->EnvironmentActionTriggerCountIDs().GetSize(); i++) {
@@ -31,8 +31,6 @@
 
 #include "avida/private/systematics/Genotype.h"
 
-#include "cDoubleSum.h"
-
 #include <cmath>
 
 
@@ -40,6 +38,9 @@ Avida::Systematics::GenotypeArbiter::GenotypeArbiter(World* world, const RoleID&
   : Arbiter(role)
   , m_threshold(threshold)
   , m_disable_class(disable_class)
+  , m_active_entries(0)
+  , m_active_used(0)
+  , m_active_serial(0)
   , m_active_sz(1)
   , m_coalescent(NULL)
   , m_best(0)
@@ -47,6 +48,13 @@ Avida::Systematics::GenotypeArbiter::GenotypeArbiter(World* world, const RoleID&
   , m_dom_prev(-1)
   , m_dom_time(0)
   , m_cur_update(-1)
+  , m_stats_update(0)
+  , m_stats_rebuild_update(0)
+  , m_stats_groups(0)
+  , m_stats_depth(0.0)
+  , m_stats_depth2(0.0)
+  , m_stats_size(0.0)
+  , m_stats_size2(0.0)
   , m_tot_genotypes(0)
   , m_coalescent_depth(-1)
 {
@@ -86,15 +94,15 @@ void Avida::Systematics::GenotypeArbiter::PerformUpdate(Context&, Update current
 {
   m_cur_update = current_update + 1; // +1 since PerformUpdate happens at end of updates, but m_cur_update is used during
   
-  if (m_active_sz.GetSize() < HASH_SIZE) {
+  if (m_active_sz.GetSize() < m_active_table.GetSize()) {
     for (int i = 0; i < m_active_sz.GetSize(); i++) {
       Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
       while (list_it.Next() != NULL) if ((*list_it.Get())->IsThreshold()) (*list_it.Get())->UpdateReset();
     }
   } else {
-    for (int i = 0; i < HASH_SIZE; i++) {
-      Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_hash[i].Begin());
-      while (list_it.Next() != NULL) if ((*list_it.Get())->IsThreshold()) (*list_it.Get())->UpdateReset();
+    for (int i = 0; i < m_active_table.GetSize(); i++) {
+      GenotypePtr& genotype = m_active_table[i].genotype;
+      if (genotype && genotype->IsThreshold()) genotype->UpdateReset();
     }    
   }
 
@@ -134,6 +142,7 @@ Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::LegacyLoad(voi
 {
   GenotypePtr g(new Genotype(thisPtr(), m_next_id++, props));
   m_historic.Push(g, &g->m_handle);
+  m_id_index.Set(g->ID(), g);
   return g;
 }
 
@@ -141,13 +150,8 @@ Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::LegacyLoad(voi
 
 Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::Group(GroupID g_id)
 {
-  for (int i = m_best; i >= 0; i--) {
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-    while (list_it.Next() != NULL) if ((*list_it.Get())->ID() == g_id) return *list_it.Get();
-  }
-  
-  Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_historic.Begin());
-  while (list_it.Next() != NULL) if ((*list_it.Get())->ID() == g_id) return *list_it.Get();
+  GenotypePtr found;
+  if (m_id_index.Get(g_id, found)) return found;
   
   return GroupPtr(NULL);
 }
@@ -174,76 +178,50 @@ Avida::Data::ConstDataSetPtr Avida::Systematics::GenotypeArbiter::Provides() con
   return m_provides;
 }
 
+// Average, variance and standard error with the same definitions as cDoubleSum
+static inline void summarizeStat(double n, double s1, double s2, double& ave, double& var, double& std_err)
+{
+  ave = (n > 0.0) ? (s1 / n) : 0.0;
+  var = (n > 1.0) ? Apto::Max(0.0, (s2 - s1 * s1 / n) / (n - 1.0)) : 0.0;  // cancellation may dip below zero
+  std_err = (n > 1.0) ? sqrt(var / n) : 0.0;
+}
+
 void Avida::Systematics::GenotypeArbiter::UpdateProvidedValues(Update current_update)
 {
-  cDoubleSum sum_age;
-  cDoubleSum sum_abundance;
-  cDoubleSum sum_depth;
-  cDoubleSum sum_size;
-  cDoubleSum sum_threshold_age;
-  
-  // Pre-calculate the total number of units that are currently active (used in entropy calculation)
-  int tot_units = 0;
-  for (int i = 1; i < m_active_sz.GetSize(); i++) {
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-    while (list_it.Next()) tot_units += (*list_it.Get())->NumUnits();
+  // Bring the age sums up to the current update
+  if (current_update != m_stats_update) {
+    const double d = current_update - m_stats_update;
+    m_stats_all.Shift(d);
+    m_stats_threshold.Shift(d);
+    m_stats_update = current_update;
   }
-  
-  // Loop through all genotypes collecting statistics
+  if (current_update - m_stats_rebuild_update >= STATS_REBUILD_INTERVAL) rebuildStats();
+  
+  // Entropy only depends on the abundance distribution, which the size lists already provide, so each abundance
+  // contributes its term once per genotype of that size.
+  // - when p = 1.0, partial_ent calculation would return -0.0. This may propagate
+  //   to the output stage, but behavior is dependent on compiler used and optimization
+  //   level.  For consistent output, ensures that 0.0 is returned.
+  const long long tot_units = m_stats_all.units;
   m_entropy = 0.0;
-  int active_count = 0;
   for (int i = 1; i < m_active_sz.GetSize(); i++) {
-    active_count += m_active_sz[i].GetSize();
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-    while (list_it.Next()) {
-      GenotypePtr bg = *list_it.Get();
-      const int abundance = bg->NumUnits();
-      
-      // Update stats...
-      const int age = current_update - bg->GetUpdateBorn();
-      sum_age.Add(age, abundance);
-      sum_abundance.Add(abundance);
-      sum_depth.Add(bg->Depth(), abundance);
-      
-      ConstInstructionSequencePtr seq;
-      seq.DynamicCastFrom(bg->GroupGenome().Representation());
-      assert(seq);
-      sum_size.Add(seq->GetSize(), abundance);
-      
-      // Calculate this genotype's contribution to entropy
-      // - when p = 1.0, partial_ent calculation would return -0.0. This may propagate
-      //   to the output stage, but behavior is dependent on compiler used and optimization
-      //   level.  For consistent output, ensures that 0.0 is returned.
-      const double p = ((double) abundance) / (double) tot_units;
-      const double partial_ent = (abundance == tot_units) ? 0.0 : -(p * log(p)); 
-      m_entropy += partial_ent;
-      
-      // Do any special calculations for threshold genotypes.
-      if (bg->IsThreshold()) sum_threshold_age.Add(age, abundance);
-    }
+    const int num_genotypes = m_active_sz[i].GetSize();
+    if (!num_genotypes) continue;
+    const double p = ((double) i) / (double) tot_units;
+    const double partial_ent = (i == tot_units) ? 0.0 : -(p * log(p));
+    m_entropy += partial_ent * num_genotypes;
   }
   
   // Stash all stats so that the can be retrieved using the provider mechanisms
-  m_num_genotypes = active_count;
+  m_num_genotypes = (int)m_stats_groups;
   m_num_historic_genotypes = m_historic.GetSize();
   
-  m_ave_age = sum_age.Average();
-  m_ave_abundance = sum_abundance.Average();
-  m_ave_depth = sum_depth.Average();
-  m_ave_size = sum_size.Average();
-  m_ave_threshold_age = sum_threshold_age.Average();
-  
-  m_stderr_age = sum_age.StdError();
-  m_stderr_abundance = sum_abundance.StdError();
-  m_stderr_depth = sum_depth.StdError();
-  m_stderr_size = sum_size.StdError();
-  m_stderr_threshold_age = sum_threshold_age.StdError();
-  
-  m_var_age = sum_age.Variance();
-  m_var_abundance = sum_abundance.Variance();
-  m_var_depth = sum_depth.Variance();
-  m_var_size = sum_size.Variance();
-  m_var_threshold_age = sum_threshold_age.Variance();
+  summarizeStat(m_stats_all.units, m_stats_all.age, m_stats_all.u2_age2, m_ave_age, m_var_age, m_stderr_age);
+  summarizeStat(m_stats_groups, m_stats_all.units, m_stats_all.u2, m_ave_abundance, m_var_abundance, m_stderr_abundance);
+  summarizeStat(m_stats_all.units, m_stats_depth, m_stats_depth2, m_ave_depth, m_var_depth, m_stderr_depth);
+  summarizeStat(m_stats_all.units, m_stats_size, m_stats_size2, m_ave_size, m_var_size, m_stderr_size);
+  summarizeStat(m_stats_threshold.units, m_stats_threshold.age, m_stats_threshold.u2_age2,
+                m_ave_threshold_age, m_var_threshold_age, m_stderr_threshold_age);
   
   m_dom_id = (getBest()) ? getBest()->ID() : -1;  
 }
@@ -283,7 +261,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   ConstInstructionSequencePtr seq;
   seq.DynamicCastFrom(u->UnitGenome().Representation());
   assert(seq);
-  int list_num = hashGenome(*seq);
+  const unsigned long long fingerprint = hashGenome(*seq);
   
   GenotypePtr found;
 
@@ -291,56 +269,38 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   if (hints && hints->Get("id", gid_str)) {
     int gid = Apto::StrAs(gid_str);
     
-    // Search all lists attempting to locate the referenced genotype by ID
-    for (int i = 0; i < m_active_sz.GetSize() && !found; i++) {
-      Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-      while (list_it.Next() != NULL) {
-        if ((*list_it.Get())->ID() == gid) {
-          found = *list_it.Get();
-          found->NotifyNewUnit(u);
-          break;
-        }
-      }
-    }
-    
-    if (!found) {
-      Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_historic.Begin());
-      while (list_it.Next() != NULL) {
-        if ((*list_it.Get())->ID() == gid) {
-          found = *list_it.Get();
-          seq.DynamicCastFrom(found->GroupGenome().Representation());
-          assert(seq);
-          
-          m_active_hash[hashGenome(*seq)].Push(found);
-          found->m_handle->Remove(); // Remove from historic list
-          resizeActiveList(found->NumUnits());
-          m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
-          found->Reactivate();
-          found->NotifyNewUnit(u);
-          m_tot_genotypes++;
-          if (found->NumUnits() > m_best) {
-            m_best = found->NumUnits();
-            found->SetThreshold();
-            found->SetName(nameGenotype(seq->GetSize()));
-            m_num_threshold++;
-            m_tot_threshold++;
-            notifyListeners(found, EVENT_ADD_THRESHOLD);
-          }          
+    // Locate the referenced genotype by ID, reactivating it if it is historic
+    if (m_id_index.Get(gid, found)) {
+      if (found->IsActive()) {
+        found->NotifyNewUnit(u);
+      } else {
+        seq.DynamicCastFrom(found->GroupGenome().Representation());
+        assert(seq);
+        
+        insertActive(found, hashGenome(*seq));
+        found->m_handle->Remove(); // Remove from historic list
+        resizeActiveList(found->NumUnits());
+        m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
+        found->Reactivate();
+        found->NotifyNewUnit(u);
+        m_tot_genotypes++;
+        if (found->NumUnits() > m_best) {
+          m_best = found->NumUnits();
+          found->SetThreshold();
+          found->SetName(nameGenotype(seq->GetSize()));
+          m_num_threshold++;
+          m_tot_threshold++;
+          notifyListeners(found, EVENT_ADD_THRESHOLD);
         }
+        refreshStats(found, found->NumUnits());
       }
     }
   } 
   
   // No hints or unable to locate hinted genome, search for a matching genotype
   if (!found) {
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_hash[list_num].Begin());
-    while (list_it.Next() != NULL) {
-      if ((*list_it.Get())->Matches(u)) {
-        found = *list_it.Get();
-        found->NotifyNewUnit(u);
-        break;
-      }
-    }
+    found = findActive(u, fingerprint);
+    if (found) found->NotifyNewUnit(u);
   }
   
   // No matching genotype (hinted or otherwise), so create a new one
@@ -350,7 +310,8 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
     } else {
       found = GenotypePtr(new Genotype(thisPtr(), m_next_id++, u, m_cur_update, ConstGroupMembershipPtr(NULL)));
     }
-    m_active_hash[list_num].Push(found);
+    insertActive(found, fingerprint);
+    m_id_index.Set(found->ID(), found);
     resizeActiveList(found->NumUnits());
     m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
     m_tot_genotypes++;
@@ -364,6 +325,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
       m_tot_threshold++;
       notifyListeners(found, EVENT_ADD_THRESHOLD);
     }
+    refreshStats(found, found->NumUnits());
   }
   return found;
 }
@@ -383,6 +345,7 @@ void Avida::Systematics::GenotypeArbiter::AdjustGenotype(GenotypePtr genotype, i
   
   // Handle defunct genotypes
   if (new_size == 0 && genotype->ActiveReferenceCount() == 0) {
+    refreshStats(genotype, 0);
     removeGenotype(genotype);
     return;
   }
@@ -407,6 +370,8 @@ void Avida::Systematics::GenotypeArbiter::AdjustGenotype(GenotypePtr genotype, i
     m_tot_threshold++;
     notifyListeners(genotype, EVENT_ADD_THRESHOLD);
   }
+  
+  refreshStats(genotype, new_size);
 }
 
 template <class T> Avida::Data::PackagePtr Avida::Systematics::GenotypeArbiter::packageData(const T& val) const
@@ -468,15 +433,96 @@ void Avida::Systematics::GenotypeArbiter::setupProvidedData(World* world)
 
 
 
-unsigned int Avida::Systematics::GenotypeArbiter::hashGenome(const InstructionSequence& genome) const
+unsigned long long Avida::Systematics::GenotypeArbiter::hashGenome(const InstructionSequence& genome) const
 {
-  unsigned int total = 0;
-  
+  // 64-bit FNV-1a over the instruction ops and length, finished with a mixing step so that the low bits used to
+  // select a table slot depend on the whole genome
+  unsigned long long hash = 14695981039346656037ULL;
   for (int i = 0; i < genome.GetSize(); i++) {
-    total += (genome[i].GetOp() + 3) * i;
+    hash ^= (unsigned long long)genome[i].GetOp();
+    hash *= 1099511628211ULL;
   }
+  hash ^= (unsigned long long)genome.GetSize();
+  hash *= 1099511628211ULL;
   
-  return total % HASH_SIZE;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  
+  return hash;
+}
+
+void Avida::Systematics::GenotypeArbiter::insertActive(GenotypePtr genotype, unsigned long long fingerprint)
+{
+  // Keep the load (including deleted slots) at or below one half
+  if ((m_active_used + 1) * 2 > m_active_table.GetSize()) resizeActiveTable((m_active_entries + 1) * 4);
+  
+  const int mask = m_active_table.GetSize() - 1;
+  int slot = (int)(fingerprint & mask);
+  while (m_active_table[slot].genotype) slot = (slot + 1) & mask;
+  
+  ActiveEntry& entry = m_active_table[slot];
+  if (!entry.deleted) m_active_used++;
+  entry.fingerprint = fingerprint;
+  entry.serial = m_active_serial++;
+  entry.genotype = genotype;
+  entry.deleted = false;
+  m_active_entries++;
+}
+
+void Avida::Systematics::GenotypeArbiter::removeActive(GenotypePtr genotype, unsigned long long fingerprint)
+{
+  const int mask = m_active_table.GetSize() - 1;
+  for (int slot = (int)(fingerprint & mask); m_active_table[slot].genotype || m_active_table[slot].deleted; slot = (slot + 1) & mask) {
+    ActiveEntry& entry = m_active_table[slot];
+    if (entry.genotype == genotype) {
+      entry.genotype = GenotypePtr(NULL);
+      entry.deleted = true;
+      m_active_entries--;
+      return;
+    }
+  }
+  assert(false); // active genotype missing from the table
+}
+
+Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::findActive(UnitPtr u, unsigned long long fingerprint)
+{
+  GenotypePtr found;
+  if (m_active_entries == 0) return found;
+  
+  unsigned int found_serial = 0;
+  const int mask = m_active_table.GetSize() - 1;
+  for (int slot = (int)(fingerprint & mask); m_active_table[slot].genotype || m_active_table[slot].deleted; slot = (slot + 1) & mask) {
+    ActiveEntry& entry = m_active_table[slot];
+    if (entry.genotype && entry.fingerprint == fingerprint && (!found || entry.serial > found_serial) &&
+        entry.genotype->Matches(u)) {
+      found = entry.genotype;
+      found_serial = entry.serial;
+    }
+  }
+  return found;
+}
+
+void Avida::Systematics::GenotypeArbiter::resizeActiveTable(int size)
+{
+  int new_size = 64;
+  while (new_size < size) new_size *= 2;
+  
+  Apto::Array<ActiveEntry> old_table(m_active_table);
+  m_active_table.ResizeClear(new_size);
+  m_active_table.SetAll(ActiveEntry());
+  m_active_used = m_active_entries;
+  
+  // Reinsert live entries, keeping their serials so that match order is unchanged
+  const int mask = new_size - 1;
+  for (int i = 0; i < old_table.GetSize(); i++) {
+    if (!old_table[i].genotype) continue;
+    int slot = (int)(old_table[i].fingerprint & mask);
+    while (m_active_table[slot].genotype) slot = (slot + 1) & mask;
+    m_active_table[slot] = old_table[i];
+  }
 }
 
 Apto::String Avida::Systematics::GenotypeArbiter::nameGenotype(int size)
@@ -502,8 +548,7 @@ void Avida::Systematics::GenotypeArbiter::removeGenotype(GenotypePtr genotype)
   if (genotype->IsActive()) {
     ConstInstructionSequencePtr seq;
     seq.DynamicCastFrom(genotype->GroupGenome().Representation());
-    int list_num = hashGenome(*seq);
-    m_active_hash[list_num].Remove(genotype);
+    removeActive(genotype, hashGenome(*seq));
     genotype->Deactivate(m_cur_update);
     m_historic.Push(genotype, &genotype->m_handle);
   }
@@ -527,11 +572,68 @@ void Avida::Systematics::GenotypeArbiter::removeGenotype(GenotypePtr genotype)
   
   assert(genotype->m_handle);
   genotype->m_handle->Remove(); // Remove from historic list
+  m_id_index.Remove(genotype->ID());
   
   delete genotype->m_handle;
   genotype->m_handle = NULL;
 }
 
+void Avida::Systematics::GenotypeArbiter::refreshStats(GenotypePtr genotype, int units)
+{
+  // Replace whatever this genotype last contributed with its contribution at its current size and threshold state
+  const bool threshold = (units > 0 && genotype->IsThreshold());
+  if (units == genotype->m_stats_units && threshold == genotype->m_stats_threshold) return;
+  
+  if (genotype->m_stats_units) applyStats(genotype, genotype->m_stats_units, genotype->m_stats_threshold, -1);
+  if (units) applyStats(genotype, units, threshold, 1);
+  genotype->m_stats_units = units;
+  genotype->m_stats_threshold = threshold;
+}
+
+void Avida::Systematics::GenotypeArbiter::applyStats(GenotypePtr genotype, int units, bool threshold, int sign)
+{
+  if (genotype->m_genome_size < 0) {
+    ConstInstructionSequencePtr seq;
+    seq.DynamicCastFrom(genotype->GroupGenome().Representation());
+    assert(seq);
+    genotype->m_genome_size = seq->GetSize();
+  }
+  
+  const double u = units;
+  const double age = m_stats_update - genotype->GetUpdateBorn();
+  const double depth = genotype->Depth();
+  const double size = genotype->m_genome_size;
+  
+  m_stats_all.Add(units, age, sign);
+  if (threshold) m_stats_threshold.Add(units, age, sign);
+  m_stats_groups += sign;
+  m_stats_depth += sign * u * depth;
+  m_stats_depth2 += sign * (u * depth) * (u * depth);
+  m_stats_size += sign * u * size;
+  m_stats_size2 += sign * (u * size) * (u * size);
+}
+
+void Avida::Systematics::GenotypeArbiter::rebuildStats()
+{
+  // Re-sum every active genotype's current contribution from scratch, discarding any accumulated rounding
+  m_stats_all = AgeSums();
+  m_stats_threshold = AgeSums();
+  m_stats_groups = 0;
+  m_stats_depth = 0.0;
+  m_stats_depth2 = 0.0;
+  m_stats_size = 0.0;
+  m_stats_size2 = 0.0;
+  
+  for (int i = 1; i < m_active_sz.GetSize(); i++) {
+    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
+    while (list_it.Next()) {
+      GenotypePtr genotype = *list_it.Get();
+      if (genotype->m_stats_units) applyStats(genotype, genotype->m_stats_units, genotype->m_stats_threshold, 1);
+    }
+  }
+  m_stats_rebuild_update = m_stats_update;
+}
+
 void Avida::Systematics::GenotypeArbiter::updateCoalescent()
 {
   if (m_coalescent && (m_coalescent->ActiveReferenceCount() > 0 || m_coalescent->PassiveReferenceCount() > 1)) return;
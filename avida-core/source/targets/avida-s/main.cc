@@ -20,13 +20,11 @@
  */
 
 #include "avida/Avida.h"
-#include "Platform.h"
 
 #include "ASCoreLib.h"
-#include "ASAvidaLib.h"
-#include "ASAnalyzeLib.h"
 
 #include "cASLibrary.h"
+#include "cCompileASTVisitor.h"
 #include "cDirectInterpretASTVisitor.h"
 #include "cDumpASTVisitor.h"
 #include "cFile.h"
@@ -34,6 +32,7 @@
 #include "cSemanticASTVisitor.h"
 #include "cSymbolTable.h"
 
+#include <cstring>
 #include <iostream>
 
 
@@ -41,12 +40,10 @@ int main (int argc, char * const argv[])
 {
   Avida::Initialize();
 
-  Avida::PrintVersionBanner();
+  std::cout << Avida::Version::Banner() << std::endl;
 
   cASLibrary* lib = new cASLibrary;  
   RegisterASCoreLib(lib);
-  RegisterASAvidaLib(lib);
-  RegisterASAnalyzeLib(lib);
   
   cParser* parser = new cParser;
   
@@ -69,6 +66,12 @@ int main (int argc, char * const argv[])
         exit(AS_EXIT_FAIL_SEMANTIC);
       }
       
+      // Scalar loops run as bytecode unless the tree-walking interpreter is requested (for comparison)
+      if (!(argc > 1 && strcmp(argv[1], "--interpret") == 0)) {
+        cCompileASTVisitor compiler(&global_symtbl);
+        compiler.Compile();
+      }
+      
       cDirectInterpretASTVisitor interpeter(&global_symtbl);
       int exit_code = interpeter.Interpret(tree);
       
@@ -122,21 +122,26 @@ void cStatsScreen::Update(cAvidaContext& ctx)
 //  PrintDouble(10, 38, stats.GetEntropy());
 //  PrintDouble(12, 38, stats.GetSpeciesEntropy());
 
-  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, best_gen);
-  PrintDouble(2, 62, metrics->GetFitness());
-  PrintDouble(3, 62, metrics->GetMerit());
-  PrintDouble(4, 62, metrics->GetGestationTime());
+  // Test metrics are left off the screen until a background test of the genotype has finished
+  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, best_gen);
+  if (metrics) {
+    PrintDouble(2, 62, metrics->GetFitness());
+    PrintDouble(3, 62, metrics->GetMerit());
+    PrintDouble(4, 62, metrics->GetGestationTime());
+  }
   Genome gen(best_gen->Properties().Get("genome").StringValue());
   InstructionSequencePtr seq;
   seq.DynamicCastFrom(gen.Representation());
   Print(5, 62, "%7d", seq->GetSize());
-  PrintDouble(6, 62, metrics->GetLinesCopied());
-  PrintDouble(7, 62, metrics->GetLinesExecuted());
+  if (metrics) {
+    PrintDouble(6, 62, metrics->GetLinesCopied());
+    PrintDouble(7, 62, metrics->GetLinesExecuted());
+  }
   Print(8, 62, "%7d", best_gen->NumUnits());
   Print(9, 62, "%7d", (int)Apto::StrAs(best_gen->Properties().Get("recent_births").StringValue()));
   if (stats.GetAveMerit() == 0) {
     PrintDouble(10, 62, 0.0);
-  } else {
+  } else if (metrics) {
     PrintDouble(10, 62, ((double) info.GetConfig().AVE_TIME_SLICE.Get()) * metrics->GetFitness() / stats.GetAveMerit());
   }
   Print(11, 62, "%7d", best_gen->Depth());
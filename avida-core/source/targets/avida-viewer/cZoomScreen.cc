@@ -927,18 +927,22 @@ void cZoomScreen::UpdateGenotype(cAvidaContext& ctx)
   
   if (info.GetActiveGenotype() != NULL) {
     Systematics::GroupPtr genotype = info.GetActiveGenotype();
-    Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype);
+    Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, genotype);
     Print(5, 12, "%9d", genotype->NumUnits());
     Genome gen(genotype->Properties().Get("genome").StringValue());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(gen.Representation());
     Print(6, 12, "%9d", seq->GetSize());
-    PrintDouble(7, 14, metrics->GetLinesCopied());
-    PrintDouble(8, 14, metrics->GetLinesExecuted());
     
-    PrintDouble(10, 14, metrics->GetFitness());
-    PrintDouble(11, 14, metrics->GetGestationTime());
-    PrintDouble(12, 14, metrics->GetMerit());
+    // Test metrics are left off the screen until a background test of the genotype has finished
+    if (metrics) {
+      PrintDouble(7, 14, metrics->GetLinesCopied());
+      PrintDouble(8, 14, metrics->GetLinesExecuted());
+      
+      PrintDouble(10, 14, metrics->GetFitness());
+      PrintDouble(11, 14, metrics->GetGestationTime());
+      PrintDouble(12, 14, metrics->GetMerit());
+    }
     PrintDouble(13, 14, Apto::StrAs(genotype->Properties().Get("repro_rate").StringValue()));
     
     // Column 2
@@ -32,6 +32,7 @@
 #include "cAvidaContext.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
+#include "cInstSet.h"
 #include "cOrganism.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
@@ -85,6 +86,35 @@ void Avida2Driver::Run()
     ActiveProcessStep = &cPopulation::ProcessStepSpeculative;
   }
   
+  // Parallel updates build on speculative execution, so they are only available when it is.  Workers run organisms
+  // concurrently, so instruction sets with instructions that touch shared state without stalling must run serially.
+  // Resource costs and constitutive regulation read the cell resources on every CPU cycle, which also updates them.
+  bool parallel_update = (ActiveProcessStep == &cPopulation::ProcessStepSpeculative &&
+                          m_world->GetConfig().PARALLEL_UPDATE_THREADS.Get() > 1);
+  if (parallel_update && m_world->GetConfig().CONSTITUTIVE_REGULATION.Get()) {
+    Feedback().Warning("CONSTITUTIVE_REGULATION senses resources every CPU cycle, PARALLEL_UPDATE_THREADS disabled");
+    parallel_update = false;
+  }
+  for (int i = 0; parallel_update && i < m_world->GetHardwareManager().GetNumInstSets(); i++) {
+    const cInstSet& inst_set = m_world->GetHardwareManager().GetInstSet(i);
+    if (inst_set.HasSharedState()) {
+      Feedback().Warning("instruction set '%s' has instructions that affect other organisms without stalling, "
+                         "PARALLEL_UPDATE_THREADS disabled", (const char*)inst_set.GetInstSetName());
+      parallel_update = false;
+    } else if (inst_set.HasResCosts() || inst_set.HasFemResCosts()) {
+      Feedback().Warning("instruction set '%s' has resource costs, PARALLEL_UPDATE_THREADS disabled",
+                         (const char*)inst_set.GetInstSetName());
+      parallel_update = false;
+    }
+  }
+  
+  // Batched scheduling hands out each update's CPU cycles in blocks rather than one scheduler draw per step
+  const bool batched_update = (!parallel_update && population.HasBatchedScheduler());
+  
+  // Multi-instruction time slices continue past the first instruction speculatively, so require the same conditions
+  const int time_slice_quantum = (ActiveProcessStep == &cPopulation::ProcessStepSpeculative) ?
+                                 m_world->GetConfig().TIME_SLICE_QUANTUM.Get() : 1;
+  
   cAvidaContext& ctx = m_world->GetDefaultContext();
   Avida::Context new_ctx(this, &m_world->GetRandom());
   
@@ -108,11 +138,23 @@ void Avida2Driver::Run()
     const int UD_size = m_world->CalculateUpdateSize();
     const double step_size = 1.0 / (double) UD_size;
     
-    for (int i = 0; i < UD_size; i++) {
-      if(population.GetNumOrganisms() == 0) {
-        break;
+    if (parallel_update) {
+      population.ProcessUpdateParallel(ctx, step_size, UD_size);
+    } else if (batched_update) {
+      population.ProcessUpdateBatched(ctx, step_size, UD_size, ActiveProcessStep == &cPopulation::ProcessStepSpeculative);
+    } else if (time_slice_quantum > 1) {
+      for (int i = 0; i < UD_size;) {
+        if (population.GetNumOrganisms() == 0) break;
+        const int quantum = Apto::Min(time_slice_quantum, UD_size - i);
+        i += population.ProcessStepQuantum(ctx, step_size, population.ScheduleOrganism(), quantum);
+      }
+    } else {
+      for (int i = 0; i < UD_size; i++) {
+        if(population.GetNumOrganisms() == 0) {
+          break;
+        }
+        (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
       }
-      (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
     }
     
     // end of update stats...
@@ -0,0 +1,85 @@
+/*
+ *  tArraySlice.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef tArraySlice_h
+#define tArraySlice_h
+
+#include "apto/core/Array.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+/*
+   Array Slice Template
+
+   A non-owning window onto a run of elements stored elsewhere, such as a region of a larger slab or the storage of
+   an Apto::Array.  Slices are cheap to copy and may be passed by value; copying a slice never copies the elements.
+
+   Constness is shallow: a const slice only hands out const references, but a copy of it may write through.  Slices
+   over an Apto::Array are only valid until that array is next resized.  Assignment is disabled so that code written
+   against Apto::Array cannot silently rebind a slice where it meant to copy elements; use Reset() or CopyFrom().
+
+   Interface:
+     void Reset(T* data, int size)              - point the slice at a different run of elements
+     int GetSize() const
+     T& operator[](int index)
+     void SetAll(const T& value)
+     void CopyFrom(const tArraySlice& src)      - sizes must match; T must be trivially copyable
+     operator Apto::Array<T>() const            - copies the elements out, for code expecting an owning array
+*/
+
+template <class T> class tArraySlice
+{
+private:
+  T* m_data;
+  int m_size;
+
+  tArraySlice& operator=(const tArraySlice&); // @not_implemented
+
+public:
+  tArraySlice() : m_data(NULL), m_size(0) { ; }
+  tArraySlice(T* data, int size) : m_data(data), m_size(size) { ; }
+  explicit tArraySlice(Apto::Array<T>& arr) : m_data((arr.GetSize()) ? &arr[0] : NULL), m_size(arr.GetSize()) { ; }
+
+  void Reset(T* data, int size) { m_data = data; m_size = size; }
+
+  int GetSize() const { return m_size; }
+
+  T& operator[](int index) { assert(index >= 0 && index < m_size); return m_data[index]; }
+  const T& operator[](int index) const { assert(index >= 0 && index < m_size); return m_data[index]; }
+
+  void SetAll(const T& value) { for (int i = 0; i < m_size; i++) m_data[i] = value; }
+
+  void CopyFrom(const tArraySlice& src)
+  {
+    assert(src.m_size == m_size);
+    if (m_size) memcpy(m_data, src.m_data, m_size * sizeof(T));
+  }
+
+  operator Apto::Array<T>() const
+  {
+    Apto::Array<T> arr(m_size);
+    for (int i = 0; i < m_size; i++) arr[i] = m_data[i];
+    return arr;
+  }
+};
+
+#endif
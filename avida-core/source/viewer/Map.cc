@@ -51,12 +51,14 @@ private:
   static const double MAX_RESCALE_FACTOR;
 private:
   const Apto::String m_prop_id;
+  int m_prop_index;
   Apto::String m_prop_desc;
   Apto::String m_prop_desc_rescale;
   
   Apto::Array<int> m_color_grid;
   Apto::Array<int> m_color_count;
   Apto::Array<DiscreteScale::Entry> m_scale_labels;
+  Apto::Array<double> m_cell_values;
   
   double m_cur_min;
   double m_cur_max;
@@ -66,7 +68,7 @@ private:
   
 public:
   DoublePropMapMode(cWorld* world, const Apto::String& prop_id, const Apto::String& prop_desc)
-  : m_prop_id(prop_id), m_prop_desc(prop_desc), m_color_count(SCALE_MAX + Avida::Viewer::MAP_RESERVED_COLORS), m_scale_labels(SCALE_LABELS)
+  : m_prop_id(prop_id), m_prop_index(Avida::PropertyMap::Intern(prop_id)), m_prop_desc(prop_desc), m_color_count(SCALE_MAX + Avida::Viewer::MAP_RESERVED_COLORS), m_scale_labels(SCALE_LABELS)
   , m_cur_min(0.0), m_cur_max(0.0), m_target_max(0.0), m_rescale_rate_min(0.0), m_rescale_rate_max(0.0)
   {
     m_color_grid.Resize(world->GetPopulation().GetSize());
@@ -94,7 +96,10 @@ public:
   
   void Update(cPopulation& pop);
   
+private:
+  inline double cellValue(cOrganism* org) const;
   
+public:
   // DiscreteScale Interface
   int GetScaleRange() const { return m_color_count.GetSize() - Avida::Viewer::MAP_RESERVED_COLORS; }
   int GetNumLabeledEntries() const { return m_scale_labels.GetSize(); }
@@ -104,9 +109,15 @@ public:
 const double DoublePropMapMode::RESCALE_TOLERANCE = 0.1;
 const double DoublePropMapMode::MAX_RESCALE_FACTOR = 0.03;
 
+inline double DoublePropMapMode::cellValue(cOrganism* org) const
+{
+  return org->Properties().GetDouble(m_prop_index);
+}
+
 void DoublePropMapMode::Update(cPopulation& pop)
 {
   m_color_grid.Resize(pop.GetSize());
+  m_cell_values.Resize(pop.GetSize());
   
   // Keep track of how many times each color was assigned.
   m_color_count.SetAll(0);
@@ -118,7 +129,7 @@ void DoublePropMapMode::Update(cPopulation& pop)
   for (int i = 0; i < pop.GetSize(); i++) {
     cOrganism* org = pop.GetCell(i).GetOrganism();
     if (org == NULL) continue;
-    double fit = org->Properties().Get(m_prop_id);
+    double fit = m_cell_values[i] = cellValue(org);
     if (fit == 0.0) continue;
     if (fit > max_fit) max_fit = fit;
     if (fit < min_fit) min_fit = fit;
@@ -174,7 +185,7 @@ void DoublePropMapMode::Update(cPopulation& pop)
       continue;
     }
     
-    double fit = org->Properties().Get(m_prop_id);
+    double fit = m_cell_values[i];
     if (fit == 0.0) {
       m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY;
       m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY]++;
@@ -416,12 +427,17 @@ void EnvActionMapMode::Update(cPopulation& pop)
     if (org == NULL) {
       m_raw_action_counts[i].SetAll(0);
     } else {
+      // Genotypes still being tested in the background show no actions until their results arrive
+      Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
+      Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetricsIfReady(m_world, ctx, genotype));
+      if (!metrics) {
+        m_raw_action_counts[i].SetAll(0);
+        continue;
+      }
+      const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
       for (int task_id = 0; task_id < m_action_ids.GetSize(); task_id++) {
 //        if (org->GetPhenotype().GetLastTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
 //        else if (org->GetPhenotype().GetCurTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 2;
-        Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
-        Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
-        const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
         if (task_counts[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
         else m_raw_action_counts[i][task_id] = 0;
       }
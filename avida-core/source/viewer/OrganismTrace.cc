@@ -28,6 +28,8 @@
 #include "avida/core/WorldDriver.h"
 #include "avida/viewer/GraphicsContext.h"
 
+#include "avida/private/viewer/SnapshotDelta.h"
+
 #include "apto/rng.h"
 
 #include "cEnvironment.h"
@@ -143,8 +145,7 @@ private:
     void Notify(const char* fmt, ...) { (void)fmt; }
   } m_feedback;
 
-  Apto::Array<HardwareSnapshot*>* m_snapshots;
-  int m_snapshot_count;
+  OrganismTrace* m_trace;
   
   int m_genome_length;
   Instruction m_first_inst;
@@ -155,9 +156,9 @@ private:
   
 
 public:
-  LIB_LOCAL inline SnapshotTracer(cWorld* world) : m_world(world), m_snapshots(NULL) { ; }
+  LIB_LOCAL inline SnapshotTracer(cWorld* world) : m_world(world), m_trace(NULL) { ; }
   
-  LIB_LOCAL void TraceGenome(GenomePtr genome, Apto::Array<HardwareSnapshot*>& snapshots, double mut_rate, int seed);
+  LIB_LOCAL void TraceGenome(GenomePtr genome, OrganismTrace& trace, double mut_rate, int seed);
   
   LIB_LOCAL GenomePtr OffspringGenome() { return m_offspring_genome; }
   
@@ -183,15 +184,12 @@ public:
 // Private::SnapshotTracer Implementation
 // --------------------------------------------------------------------------------------------------------------  
 
-void Private::SnapshotTracer::TraceGenome(GenomePtr genome, Apto::Array<HardwareSnapshot*>& snapshots, double mut_rate, int seed)
+void Private::SnapshotTracer::TraceGenome(GenomePtr genome, OrganismTrace& trace, double mut_rate, int seed)
 {
-  // Create internal reference to the snapshot array so that the tracing methods can create snapshots
-  m_snapshots = &snapshots;
-  m_snapshots->Resize(300);
+  // Create internal reference to the trace so that the tracing methods can add snapshots
+  m_trace = &trace;
   
   // Set up tracking objects and variables
-  m_snapshot_count = 0;
-  
   InstructionSequencePtr seq;
   seq.DynamicCastFrom(genome->Representation());
   m_genome_length = seq->GetSize();
@@ -222,8 +220,9 @@ void Private::SnapshotTracer::TraceGenome(GenomePtr genome, Apto::Array<Hardware
   // Test the actual genome
   testcpu->TestGenome(ctx, test_info, *genome);
   
-  // Clear internal reference to the snapshot array
-  m_snapshots = NULL;
+  // Release the last full snapshot and clear internal reference to the trace
+  m_trace->finishTrace();
+  m_trace = NULL;
   
   m_genome = GenomePtr();
 }
@@ -238,14 +237,7 @@ void Private::SnapshotTracer::TraceHardware(cAvidaContext& ctx, cHardwareBase& h
   if (mini) return;
   
   // Create snapshot based on current hardware state
-  m_snapshot_count++;
-  
-  // Make sure snapshot array is big enough (just in case bonus cycles or threads are in use)
-  if (m_snapshots->GetSize() < m_snapshot_count) m_snapshots->Resize(m_snapshots->GetSize() * 2);
-  
-  HardwareSnapshot* prev_snapshot = (m_snapshot_count > 1) ? (*m_snapshots)[m_snapshot_count - 2] : NULL;
-  HardwareSnapshot* snapshot = new HardwareSnapshot(hw.GetNumRegisters(), prev_snapshot);
-  (*m_snapshots)[m_snapshot_count - 1] = snapshot;
+  HardwareSnapshot* snapshot = new HardwareSnapshot(hw.GetNumRegisters(), m_trace->m_last_snapshot);
   
   snapshot->SetInstSet(hw.GetInstSet());
   
@@ -273,7 +265,7 @@ void Private::SnapshotTracer::TraceHardware(cAvidaContext& ctx, cHardwareBase& h
   snapshot->SetSelectedBuffer(Apto::FormatStr("stack %c", 'A' + hw.GetCurStack()));
   
   // Handle function counts
-  const Apto::Array<int>& task_counts = hw.GetOrganism()->GetPhenotype().GetCurTaskCount();
+  const tArraySlice<int>& task_counts = hw.GetOrganism()->GetPhenotype().GetCurTaskCount();
   for (int i = 0; i < task_counts.GetSize(); i++) {
     snapshot->SetFunctionCount((const char*)m_world->GetEnvironment().GetTask(i).GetName(), task_counts[i]);
   }
@@ -344,6 +336,8 @@ void Private::SnapshotTracer::TraceHardware(cAvidaContext& ctx, cHardwareBase& h
   
   // Store next instruction that will be executed
   snapshot->SetNextInst(hw.IP().GetInst());
+  
+  m_trace->addSnapshot(snapshot);
 }
 
 
@@ -358,16 +352,10 @@ void Private::SnapshotTracer::TraceTestCPU(int time_used, int time_allocated, co
   // Did the organism successfully reproduce before running out of time?
   if (time_used != time_allocated) {
     // Create snapshot based on current hardware state
-    m_snapshot_count++;
-    
-    // Make sure snapshot array is big enough (just in case bonus cycles or threads are in use)
-    if (m_snapshots->GetSize() < m_snapshot_count) m_snapshots->Resize(m_snapshots->GetSize() * 2);
-    
     cHardwareBase& hw = const_cast<cHardwareBase&>(organism.GetHardware());
     
-    HardwareSnapshot* prev_snapshot = (m_snapshot_count > 1) ? (*m_snapshots)[m_snapshot_count - 2] : NULL;
+    HardwareSnapshot* prev_snapshot = m_trace->m_last_snapshot;
     HardwareSnapshot* snapshot = new HardwareSnapshot(hw.GetNumRegisters(), prev_snapshot);
-    (*m_snapshots)[m_snapshot_count - 1] = snapshot;
     
     snapshot->SetInstSet(organism.GetHardware().GetInstSet());
     snapshot->SetPostDivide();
@@ -396,7 +384,7 @@ void Private::SnapshotTracer::TraceTestCPU(int time_used, int time_allocated, co
     snapshot->SetSelectedBuffer(Apto::FormatStr("stack %c", 'A' + hw.GetCurStack()));
     
     // Handle function counts
-    const Apto::Array<int>& task_counts = organism.GetPhenotype().GetLastTaskCount();
+    const tArraySlice<int>& task_counts = organism.GetPhenotype().GetLastTaskCount();
     for (int i = 0; i < task_counts.GetSize(); i++) {
       snapshot->SetFunctionCount((const char*)m_world->GetEnvironment().GetTask(i).GetName(), task_counts[i]);
     }
@@ -435,10 +423,291 @@ void Private::SnapshotTracer::TraceTestCPU(int time_used, int time_allocated, co
       mutated[i] = prev_mutated[i];
     }
     snapshot->AddMemSpace("offspring", memory, mutated);
+    
+    m_trace->addSnapshot(snapshot);
+  }
+}
+
+
+
+
+// Private::SnapshotDelta Implementation
+// --------------------------------------------------------------------------------------------------------------  
+
+Private::SnapshotDelta::SnapshotDelta(const HardwareSnapshot& prev, const HardwareSnapshot& cur)
+  : m_inst_set(cur.m_inst_set), m_num_registers(cur.m_registers.GetSize()), m_buffers_replaced(false)
+  , m_selected_buffer_changed(false), m_function_counts_replaced(false), m_num_mem_spaces(cur.m_mem_spaces.GetSize())
+  , m_num_jumps(cur.m_jumps.GetSize()), m_next_inst(cur.m_next_inst), m_post_divide(cur.m_post_divide)
+{
+  // Registers
+  for (int i = 0; i < m_num_registers; i++) {
+    if (i >= prev.m_registers.GetSize() || prev.m_registers[i] != cur.m_registers[i]) {
+      RegisterChange change;
+      change.idx = i;
+      change.value = cur.m_registers[i];
+      m_registers.Push(change);
+    }
+  }
+  
+  // Buffers
+  m_buffers_replaced = !sameKeys(prev.m_buffers, cur.m_buffers);
+  for (Apto::Map<Apto::String, Apto::Array<int> >::ConstIterator it = cur.m_buffers.Begin(); it.Next();) {
+    const Apto::String& label = it.Get()->Value1();
+    const Apto::Array<int>& values = *it.Get()->Value2();
+    if (m_buffers_replaced || !sameValues(prev.m_buffers.GetWithDefault(label, prev.m_default_buffer), values)) {
+      m_buffer_labels.Push(label);
+      m_buffer_values.Push(values);
+    }
+  }
+  
+  if (prev.m_selected_buffer != cur.m_selected_buffer) {
+    m_selected_buffer_changed = true;
+    m_selected_buffer = cur.m_selected_buffer;
+  }
+  
+  // Function counts
+  m_function_counts_replaced = !sameKeys(prev.m_function_counts, cur.m_function_counts);
+  for (Apto::Map<Apto::String, int>::ConstIterator it = cur.m_function_counts.Begin(); it.Next();) {
+    const Apto::String& function = it.Get()->Value1();
+    const int count = *it.Get()->Value2();
+    int prev_count = 0;
+    if (m_function_counts_replaced || !prev.m_function_counts.Get(function, prev_count) || prev_count != count) {
+      m_function_names.Push(function);
+      m_function_counts.Push(count);
+    }
+  }
+  
+  // Memory spaces
+  for (int i = 0; i < m_num_mem_spaces; i++) {
+    diffMemSpace(i, (i < prev.m_mem_spaces.GetSize()) ? &prev.m_mem_spaces[i] : NULL, cur.m_mem_spaces[i]);
+  }
+  
+  // Jumps, existing entries only ever change frequency but new ones may be appended
+  for (int i = 0; i < m_num_jumps; i++) {
+    const HardwareSnapshot::Jump& jmp = cur.m_jumps[i];
+    if (i < prev.m_jumps.GetSize()) {
+      const HardwareSnapshot::Jump& prev_jmp = prev.m_jumps[i];
+      if (prev_jmp.from_mem_space == jmp.from_mem_space && prev_jmp.from_idx == jmp.from_idx &&
+          prev_jmp.to_mem_space == jmp.to_mem_space && prev_jmp.to_idx == jmp.to_idx && prev_jmp.freq == jmp.freq) {
+        continue;
+      }
+    }
+    JumpChange change;
+    change.idx = i;
+    change.jump = jmp;
+    m_jumps.Push(change);
+  }
+}
+
+
+void Private::SnapshotDelta::diffMemSpace(int idx, const HardwareSnapshot::MemSpace* prev,
+                                          const HardwareSnapshot::MemSpace& cur)
+{
+  const bool relabeled = (!prev || prev->label != cur.label);
+  const int prev_size = (relabeled) ? 0 : prev->memory.GetSize();
+  const int cur_size = cur.memory.GetSize();
+  
+  // Trim the common prefix and suffix, leaving the span that was written, inserted or removed
+  int start = 0;
+  while (start < prev_size && start < cur_size && prev->memory[start] == cur.memory[start] &&
+         prev->mutated[start] == cur.mutated[start]) {
+    start++;
+  }
+  int prev_end = prev_size;
+  int cur_end = cur_size;
+  while (prev_end > start && cur_end > start && prev->memory[prev_end - 1] == cur.memory[cur_end - 1] &&
+         prev->mutated[prev_end - 1] == cur.mutated[cur_end - 1]) {
+    prev_end--;
+    cur_end--;
+  }
+  
+  bool heads_changed = (relabeled || !sameKeys(prev->heads, cur.heads));
+  for (Apto::Map<Apto::String, int>::ConstIterator it = cur.heads.Begin(); !heads_changed && it.Next();) {
+    int prev_pos = 0;
+    if (!prev->heads.Get(it.Get()->Value1(), prev_pos) || prev_pos != *it.Get()->Value2()) heads_changed = true;
+  }
+  
+  if (!relabeled && start == prev_end && start == cur_end && !heads_changed) return;
+  
+  const int change_idx = m_mem_spaces.GetSize();
+  m_mem_spaces.Resize(change_idx + 1);
+  MemSpaceChange& change = m_mem_spaces[change_idx];
+  change.mem_space = idx;
+  change.relabeled = relabeled;
+  if (relabeled) change.label = cur.label;
+  change.start = start;
+  change.removed = prev_end - start;
+  change.memory.Resize(cur_end - start);
+  change.mutated.Resize(cur_end - start);
+  for (int i = start; i < cur_end; i++) {
+    change.memory[i - start] = cur.memory[i];
+    change.mutated[i - start] = cur.mutated[i];
+  }
+  
+  change.heads_changed = heads_changed;
+  if (heads_changed) {
+    for (Apto::Map<Apto::String, int>::ConstIterator it = cur.heads.Begin(); it.Next();) {
+      change.head_labels.Push(it.Get()->Value1());
+      change.head_positions.Push(*it.Get()->Value2());
+    }
+  }
+}
+
+
+void Private::SnapshotDelta::ApplyTo(HardwareSnapshot& snapshot) const
+{
+  snapshot.m_inst_set = m_inst_set;
+  
+  if (snapshot.m_registers.GetSize() != m_num_registers) snapshot.m_registers.Resize(m_num_registers);
+  for (int i = 0; i < m_registers.GetSize(); i++) snapshot.m_registers[m_registers[i].idx] = m_registers[i].value;
+  
+  if (m_buffers_replaced) snapshot.m_buffers.Clear();
+  for (int i = 0; i < m_buffer_labels.GetSize(); i++) snapshot.m_buffers.Set(m_buffer_labels[i], m_buffer_values[i]);
+  if (m_selected_buffer_changed) snapshot.m_selected_buffer = m_selected_buffer;
+  
+  if (m_function_counts_replaced) snapshot.m_function_counts.Clear();
+  for (int i = 0; i < m_function_names.GetSize(); i++) {
+    snapshot.m_function_counts.Set(m_function_names[i], m_function_counts[i]);
+  }
+  
+  snapshot.m_mem_spaces.Resize(m_num_mem_spaces);
+  for (int i = 0; i < m_mem_spaces.GetSize(); i++) {
+    const MemSpaceChange& change = m_mem_spaces[i];
+    HardwareSnapshot::MemSpace& mem_space = snapshot.m_mem_spaces[change.mem_space];
+    Apto::Array<Instruction>& memory = mem_space.memory;
+    Apto::Array<bool>& mutated = mem_space.mutated;
+    
+    if (change.relabeled) {
+      mem_space.label = change.label;
+      memory.Resize(0);
+      mutated.Resize(0);
+    }
+    
+    // Move the common suffix into place, then copy in the changed span
+    const int inserted = change.memory.GetSize();
+    const int old_size = memory.GetSize();
+    const int suffix_start = change.start + change.removed;
+    const int shift = inserted - change.removed;
+    if (shift > 0) {
+      memory.Resize(old_size + shift);
+      mutated.Resize(old_size + shift);
+      for (int j = old_size - 1; j >= suffix_start; j--) {
+        memory[j + shift] = memory[j];
+        mutated[j + shift] = mutated[j];
+      }
+    } else if (shift < 0) {
+      for (int j = suffix_start; j < old_size; j++) {
+        memory[j + shift] = memory[j];
+        mutated[j + shift] = mutated[j];
+      }
+      memory.Resize(old_size + shift);
+      mutated.Resize(old_size + shift);
+    }
+    for (int j = 0; j < inserted; j++) {
+      memory[change.start + j] = change.memory[j];
+      mutated[change.start + j] = change.mutated[j];
+    }
+    
+    if (change.heads_changed) {
+      mem_space.heads.Clear();
+      for (int j = 0; j < change.head_labels.GetSize(); j++) {
+        mem_space.heads.Set(change.head_labels[j], change.head_positions[j]);
+      }
+    }
+  }
+  
+  snapshot.m_jumps.Resize(m_num_jumps);
+  for (int i = 0; i < m_jumps.GetSize(); i++) snapshot.m_jumps[m_jumps[i].idx] = m_jumps[i].jump;
+  
+  snapshot.m_next_inst = m_next_inst;
+  snapshot.m_post_divide = m_post_divide;
+}
+
+
+size_t Private::SnapshotDelta::MemoryUsage() const
+{
+  size_t size = sizeof(SnapshotDelta);
+  size += m_registers.GetSize() * sizeof(RegisterChange);
+  for (int i = 0; i < m_buffer_labels.GetSize(); i++) {
+    size += sizeof(Apto::String) + m_buffer_labels[i].GetSize();
+    size += sizeof(Apto::Array<int>) + m_buffer_values[i].GetSize() * sizeof(int);
+  }
+  size += m_selected_buffer.GetSize();
+  for (int i = 0; i < m_function_names.GetSize(); i++) {
+    size += sizeof(Apto::String) + m_function_names[i].GetSize() + sizeof(int);
+  }
+  for (int i = 0; i < m_mem_spaces.GetSize(); i++) {
+    const MemSpaceChange& change = m_mem_spaces[i];
+    size += sizeof(MemSpaceChange) + change.label.GetSize();
+    size += change.memory.GetSize() * (sizeof(Instruction) + sizeof(bool));
+    for (int j = 0; j < change.head_labels.GetSize(); j++) {
+      size += sizeof(Apto::String) + change.head_labels[j].GetSize() + sizeof(int);
+    }
+  }
+  size += m_jumps.GetSize() * sizeof(JumpChange);
+  return size;
+}
+
+
+bool Private::SnapshotDelta::SameSnapshot(const HardwareSnapshot& a, const HardwareSnapshot& b)
+{
+  if (a.m_inst_set != b.m_inst_set || !sameValues(a.m_registers, b.m_registers)) return false;
+  
+  if (!sameKeys(a.m_buffers, b.m_buffers) || a.m_selected_buffer != b.m_selected_buffer) return false;
+  for (Apto::Map<Apto::String, Apto::Array<int> >::ConstIterator it = b.m_buffers.Begin(); it.Next();) {
+    if (!sameValues(a.m_buffers.GetWithDefault(it.Get()->Value1(), a.m_default_buffer), *it.Get()->Value2())) return false;
+  }
+  
+  if (!sameKeys(a.m_function_counts, b.m_function_counts)) return false;
+  for (Apto::Map<Apto::String, int>::ConstIterator it = b.m_function_counts.Begin(); it.Next();) {
+    if (a.m_function_counts.GetWithDefault(it.Get()->Value1(), 0) != *it.Get()->Value2()) return false;
+  }
+  
+  if (a.m_mem_spaces.GetSize() != b.m_mem_spaces.GetSize()) return false;
+  for (int i = 0; i < a.m_mem_spaces.GetSize(); i++) {
+    const HardwareSnapshot::MemSpace& a_space = a.m_mem_spaces[i];
+    const HardwareSnapshot::MemSpace& b_space = b.m_mem_spaces[i];
+    if (a_space.label != b_space.label || a_space.memory.GetSize() != b_space.memory.GetSize()) return false;
+    if (a_space.mutated.GetSize() != b_space.mutated.GetSize()) return false;
+    for (int j = 0; j < a_space.memory.GetSize(); j++) if (a_space.memory[j] != b_space.memory[j]) return false;
+    for (int j = 0; j < a_space.mutated.GetSize(); j++) if (a_space.mutated[j] != b_space.mutated[j]) return false;
+    
+    if (!sameKeys(a_space.heads, b_space.heads)) return false;
+    for (Apto::Map<Apto::String, int>::ConstIterator it = b_space.heads.Begin(); it.Next();) {
+      if (a_space.heads.GetWithDefault(it.Get()->Value1(), -1) != *it.Get()->Value2()) return false;
+    }
   }
   
-  // Resize the snapshot array to the actual number of snapshots
-  m_snapshots->Resize(m_snapshot_count);
+  if (a.m_jumps.GetSize() != b.m_jumps.GetSize()) return false;
+  for (int i = 0; i < a.m_jumps.GetSize(); i++) {
+    const HardwareSnapshot::Jump& a_jmp = a.m_jumps[i];
+    const HardwareSnapshot::Jump& b_jmp = b.m_jumps[i];
+    if (a_jmp.from_mem_space != b_jmp.from_mem_space || a_jmp.from_idx != b_jmp.from_idx ||
+        a_jmp.to_mem_space != b_jmp.to_mem_space || a_jmp.to_idx != b_jmp.to_idx || a_jmp.freq != b_jmp.freq) {
+      return false;
+    }
+  }
+  
+  return (a.m_next_inst == b.m_next_inst && a.m_post_divide == b.m_post_divide);
+}
+
+
+template <typename T> bool Private::SnapshotDelta::sameKeys(const Apto::Map<Apto::String, T>& a,
+                                                            const Apto::Map<Apto::String, T>& b)
+{
+  if (a.GetSize() != b.GetSize()) return false;
+  for (typename Apto::Map<Apto::String, T>::ConstIterator it = b.Begin(); it.Next();) {
+    if (!a.Has(it.Get()->Value1())) return false;
+  }
+  return true;
+}
+
+
+bool Private::SnapshotDelta::sameValues(const Apto::Array<int>& a, const Apto::Array<int>& b)
+{
+  if (a.GetSize() != b.GetSize()) return false;
+  for (int i = 0; i < a.GetSize(); i++) if (a[i] != b[i]) return false;
+  return true;
 }
 
 
@@ -694,20 +963,140 @@ const Apto::Array<bool>& Avida::Viewer::HardwareSnapshot::MutatedStateOfMemSpace
 }
 
 
+size_t Avida::Viewer::HardwareSnapshot::MemoryUsage() const
+{
+  size_t size = sizeof(HardwareSnapshot);
+  size += m_registers.GetSize() * sizeof(int);
+  for (Apto::Map<Apto::String, Apto::Array<int> >::ConstIterator it = m_buffers.Begin(); it.Next();) {
+    size += sizeof(Apto::String) + it.Get()->Value1().GetSize();
+    size += sizeof(Apto::Array<int>) + it.Get()->Value2()->GetSize() * sizeof(int);
+  }
+  size += m_selected_buffer.GetSize();
+  for (Apto::Map<Apto::String, int>::ConstIterator it = m_function_counts.Begin(); it.Next();) {
+    size += sizeof(Apto::String) + it.Get()->Value1().GetSize() + sizeof(int);
+  }
+  for (int i = 0; i < m_mem_spaces.GetSize(); i++) {
+    const MemSpace& mem_space = m_mem_spaces[i];
+    size += sizeof(MemSpace) + mem_space.label.GetSize();
+    size += mem_space.memory.GetSize() * (sizeof(Instruction) + sizeof(bool));
+    for (Apto::Map<Apto::String, int>::ConstIterator it = mem_space.heads.Begin(); it.Next();) {
+      size += sizeof(Apto::String) + it.Get()->Value1().GetSize() + sizeof(int);
+    }
+  }
+  size += m_jumps.GetSize() * sizeof(Jump);
+  return size;
+}
+
+
+
 
 // OrganismTrace Implementation
 // --------------------------------------------------------------------------------------------------------------  
 
 OrganismTrace::OrganismTrace(cWorld* world, GenomePtr genome, double mut_rate, int seed)
-  : m_genome(genome)
+  : m_genome(genome), m_snapshot_count(0), m_last_snapshot(NULL), m_cache_clock(0), m_storage_size(0), m_peak_memory(0)
 {
+  for (int i = 0; i < SNAPSHOT_CACHE_SIZE; i++) {
+    m_cache[i].step = -1;
+    m_cache[i].last_use = 0;
+    m_cache[i].snapshot = NULL;
+  }
+  
   Private::SnapshotTracer tracer(world);
-  tracer.TraceGenome(genome, m_snapshots, mut_rate, seed);
+  tracer.TraceGenome(genome, *this, mut_rate, seed);
   m_offspring_genome = tracer.OffspringGenome();
 }
 
 
 OrganismTrace::~OrganismTrace()
 {
-  for (int i = 0; i < m_snapshots.GetSize(); i++) delete m_snapshots[i];
+  for (int i = 0; i < m_keyframes.GetSize(); i++) delete m_keyframes[i];
+  for (int i = 0; i < m_deltas.GetSize(); i++) delete m_deltas[i];
+  for (int i = 0; i < SNAPSHOT_CACHE_SIZE; i++) delete m_cache[i].snapshot;
+}
+
+
+const HardwareSnapshot& OrganismTrace::Snapshot(int idx) const
+{
+  assert(idx >= 0 && idx < m_snapshot_count);
+  
+  const int keyframe = idx / KEYFRAME_INTERVAL;
+  m_cache_clock++;
+  
+  // Look for the step itself among the recently rebuilt ones, along with the closest earlier step since its keyframe
+  CachedSnapshot* base = NULL;
+  CachedSnapshot* entry = &m_cache[0];
+  for (int i = 0; i < SNAPSHOT_CACHE_SIZE; i++) {
+    CachedSnapshot& cached = m_cache[i];
+    if (cached.step == idx) {
+      cached.last_use = m_cache_clock;
+      return *cached.snapshot;
+    }
+    if (cached.step >= keyframe * KEYFRAME_INTERVAL && cached.step < idx && (!base || cached.step > base->step)) {
+      base = &cached;
+    }
+    if (cached.last_use < entry->last_use) entry = &cached;
+  }
+  
+  // Rebuild into the least recently used entry, starting from the base step (in place if it is being evicted anyway)
+  if (!entry->snapshot) entry->snapshot = new HardwareSnapshot(0);
+  int step = keyframe * KEYFRAME_INTERVAL;
+  if (base) {
+    if (base != entry) *entry->snapshot = *base->snapshot;
+    step = base->step;
+  } else {
+    *entry->snapshot = *m_keyframes[keyframe];
+  }
+  for (step++; step <= idx; step++) m_deltas[step]->ApplyTo(*entry->snapshot);
+  
+  entry->step = idx;
+  entry->last_use = m_cache_clock;
+  
+  size_t cache_size = 0;
+  for (int i = 0; i < SNAPSHOT_CACHE_SIZE; i++) if (m_cache[i].snapshot) cache_size += m_cache[i].snapshot->MemoryUsage();
+  updatePeakMemoryUsage(cache_size);
+  
+  return *entry->snapshot;
+}
+
+
+void OrganismTrace::addSnapshot(HardwareSnapshot* snapshot)
+{
+  const bool is_keyframe = (m_snapshot_count % KEYFRAME_INTERVAL == 0);
+  const bool last_is_keyframe = (m_snapshot_count - 1) % KEYFRAME_INTERVAL == 0;
+  
+  size_t working_size = 0;
+  if (is_keyframe) {
+    m_keyframes.Push(snapshot);
+    m_deltas.Push(NULL);
+    m_storage_size += snapshot->MemoryUsage();
+  } else {
+    Private::SnapshotDelta* delta = new Private::SnapshotDelta(*m_last_snapshot, *snapshot);
+    m_deltas.Push(delta);
+    m_storage_size += delta->MemoryUsage();
+    working_size += snapshot->MemoryUsage();
+  }
+  
+  // Only keyframes are retained in full, intermediate steps are kept just long enough to diff against the next one
+  if (m_last_snapshot && !last_is_keyframe) {
+    working_size += m_last_snapshot->MemoryUsage();
+    delete m_last_snapshot;
+  }
+  updatePeakMemoryUsage(working_size);
+  
+  m_last_snapshot = snapshot;
+  m_snapshot_count++;
+}
+
+
+void OrganismTrace::finishTrace()
+{
+  if (m_last_snapshot && (m_snapshot_count - 1) % KEYFRAME_INTERVAL != 0) delete m_last_snapshot;
+  m_last_snapshot = NULL;
+}
+
+
+void OrganismTrace::updatePeakMemoryUsage(size_t working_size) const
+{
+  if (m_storage_size + working_size > m_peak_memory) m_peak_memory = m_storage_size + working_size;
 }
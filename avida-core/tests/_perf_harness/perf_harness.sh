@@ -0,0 +1,127 @@
+#!/bin/sh
+#
+# Shared helpers for the runner scripts of the *_perf_* and self-checking consistency tests.  A runner sources this file
+# with
+#
+#   . `dirname $0`/../../_perf_harness/perf_harness.sh
+#
+# and then describes its experiment as a series of perf_run calls, each of which runs the avida binary passed as the
+# runner's first argument with the given -set options and its own data directory.  Timings come from a monotonic clock
+# with sub-second resolution, and each configuration is run PERF_REPEAT times (default 3), reporting the median.
+#
+# This directory starts with an underscore so the test runner does not mistake it for a test.
+
+perf_app=$1
+PERF_REPEAT=${PERF_REPEAT:-3}
+
+
+# Print seconds on a monotonic clock, to the microsecond
+perf_now()
+{
+  perl -MTime::HiRes=clock_gettime,CLOCK_MONOTONIC -e 'printf "%.6f\n", clock_gettime(CLOCK_MONOTONIC)'
+}
+
+
+# perf_run NAME [ARGS...]
+#   Run the world PERF_REPEAT times with ARGS, writing data to data_NAME, and set perf_elapsed to the median wall time
+#   in seconds.  Avida's output goes to perf_NAME.log.  Exits the runner if avida fails.
+perf_run()
+{
+  perf_name=$1
+  shift
+  echo Starting $perf_name...
+  perf_times=""
+  perf_i=0
+  while [ $perf_i -lt $PERF_REPEAT ]
+  do
+    rm -rf data_$perf_name
+    perf_start=`perf_now`
+    $perf_app "$@" -set DATA_DIR data_$perf_name > perf_$perf_name.log 2>&1 || { echo "$perf_name: avida failed, see perf_$perf_name.log"; exit 1; }
+    perf_end=`perf_now`
+    perf_times="$perf_times `echo $perf_start $perf_end | awk '{ printf "%.6f", $2 - $1 }'`"
+    perf_i=`expr $perf_i + 1`
+  done
+  perf_elapsed=`echo $perf_times | tr ' ' '\n' | sort -n | awk '{ t[NR] = $1 } END { printf "%.6f", t[int((NR + 1) / 2)] }'`
+}
+
+
+# data_column FILE NAME
+#   Print the column number of NAME in an Avida data file's legend ("#  N: NAME")
+data_column()
+{
+  awk -v name="$2" '/^# *[0-9]+: / { n = $2; sub(":", "", n); $1 = ""; $2 = ""; sub(/^ +/, ""); if ($0 == name) { print n; exit } }' $1
+}
+
+
+# data_sum FILE COLUMN, data_mean FILE COLUMN, data_last FILE COLUMN
+#   Sum, average over rows, or final value of a column of an Avida data file, skipping comment lines
+data_sum()
+{
+  grep -v '^#' $1 | awk -v c=$2 'NF { sum += $c } END { printf "%.0f", sum }'
+}
+
+data_mean()
+{
+  grep -v '^#' $1 | awk -v c=$2 'NF { sum += $c; n++ } END { printf "%g", (n > 0) ? sum / n : 0 }'
+}
+
+data_last()
+{
+  grep -v '^#' $1 | awk -v c=$2 'NF { v = $c } END { printf "%g", v }'
+}
+
+
+# perf_report NAME COUNT UNIT
+#   Report COUNT UNIT processed by the last perf_run, and the rate per second
+perf_report()
+{
+  awk -v label="$1" -v count=$2 -v unit=$3 -v t=$perf_elapsed \
+    'BEGIN { printf "%s: %s %s in %.3f seconds, %.0f %s/sec\n", label, count, unit, t, (t > 0) ? count / t : 0, unit }'
+}
+
+
+# samedata DIR1 DIR2
+#   Compare two data directories file by file, ignoring comment lines (which carry time stamps)
+samedata()
+{
+  for file in `cd $1 && find . -type f`
+  do
+    [ -f $2/$file ] || { echo "$file missing from $2"; return 1; }
+    grep -v '^#' $1/$file > data_cmp_a
+    grep -v '^#' $2/$file > data_cmp_b
+    cmp -s data_cmp_a data_cmp_b || { echo "$file differs"; return 1; }
+  done
+}
+
+
+# same_mean FILE1 FILE2
+#   Welch's two-sample t-test on the values in FILE1 and FILE2 (one per line).  Prints the means, t and degrees of
+#   freedom, and returns nonzero if the means differ at the 1% significance level (two-sided).  Samples with no variance
+#   at all only pass if their means are equal.
+same_mean()
+{
+  awk '
+    BEGIN {
+      split("63.657 9.925 5.841 4.604 4.032 3.707 3.499 3.355 3.250 3.169 3.106 3.055 3.012 2.977 2.947 " \
+            "2.921 2.898 2.878 2.861 2.845 2.831 2.819 2.807 2.797 2.787 2.779 2.771 2.763 2.756 2.750", crit, " ")
+    }
+    FNR == 1 { f++ }
+    NF { n[f]++; s[f] += $1; ss[f] += $1 * $1 }
+    END {
+      for (i = 1; i <= 2; i++) {
+        m[i] = s[i] / n[i]
+        v[i] = (n[i] > 1) ? (ss[i] - s[i] * s[i] / n[i]) / (n[i] - 1) : 0
+        if (v[i] < 0) v[i] = 0
+        e[i] = v[i] / n[i]
+      }
+      if (e[1] + e[2] == 0) {
+        printf "  means %g and %g, no variance\n", m[1], m[2]
+        exit (m[1] == m[2]) ? 0 : 1
+      }
+      t = (m[1] - m[2]) / sqrt(e[1] + e[2])
+      df = (e[1] + e[2]) ^ 2 / (((n[1] > 1) ? e[1] ^ 2 / (n[1] - 1) : 0) + ((n[2] > 1) ? e[2] ^ 2 / (n[2] - 1) : 0))
+      c = (df < 1) ? crit[1] : ((df >= 30) ? crit[30] : crit[int(df)])
+      printf "  means %g and %g, t = %.3f with %.1f degrees of freedom, 1%% critical value %.3f\n", m[1], m[2], t, df, c
+      exit (t <= c && t >= -c) ? 0 : 1
+    }' $1 $2
+}
@@ -0,0 +1,132 @@
+ResA0000000 = [ ...
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+];
+ResA0000010 = [ ...
+0.19 0.40951 0.721057 0 0.721057 0.271 0.1 0.40951 0.3439 0.3439 
+0.271 0.721057 0.3439 0.3439 0.40951 0.40951 0.3439 0.3439 0.271 0.271 
+0.271 0.40951 0.1 0.3439 0.3439 0.19 0.19 0.3439 0.1 0.271 
+0.3439 0 0.40951 0.271 0.271 0.19 0.19 0.3439 0.19 0.1 
+0.1 0.1 0.1 0.271 0.19 0.19 0.3439 0.19 0.19 0.19 
+0.1 0.19 0.19 0 0 0.40951 0 0.19 0.3439 0.19 
+0 0.1 0 0.3439 0.19 0.271 0.271 0.3439 0.3439 0.3439 
+0.271 0 0.271 0.271 0.3439 0.271 0.3439 0.40951 0 0.3439 
+0.3439 0.3439 0.271 0.3439 0.3439 0.3439 0.3439 0.3439 0.271 0.19 
+0.3439 0.271 0.3439 0.271 0.3439 0.1 0.3439 0.3439 0.3439 0.3439 
+];
+ResA0000020 = [ ...
+0.569533 0.569533 0.19 0.271 0 0.3439 0 0.794109 0.19 0.1 
+0.468559 0.271 0.19 0.19 0.19 0.19 0 0.19 0.1 0.19 
+0.19 0 0.19 0.1 0.468559 0 0.3439 0.1 0.1 0.468559 
+0.271 0 0.1 0 0 0 0 0.3439 0 0.3439 
+0.271 0.271 0 0.521703 0 0 0 0.468559 0 0 
+0 0.1 0 0 0 0.271 0.271 0.1 0.1 0 
+0 0 0 0.19 0.71757 0.1 0 0.61258 0.1 0.1 
+0.271 0.271 0.521703 0 0 0.1 0 0.61258 0.40951 0.40951 
+0 0 0.521703 0.521703 0.1 0.1 0.569533 0.468559 0 0.19 
+0.521703 0.1 0.468559 0.19 0.1 0 0.1 0.19 0.19 0.521703 
+];
+ResA0000030 = [ ...
+0.849905 0.3439 0.521703 0.745813 0.651322 0 0.1 0.92821 0.3439 0.521703 
+0.61258 0.468559 0.19 0.1 0.40951 0.40951 0.1 0.3439 0.271 0 
+0.3439 0.468559 0.19 0.1 0.814698 0.1 0.1 0.19 0.271 0.61258 
+0.745813 0.3439 0 0 0 0.1 0.19 0.468559 0.19 0.3439 
+0.3439 0 0.1 0.19 0 0.271 0.1 0.61258 0.19 0.468559 
+0 0 0.3439 0.1 0.271 0.271 0.19 0.271 0.1 0.3439 
+0 0.651322 0 0 0.901523 0.19 0.19 0.864915 0.569533 0.1 
+0.3439 0.745813 0.833228 0.569533 0.651322 0.19 0 0.864915 0.569533 0.794109 
+0.40951 0.3439 0.833228 0.833228 0.686189 0.686189 0.569533 0.814698 0.19 0.3439 
+0.833228 0.686189 0.814698 0.71757 0.686189 0 0.19 0.569533 0.71757 0.19 
+];
+ResA0000040 = [ ...
+0 0.1 0.833228 0.40951 0.878423 0.651322 0.686189 0.974968 0.19 0 
+0.468559 0.814698 0.71757 0.686189 0.794109 0.521703 0.686189 0.1 0.745813 0.1 
+0.468559 0.3439 0.71757 0.686189 0.935389 0.521703 0.686189 0.468559 0 0.468559 
+0.911371 0.1 0.3439 0.651322 0.651322 0 0.71757 0.40951 0.468559 0.771232 
+0 0.651322 0.271 0.71757 0 0.521703 0.3439 0.569533 0.1 0.814698 
+0.3439 0.271 0.771232 0.271 0.3439 0.3439 0.71757 0.19 0.686189 0.3439 
+0.271 0.878423 0.651322 0.651322 0.40951 0 0.71757 0.952899 0.521703 0.686189 
+0.3439 0.3439 0.94185 0.3439 0.878423 0.1 0.651322 0.952899 0.569533 0.92821 
+0.468559 0.771232 0.94185 0.94185 0.890581 0.569533 0.569533 0.935389 0.71757 0.3439 
+0.1 0.890581 0.935389 0.901523 0.890581 0.651322 0.71757 0.521703 0.468559 0.71757 
+];
+ResA0000050 = [ ...
+0.569533 0.686189 0.94185 0.794109 0.957609 0.878423 0.569533 0.991272 0.71757 0.651322 
+0.814698 0 0.901523 0.890581 0.92821 0.833228 0.890581 0.61258 0.61258 0.686189 
+0.814698 0.771232 0.901523 0.61258 0.61258 0.40951 0.569533 0.814698 0.651322 0.1 
+0.969097 0.686189 0.468559 0.521703 0.61258 0.651322 0.521703 0.1 0.1 0.920234 
+0.468559 0.878423 0.19 0.521703 0.468559 0.833228 0.521703 0.468559 0.1 0.935389 
+0.771232 0.3439 0.920234 0.745813 0.468559 0.569533 0.901523 0.71757 0.468559 0.468559 
+0.3439 0.957609 0.569533 0.878423 0.794109 0.651322 0.901523 0.983577 0.271 0.521703 
+0.771232 0.771232 0.979724 0.771232 0.957609 0.686189 0.61258 0.19 0.271 0.974968 
+0.814698 0.920234 0.979724 0.979724 0.961848 0.849905 0.569533 0.271 0.61258 0.771232 
+0.686189 0.961848 0.977472 0.965663 0.961848 0.61258 0.521703 0.271 0.814698 0.61258 
+];
+ResA0000060 = [ ...
+0.849905 0.890581 0.979724 0.92821 0.985219 0.957609 0.849905 0.996957 0.901523 0.878423 
+0.935389 0.40951 0.965663 0.961848 0.974968 0.94185 0.961848 0.1 0.271 0.890581 
+0.935389 0.920234 0.965663 0.864915 0.864915 0.794109 0.19 0.569533 0.3439 0.686189 
+0.989225 0.890581 0.814698 0.19 0.864915 0.271 0.569533 0.686189 0.686189 0.40951 
+0.814698 0.957609 0.71757 0.61258 0.19 0.94185 0.569533 0.468559 0.686189 0.977472 
+0.920234 0.771232 0.972187 0.911371 0.569533 0.849905 0.965663 0.901523 0.468559 0.569533 
+0.771232 0.985219 0.849905 0.957609 0.92821 0.878423 0.1 0.994274 0.745813 0.569533 
+0.920234 0.920234 0.99293 0.521703 0.985219 0.890581 0 0.71757 0.745813 0.991272 
+0.935389 0.972187 0.19 0.99293 0.986697 0.947665 0.849905 0.745813 0.271 0.19 
+0.61258 0.986697 0.992145 0.988027 0.986697 0.864915 0.833228 0.745813 0.935389 0.864915 
+];
+ResA0000070 = [ ...
+0.947665 0.961848 0.99293 0.974968 0.61258 0.985219 0.947665 0.998939 0.965663 0.957609 
+0.977472 0.794109 0.988027 0.986697 0.991272 0.979724 0.986697 0.686189 0.745813 0.961848 
+0.977472 0.972187 0.988027 0.952899 0.952899 0.1 0.71757 0.849905 0.771232 0.271 
+0.996243 0.961848 0.935389 0.71757 0.1 0.745813 0.849905 0.890581 0.890581 0.271 
+0.935389 0.985219 0.901523 0.468559 0.71757 0.979724 0.849905 0.468559 0.890581 0.521703 
+0.972187 0.920234 0.990302 0.969097 0.468559 0.947665 0.988027 0.965663 0.814698 0.521703 
+0.920234 0.994846 0.947665 0.985219 0.974968 0.957609 0.40951 0.998003 0.911371 0.849905 
+0.972187 0.972187 0.997535 0.833228 0.994846 0.961848 0.651322 0.40951 0.3439 0.996957 
+0.977472 0.990302 0.71757 0.1 0.995362 0.981752 0.947665 0.911371 0.745813 0.71757 
+0.864915 0.995362 0.997261 0.995825 0.995362 0.952899 0.521703 0.521703 0.977472 0.952899 
+];
+ResA0000080 = [ ...
+0.981752 0.986697 0.997535 0.991272 0.864915 0.1 0.981752 0.99963 0.988027 0.985219 
+0.992145 0.92821 0.995825 0.995362 0.996957 0.99293 0.995362 0.890581 0.911371 0.986697 
+0.992145 0.990302 0.995825 0.983577 0.271 0.686189 0.3439 0.569533 0.920234 0.745813 
+0.99869 0.986697 0.977472 0.19 0.686189 0.3439 0.468559 0.61258 0.961848 0.745813 
+0.977472 0.994846 0.965663 0.814698 0.1 0.99293 0.468559 0.468559 0.468559 0.833228 
+0.990302 0.972187 0.996619 0.989225 0.814698 0.981752 0.995825 0.988027 0.935389 0.833228 
+0.972187 0.998203 0.981752 0.994846 0.991272 0.985219 0.794109 0.999304 0.969097 0.947665 
+0.990302 0.990302 0.99914 0.94185 0.998203 0.986697 0.569533 0.794109 0.1 0.998939 
+0.992145 0.996619 0.901523 0.468559 0.998383 0.993637 0.981752 0.969097 0.911371 0.1 
+0.952899 0.468559 0.999045 0.998544 0.998383 0.983577 0.833228 0.833228 0.992145 0.983577 
+];
+ResA0000090 = [ ...
+0.993637 0.995362 0.99914 0.996957 0.952899 0.686189 0.271 0.999871 0.995825 0.994846 
+0.997261 0.974968 0.998544 0.998383 0.998939 0.997535 0.998383 0.271 0.969097 0.995362 
+0.997261 0.996619 0.998544 0.994274 0.745813 0.890581 0.771232 0.849905 0.972187 0.911371 
+0.999543 0.995362 0.992145 0.71757 0.890581 0.771232 0.814698 0.3439 0.986697 0.911371 
+0.992145 0.998203 0.988027 0.935389 0.686189 0.997535 0.814698 0.3439 0.814698 0.94185 
+0.996619 0.990302 0.998821 0.996243 0.935389 0.993637 0.998544 0.995825 0.977472 0.94185 
+0.990302 0.19 0.993637 0.998203 0.996957 0.994846 0.92821 0.999757 0.989225 0.981752 
+0.996619 0.996619 0.9997 0.979724 0.999373 0.995362 0.849905 0.92821 0.686189 0.99963 
+0.997261 0.3439 0.468559 0.814698 0.999436 0.997781 0.993637 0.521703 0.969097 0.686189 
+0.983577 0.814698 0.999667 0.999492 0.3439 0.994274 0.94185 0.94185 0.997261 0.994274 
+];
+ResA0000100 = [ ...
+0.997781 0.998383 0.9997 0.998939 0.983577 0.890581 0.745813 0.999955 0.998544 0.998203 
+0.999045 0.991272 0.999492 0.999436 0.99963 0.569533 0.999436 0.745813 0.989225 0.998383 
+0.999045 0.998821 0.999492 0.998003 0.569533 0.961848 0.920234 0.947665 0.990302 0.969097 
+0.999841 0.998383 0.997261 0.901523 0.961848 0.920234 0.935389 0.771232 0.995362 0.969097 
+0.997261 0.999373 0.19 0.977472 0.890581 0.99914 0.935389 0.771232 0.935389 0.979724 
+0.998821 0.996619 0.999589 0.99869 0.977472 0.997781 0.999492 0.998544 0.992145 0.979724 
+0.996619 0.71757 0.997781 0.999373 0.998939 0.998203 0.974968 0.999915 0.19 0.993637 
+0.998821 0.468559 0.999896 0.99293 0.999782 0.998383 0.947665 0.974968 0.890581 0.999871 
+0.999045 0.771232 0.40951 0.935389 0.999803 0.999226 0.997781 0.521703 0.989225 0.890581 
+0.994274 0.935389 0.999884 0.999823 0 0.998003 0.979724 0.979724 0.999045 0.998003 
+];
@@ -0,0 +1,132 @@
+ResB0000000 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+2 2 2 2 2 2 2 2 2 2 
+2 2 2 2 2 2 2 2 2 2 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000010 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+5.65447 5.65447 4.99108 5.21959 5.72008 5.72008 5.96398 5.81008 5.81008 5.74447 
+5.58157 5.74447 6.31057 5.48157 5.40057 6.62008 5.48157 6.40057 6.55447 5.81008 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000020 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+7.27751 7.27751 6.0462 7.80173 6.49795 6.30039 5.82082 8.00763 7.53907 6.30889 
+6.2128 6.52962 6.72701 7.21722 5.86484 7.13059 7.16408 6.83619 5.59563 6.4525 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000030 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+8.00721 7.07282 7.18995 7.67741 8.12281 7.90003 7.64281 9.3053 8.33193 7.3935 
+7.14804 7.66802 7.66136 7.64229 7.31769 7.75903 6.23866 8.16785 6.8738 6.98503 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000040 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+7.87469 8.97935 7.6351 9.19016 8.95804 8.73634 8.522 9.75777 8.98791 9.09117 
+8.34948 8.07047 9.18457 8.44892 8.40864 8.03108 8.6885 8.9307 8.90996 8.29265 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000050 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.25895 9.64412 8.58492 8.85191 8.23953 9.17197 8.95321 9.32505 8.25969 9.68311 
+9.4245 8.59821 9.71568 9.45917 8.91368 8.83518 9.54271 9.62716 9.08849 8.87324 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000060 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.74161 9.87591 9.50659 9.12139 7.9557 9.71128 9.63501 9.23322 9.39319 9.88951 
+9.79934 9.51123 9.90086 9.81142 9.19076 9.59385 9.84055 9.87 9.15073 9.17666 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000070 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.90991 9.95673 9.82796 9.69365 9.2872 9.89933 9.87273 9.2012 9.78842 9.43003 
+9.93003 9.82958 9.96543 9.93425 9.12734 9.85839 9.9444 9.95467 9.70388 9.18148 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000080 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.96859 9.98491 9.94001 9.89318 8.75146 9.9649 9.95563 9.19003 9.33574 9.80126 
+9.9756 9.94058 9.98795 8.97707 9.69572 9.41918 9.98061 9.98419 9.89675 9.7146 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000090 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.98905 9.4633 9.97908 9.96275 9.56466 9.98776 9.98453 8.98858 9.76839 9.93071 
+9.99149 9.97928 9.9958 9.64333 9.89391 9.79748 9.99324 9.99449 9.964 9.90049 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000100 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+9.99618 9.81286 9.99271 9.98701 9.84821 9.99573 9.99461 9.64734 9.91924 9.97584 
+9.99703 9.99278 9.99853 9.87564 9.96301 9.92939 9.99764 9.99808 9.98745 9.9653 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
@@ -0,0 +1,139 @@
+/*
+ *  unittests/core/InstructionSequence.cc
+ *  avida-core
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/core/InstructionSequence.h"
+
+#include "apto/rng.h"
+
+#include "gtest/gtest.h"
+
+using namespace Avida;
+
+
+namespace {
+
+  // The full dynamic programming edit distance, as FindEditDistance computed it before the bit-vector version
+  int ReferenceEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2)
+  {
+    const int size1 = seq1.GetSize();
+    const int size2 = seq2.GetSize();
+
+    // Rows of the table alternate between the two arrays
+    Apto::Array<int> rows[2];
+    rows[0].Resize(size1 + 1);
+    rows[1].Resize(size1 + 1);
+    for (int j = 0; j <= size1; j++) rows[0][j] = j;
+
+    for (int i = 1; i <= size2; i++) {
+      const Apto::Array<int>& prev_row = rows[(i - 1) % 2];
+      Apto::Array<int>& cur_row = rows[i % 2];
+      cur_row[0] = i;
+      for (int j = 1; j <= size1; j++) {
+        const int subst = prev_row[j - 1] + ((seq1[j - 1] == seq2[i - 1]) ? 0 : 1);
+        cur_row[j] = Apto::Min(subst, Apto::Min(prev_row[j], cur_row[j - 1]) + 1);
+      }
+    }
+
+    return rows[size2 % 2][size1];
+  }
+
+  InstructionSequence RandomSequence(Apto::RNG::AvidaRNG& rng, int size, int num_ops)
+  {
+    InstructionSequence seq(size);
+    for (int i = 0; i < size; i++) seq[i] = Instruction(rng.GetUInt(num_ops));
+    return seq;
+  }
+
+  // A copy of seq with num_muts random substitutions, insertions and deletions
+  InstructionSequence Mutate(Apto::RNG::AvidaRNG& rng, const InstructionSequence& seq, int num_muts, int num_ops)
+  {
+    InstructionSequence mutant(seq);
+    for (int i = 0; i < num_muts; i++) {
+      const int kind = rng.GetUInt(3);
+      if (kind == 0 && mutant.GetSize()) {
+        mutant[rng.GetUInt(mutant.GetSize())] = Instruction(rng.GetUInt(num_ops));
+      } else if (kind == 1 || !mutant.GetSize()) {
+        mutant.Insert(rng.GetUInt(mutant.GetSize() + 1), Instruction(rng.GetUInt(num_ops)));
+      } else {
+        mutant.Remove(rng.GetUInt(mutant.GetSize()));
+      }
+    }
+    return mutant;
+  }
+
+  // Checks FindEditDistance, with and without a max_dist around the true distance, in both argument orders
+  void ExpectEditDistance(const InstructionSequence& seq1, const InstructionSequence& seq2)
+  {
+    const int dist = ReferenceEditDistance(seq1, seq2);
+    EXPECT_EQ(dist, InstructionSequence::FindEditDistance(seq1, seq2)) << seq1.GetSize() << " x " << seq2.GetSize();
+    EXPECT_EQ(dist, InstructionSequence::FindEditDistance(seq2, seq1)) << seq2.GetSize() << " x " << seq1.GetSize();
+
+    const int max_dists[] = { 0, 1, dist - 1, dist, dist + 1, dist * 2 };
+    for (int i = 0; i < 6; i++) {
+      const int max_dist = max_dists[i];
+      if (max_dist < 0) continue;
+      const int expected = (dist > max_dist) ? max_dist + 1 : dist;
+      EXPECT_EQ(expected, InstructionSequence::FindEditDistance(seq1, seq2, max_dist)) << "max_dist " << max_dist;
+      EXPECT_EQ(expected, InstructionSequence::FindEditDistance(seq2, seq1, max_dist)) << "max_dist " << max_dist;
+    }
+  }
+
+};
+
+
+TEST(InstructionSequenceEditDistance, EmptyAndIdentical)
+{
+  Apto::RNG::AvidaRNG rng(1);
+  const InstructionSequence empty;
+  const InstructionSequence seq = RandomSequence(rng, 100, 26);
+
+  ExpectEditDistance(empty, empty);
+  ExpectEditDistance(empty, seq);
+  ExpectEditDistance(seq, seq);
+}
+
+
+TEST(InstructionSequenceEditDistance, UnrelatedSequences)
+{
+  // Lengths on either side of the 64-site bit vector blocks, and instruction ops across the whole byte
+  Apto::RNG::AvidaRNG rng(2);
+  const int sizes[] = { 1, 2, 17, 63, 64, 65, 100, 127, 128, 129, 300 };
+  for (int i = 0; i < 11; i++) {
+    for (int j = 0; j < 11; j++) {
+      ExpectEditDistance(RandomSequence(rng, sizes[i], 26), RandomSequence(rng, sizes[j], 26));
+      ExpectEditDistance(RandomSequence(rng, sizes[i], 256), RandomSequence(rng, sizes[j], 4));
+    }
+  }
+}
+
+
+TEST(InstructionSequenceEditDistance, RelatedSequences)
+{
+  // Mutants share long runs with their parent, including at the front and end that are trimmed before the bit vectors
+  Apto::RNG::AvidaRNG rng(3);
+  for (int trial = 0; trial < 300; trial++) {
+    const int num_ops = (trial % 3) ? 26 : 3;
+    const InstructionSequence parent = RandomSequence(rng, 1 + rng.GetUInt(250), num_ops);
+    const InstructionSequence child = Mutate(rng, parent, rng.GetUInt(12), num_ops);
+    ExpectEditDistance(parent, child);
+    ExpectEditDistance(child, Mutate(rng, parent, rng.GetUInt(12), num_ops));
+  }
+}
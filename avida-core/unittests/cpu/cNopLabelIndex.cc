@@ -0,0 +1,275 @@
+/*
+ *  unittests/cpu/cNopLabelIndex.cc
+ *  avida-core
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cNopLabelIndex.h"
+
+#include "cCodeLabel.h"
+#include "cCPUMemory.h"
+#include "cHardwareExperimental.h"
+#include "cInstSet.h"
+
+#include "apto/rng.h"
+
+#include "gtest/gtest.h"
+
+using namespace Avida;
+
+
+namespace {
+
+  const int NUM_NOPS = 3;
+  const int LABEL_OP = NUM_NOPS;
+  const int NUM_OPS = NUM_NOPS + 3;
+  const int NUM_EDITS = 3000;
+
+  // The original label and nop sequence scans, working on a memory in place of a hardware's heads.  Each returns the
+  // position the hardware left its head at (the last nop of the match), or -1 if nothing was found.
+  class ScanSearch
+  {
+  private:
+    const cCPUMemory& m_memory;
+    const cInstSet& m_inst_set;
+    const cCodeLabel& m_label;
+
+    int next(int pos) const { return (pos + 1 < m_memory.GetSize()) ? pos + 1 : 0; }
+    int prev(int pos) const { return (pos > 0) ? pos - 1 : m_memory.GetSize() - 1; }
+    bool matches(int pos, int size_matched) const
+    {
+      return m_inst_set.IsNop(m_memory[pos]) && m_label[size_matched] == m_inst_set.GetNopMod(m_memory[pos]);
+    }
+
+  public:
+    ScanSearch(const cCPUMemory& memory, const cInstSet& inst_set, const cCodeLabel& label)
+      : m_memory(memory), m_inst_set(inst_set), m_label(label) { ; }
+
+    int LabelStart() const
+    {
+      int pos = 0;
+      while (pos < m_memory.GetSize()) {
+        if (m_inst_set.IsLabel(m_memory[pos])) {
+          pos++;
+          int size_matched = 0;
+          while (size_matched < m_label.GetSize() && pos < m_memory.GetSize() && matches(pos, size_matched)) {
+            size_matched++;
+            pos++;
+          }
+          if (size_matched == m_label.GetSize()) return pos - 1;
+          continue;
+        }
+        pos++;
+      }
+      return -1;
+    }
+
+    int NopSequenceStart() const
+    {
+      int pos = 0;
+      while (pos < m_memory.GetSize()) {
+        if (m_inst_set.IsNop(m_memory[pos])) {
+          int size_matched = 0;
+          while (size_matched < m_label.GetSize() && pos < m_memory.GetSize() && matches(pos, size_matched)) {
+            size_matched++;
+            pos++;
+          }
+          if (size_matched == m_label.GetSize()) return pos - 1;
+        }
+        pos++;
+      }
+      return -1;
+    }
+
+    int LabelForward(int from) const
+    {
+      int pos = next(from);
+      while (pos != from) {
+        if (m_inst_set.IsLabel(m_memory[pos])) {
+          pos = next(pos);
+          int size_matched = 0;
+          while (size_matched < m_label.GetSize() && pos != from && matches(pos, size_matched)) {
+            size_matched++;
+            pos = next(pos);
+          }
+          if (size_matched == m_label.GetSize()) return prev(pos);
+          continue;
+        }
+        pos = next(pos);
+      }
+      return -1;
+    }
+
+    int NopSequenceForward(int from) const
+    {
+      int pos = next(from);
+      while (pos != from) {
+        if (m_inst_set.IsNop(m_memory[pos])) {
+          int size_matched = 0;
+          while (size_matched < m_label.GetSize() && pos != from && matches(pos, size_matched)) {
+            size_matched++;
+            pos = next(pos);
+          }
+          if (size_matched == m_label.GetSize()) return prev(pos);
+        }
+        if (pos == from) break;
+        pos = next(pos);
+      }
+      return -1;
+    }
+
+    // First nop of the first match starting at or after from, and of the last match ending at or before end
+    int NopSequenceFrom(int from) const
+    {
+      for (int start = from; start + m_label.GetSize() <= m_memory.GetSize(); start++) {
+        int size_matched = 0;
+        while (size_matched < m_label.GetSize() && matches(start + size_matched, size_matched)) size_matched++;
+        if (size_matched == m_label.GetSize()) return start;
+      }
+      return -1;
+    }
+
+    int NopSequenceBefore(int end) const
+    {
+      for (int start = end - m_label.GetSize(); start >= 0; start--) {
+        int size_matched = 0;
+        while (size_matched < m_label.GetSize() && matches(start + size_matched, size_matched)) size_matched++;
+        if (size_matched == m_label.GetSize()) return start;
+      }
+      return -1;
+    }
+  };
+
+
+  class NopLabelIndexTest : public testing::Test
+  {
+  protected:
+    Apto::RNG::AvidaRNG m_rng;
+    cInstSet m_inst_set;
+
+    NopLabelIndexTest()
+      : m_rng(1)
+      , m_inst_set(NULL, "nop_label_index", HARDWARE_TYPE_CPU_EXPERIMENTAL, cHardwareExperimental::GetInstLib(), 0, 1)
+    {
+      // Set up the way LoadWithStringList() would, without needing a world for its instruction code settings
+      const char* names[NUM_OPS] = { "nop-A", "nop-B", "nop-C", "label", "inc", "IO" };
+      for (int i = 0; i < NUM_OPS; i++) {
+        const int fun_id = m_inst_set.m_inst_lib->GetIndex(names[i]);
+        m_inst_set.m_lib_name_map.Resize(i + 1);
+        m_inst_set.m_lib_name_map[i].lib_fun_id = fun_id;
+        m_inst_set.m_lib_name_map[i].redundancy = 1;
+        if ((*m_inst_set.m_inst_lib)[fun_id].IsNop()) {
+          m_inst_set.m_lib_nopmod_map.Resize(i + 1);
+          m_inst_set.m_lib_nopmod_map[i] = fun_id;
+        }
+      }
+    }
+
+    // Mostly nops, so that labels and long runs turn up often
+    Instruction randomInst()
+    {
+      const int roll = m_rng.GetUInt(20);
+      if (roll < 13) return Instruction(roll % NUM_NOPS);
+      if (roll < 16) return Instruction(LABEL_OP);
+      return Instruction(LABEL_OP + 1 + roll % 2);
+    }
+
+    cCodeLabel randomLabel()
+    {
+      cCodeLabel label;
+      const int size = 1 + m_rng.GetUInt(4);
+      for (int i = 0; i < size; i++) label.AddNop(m_rng.GetUInt(NUM_NOPS));
+      return label;
+    }
+
+    void edit(cCPUMemory& memory)
+    {
+      const int size = memory.GetSize();
+      switch (m_rng.GetUInt(5)) {
+        case 0: memory.Insert(m_rng.GetUInt(size + 1), randomInst()); break;
+        case 1: if (size > 1) memory.Remove(m_rng.GetUInt(size)); break;
+        case 2: memory.SetInst(m_rng.GetUInt(size), randomInst()); break;
+        case 3: memory[m_rng.GetUInt(size)] = randomInst(); break;
+        case 4: memory.Copy(m_rng.GetUInt(size), m_rng.GetUInt(size)); break;
+      }
+    }
+
+    // Every search, from every position, through the memory's current index
+    void expectSameAsScan(const cCPUMemory& memory, const cCodeLabel& label, int edit_num) const
+    {
+      const cNopLabelIndex& index = memory.GetNopLabelIndex(m_inst_set);
+      const ScanSearch scan(memory, m_inst_set, label);
+      const int size = memory.GetSize();
+      const int label_size = label.GetSize();
+      int found = 0;
+
+      int indexed = index.FindLabelStart(label, found) ? found + label_size : -1;
+      EXPECT_EQ(scan.LabelStart(), indexed) << "label start, edit " << edit_num;
+      indexed = index.FindNopSequenceStart(label, found) ? found + label_size - 1 : -1;
+      EXPECT_EQ(scan.NopSequenceStart(), indexed) << "nop sequence start, edit " << edit_num;
+
+      for (int pos = 0; pos < size; pos++) {
+        indexed = index.FindLabelForward(label, pos, found) ? (found + label_size) % size : -1;
+        EXPECT_EQ(scan.LabelForward(pos), indexed) << "label forward from " << pos << ", edit " << edit_num;
+        indexed = index.FindNopSequenceForward(label, pos, found) ? (found + label_size - 1) % size : -1;
+        EXPECT_EQ(scan.NopSequenceForward(pos), indexed) << "nop sequence forward from " << pos << ", edit " << edit_num;
+        indexed = index.FindNopSequenceFrom(label, pos, found) ? found : -1;
+        EXPECT_EQ(scan.NopSequenceFrom(pos), indexed) << "nop sequence from " << pos << ", edit " << edit_num;
+      }
+      for (int end = 0; end <= size; end++) {
+        indexed = index.FindNopSequenceBefore(label, end, found) ? found : -1;
+        EXPECT_EQ(scan.NopSequenceBefore(end), indexed) << "nop sequence before " << end << ", edit " << edit_num;
+      }
+    }
+  };
+
+};
+
+
+TEST_F(NopLabelIndexTest, SearchesMatchScanThroughEdits)
+{
+  cCPUMemory memory(40);
+  for (int i = 0; i < memory.GetSize(); i++) memory.SetInst(i, randomInst());
+
+  // Searching after every edit means each edit lands on a built index, which it has to keep in step or discard
+  for (int edit_num = 0; edit_num < NUM_EDITS; edit_num++) {
+    edit(memory);
+    expectSameAsScan(memory, randomLabel(), edit_num);
+    if (HasFailure()) break;
+  }
+}
+
+
+TEST_F(NopLabelIndexTest, SearchesMatchScanAfterReplace)
+{
+  cCPUMemory memory(60);
+  for (int i = 0; i < memory.GetSize(); i++) memory.SetInst(i, randomInst());
+
+  for (int round = 0; round < 200; round++) {
+    const cCodeLabel label = randomLabel();
+    expectSameAsScan(memory, label, round);
+
+    // Swap out a stretch for a fresh one of a different length, as a divide or a genome replacement does
+    InstructionSequence replacement(1 + m_rng.GetUInt(12));
+    for (int i = 0; i < replacement.GetSize(); i++) replacement[i] = randomInst();
+    const int pos = m_rng.GetUInt(memory.GetSize());
+    memory.Replace(pos, Apto::Min(memory.GetSize() - pos, 1 + (int)m_rng.GetUInt(12)), replacement);
+    expectSameAsScan(memory, label, round);
+    if (HasFailure()) break;
+  }
+}
@@ -0,0 +1,164 @@
+/*
+ *  unittests/main/cConnectionTable.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cConnectionTable.h"
+
+#include "cMutationRates.h"
+#include "cPopulationCell.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <vector>
+
+
+namespace {
+
+  const int NUM_CELLS = 10;
+
+  // Cells 0..NUM_CELLS-1 connected in a line, each to the cells on either side
+  class ConnectionTableTest : public testing::Test
+  {
+  protected:
+    cConnectionTable m_table;
+    Apto::Array<cPopulationCell> m_cells;
+
+    void SetUp()
+    {
+      m_cells.Resize(NUM_CELLS);
+      m_table.ResizeClear(NUM_CELLS, 2);
+      cMutationRates rates;
+      for (int i = 0; i < NUM_CELLS; i++) m_cells[i].Setup(NULL, &m_table, i, rates, i, 0);
+      for (int i = 0; i < NUM_CELLS; i++) {
+        if (i > 0) m_table.PushRear(i, &m_cells[i - 1]);
+        if (i < NUM_CELLS - 1) m_table.PushRear(i, &m_cells[i + 1]);
+      }
+    }
+
+    std::vector<int> Neighborhood(int cell_id, int radius) const
+    {
+      const cNeighborhood neighborhood = m_table.GetNeighborhood(cell_id, radius);
+      std::vector<int> ids;
+      for (int i = 0; i < neighborhood.GetSize(); i++) ids.push_back(neighborhood.Get(i)->GetID());
+      return ids;
+    }
+
+    static std::vector<int> Cells(int count, const int* ids) { return std::vector<int>(ids, ids + count); }
+  };
+
+};
+
+
+TEST_F(ConnectionTableTest, NeighborhoodsByRadius)
+{
+  const int r1[] = { 3, 5 };
+  const int r2[] = { 2, 3, 5, 6 };
+  const int r3[] = { 1, 2, 3, 5, 6, 7 };
+  EXPECT_EQ(Cells(2, r1), Neighborhood(4, 1));
+  EXPECT_EQ(Cells(4, r2), Neighborhood(4, 2));
+  EXPECT_EQ(Cells(6, r3), Neighborhood(4, 3));
+
+  // Asking for a smaller radius after a larger one reads the same tables
+  EXPECT_EQ(Cells(2, r1), Neighborhood(4, 1));
+
+  const int end_r2[] = { 1, 2 };
+  EXPECT_EQ(Cells(2, end_r2), Neighborhood(0, 2));
+  EXPECT_EQ(NUM_CELLS - 1, (int)Neighborhood(0, NUM_CELLS).size());
+}
+
+
+TEST_F(ConnectionTableTest, PushFrontDiscardsNeighborhoods)
+{
+  const int before[] = { 1, 2 };
+  EXPECT_EQ(Cells(2, before), Neighborhood(0, 2));
+
+  m_table.PushFront(0, &m_cells[9]);
+  const int after_r1[] = { 1, 9 };
+  const int after_r2[] = { 1, 2, 8, 9 };
+  EXPECT_EQ(Cells(2, after_r1), Neighborhood(0, 1));
+  EXPECT_EQ(Cells(4, after_r2), Neighborhood(0, 2));
+}
+
+
+TEST_F(ConnectionTableTest, PushRearDiscardsNeighborhoods)
+{
+  const int before[] = { 8 };
+  EXPECT_EQ(Cells(1, before), Neighborhood(9, 1));
+
+  m_table.PushRear(9, &m_cells[0]);
+  const int after[] = { 0, 8 };
+  EXPECT_EQ(Cells(2, after), Neighborhood(9, 1));
+}
+
+
+TEST_F(ConnectionTableTest, RemoveDiscardsNeighborhoods)
+{
+  const int before[] = { 2, 3, 5, 6 };
+  EXPECT_EQ(Cells(4, before), Neighborhood(4, 2));
+
+  EXPECT_TRUE(m_table.Remove(4, &m_cells[5]));
+  const int after[] = { 2, 3 };
+  EXPECT_EQ(Cells(2, after), Neighborhood(4, 2));
+
+  // Removing a connection that is not there leaves the cache alone
+  EXPECT_FALSE(m_table.Remove(4, &m_cells[5]));
+  EXPECT_EQ(Cells(2, after), Neighborhood(4, 2));
+}
+
+
+TEST_F(ConnectionTableTest, ResizeClearDiscardsNeighborhoods)
+{
+  EXPECT_EQ(4, (int)Neighborhood(2, 2).size());
+
+  // Rewire the first four cells as a ring
+  m_table.ResizeClear(4, 2);
+  for (int i = 0; i < 4; i++) {
+    m_table.PushRear(i, &m_cells[(i + 3) % 4]);
+    m_table.PushRear(i, &m_cells[(i + 1) % 4]);
+  }
+  const int ring_r1[] = { 1, 3 };
+  const int ring_r2[] = { 0, 1, 3 };
+  EXPECT_EQ(Cells(2, ring_r1), Neighborhood(2, 1));
+  EXPECT_EQ(Cells(3, ring_r2), Neighborhood(2, 2));
+}
+
+
+TEST_F(ConnectionTableTest, NeighboringCellsIncludeTheCellWhenAPathLeadsBack)
+{
+  std::set<cPopulationCell*> cell_set;
+  m_cells[4].GetNeighboringCells(cell_set, 1);
+  EXPECT_EQ(2u, cell_set.size());
+  EXPECT_EQ(0u, cell_set.count(&m_cells[4]));
+
+  // Two steps reach 4 again by way of 3 or 5; the cached neighborhood still leaves it out
+  cell_set.clear();
+  m_cells[4].GetNeighboringCells(cell_set, 2);
+  EXPECT_EQ(5u, cell_set.size());
+  EXPECT_EQ(1u, cell_set.count(&m_cells[4]));
+  EXPECT_EQ(4, m_cells[4].GetNeighborhood(2).GetSize());
+
+  // With only one-way connections out of 0 there is no path back at any depth
+  m_table.Remove(1, &m_cells[0]);
+  cell_set.clear();
+  m_cells[0].GetNeighboringCells(cell_set, 3);
+  EXPECT_EQ(0u, cell_set.count(&m_cells[0]));
+  EXPECT_EQ(3u, cell_set.size());
+}
@@ -0,0 +1,236 @@
+/*
+ *  unittests/systematics/GenotypeArbiter.cc
+ *  avida-core
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/core/Context.h"
+#include "avida/core/Feedback.h"
+#include "avida/core/Genome.h"
+#include "avida/core/Properties.h"
+#include "avida/core/World.h"
+#include "avida/core/WorldDriver.h"
+#include "avida/data/Manager.h"
+#include "avida/data/Package.h"
+#include "avida/environment/Manager.h"
+#include "avida/systematics/Unit.h"
+
+#include "avida/private/systematics/Genotype.h"
+#include "avida/private/systematics/GenotypeArbiter.h"
+
+#include "apto/rng.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace Avida;
+using namespace Avida::Systematics;
+
+
+namespace {
+
+  const int NUM_GENOMES = 200;
+  const int NUM_UPDATES = 2500;  // several times GenotypeArbiter's stats rebuild interval
+  const int TARGET_POPULATION = 300;
+
+  class NullFeedback : public Feedback
+  {
+  public:
+    void Error(const char*, ...) { ; }
+    void Warning(const char*, ...) { ; }
+    void Notify(const char*, ...) { ; }
+  };
+
+  class NullDriver : public WorldDriver
+  {
+  private:
+    NullFeedback m_feedback;
+
+  public:
+    void Pause() { ; }
+    void Finish() { ; }
+    void Abort(AbortCondition) { ; }
+    Avida::Feedback& Feedback() { return m_feedback; }
+    void RegisterCallback(DriverCallback) { ; }
+  };
+
+  class TestUnit : public Unit
+  {
+  private:
+    Genome m_genome;
+    HashPropertyMap m_prop_map;
+
+  public:
+    TestUnit(const Genome& genome) : m_genome(genome) { ; }
+
+    Source UnitSource() const { return Source(DIVISION, ""); }
+    const Genome& UnitGenome() const { return m_genome; }
+    const PropertyMap& Properties() const { return m_prop_map; }
+  };
+
+  struct LiveUnit
+  {
+    UnitPtr unit;
+    GroupPtr group;
+    int genome;
+  };
+
+
+  // Runs a synthetic population through a GenotypeArbiter and recomputes the provided statistics from scratch every
+  // update, using the same definitions the arbiter's per-genotype pass used before its sums were made incremental
+  class GenotypeArbiterTest : public testing::Test
+  {
+  protected:
+    NullDriver m_driver;
+    Apto::RNG::AvidaRNG m_rng;
+    World m_world;
+    GenotypeArbiterPtr m_arbiter;
+
+    Apto::Array<Genome> m_genomes;
+    Apto::Array<int> m_counts;   // units per genome
+    Apto::Array<int> m_born;     // update the genome's current genotype was created
+    Apto::Array<LiveUnit> m_live;
+
+    GenotypeArbiterTest() : m_rng(1) { ; }
+
+    void SetUp()
+    {
+      Data::ManagerPtr(new Data::Manager)->AttachTo(&m_world);
+      Environment::ManagerPtr(new Environment::Manager)->AttachTo(&m_world);
+      m_arbiter = GenotypeArbiterPtr(new GenotypeArbiter(&m_world, "genotype", 3));
+
+      m_genomes.Resize(NUM_GENOMES);
+      for (int i = 0; i < NUM_GENOMES; i++) {
+        char seq[64];
+        const int length = genomeLength(i);
+        for (int j = 0; j < length; j++) seq[j] = (char)('a' + (i * 7 + j) % 26);
+        seq[length] = '\0';
+        m_genomes[i] = Genome(Apto::String("0,heads_default,") + seq);
+      }
+      m_counts.Resize(NUM_GENOMES);
+      m_counts.SetAll(0);
+      m_born.Resize(NUM_GENOMES);
+      m_born.SetAll(0);
+    }
+
+    void TearDown()
+    {
+      while (m_live.GetSize()) kill(0);
+      Context ctx(&m_driver, &m_rng);
+      m_arbiter->PerformUpdate(ctx, NUM_UPDATES);
+    }
+
+    static int genomeLength(int genome) { return 20 + genome % 30; }
+
+    void birth(int genome, int update)
+    {
+      const ClassificationHints* no_hints = NULL;
+      LiveUnit live;
+      live.unit = UnitPtr(new TestUnit(m_genomes[genome]));
+      live.group = m_arbiter->ClassifyNewUnit(live.unit, no_hints);
+      live.genome = genome;
+      m_live.Push(live);
+      if (m_counts[genome]++ == 0) m_born[genome] = update;
+    }
+
+    void kill(int idx)
+    {
+      m_live[idx].group->RemoveUnit();
+      m_counts[m_live[idx].genome]--;
+      m_live.Swap(idx, m_live.GetSize() - 1);
+      m_live.Resize(m_live.GetSize() - 1);
+    }
+
+    double provided(const Apto::String& name) const
+    {
+      return m_arbiter->GetProvidedValue(Apto::String("systematics.genotype.") + name)->DoubleValue();
+    }
+
+    // Compares an average and variance against the cDoubleSum style definitions over n, sum and sum of squares
+    void expectStat(const char* stat, double n, double s1, double s2, int update) const
+    {
+      const double ave = (n > 0.0) ? (s1 / n) : 0.0;
+      const double var = (n > 1.0) ? Apto::Max(0.0, (s2 - s1 * s1 / n) / (n - 1.0)) : 0.0;
+      const double var_scale = (n > 1.0) ? s2 / (n - 1.0) : 0.0;
+
+      EXPECT_NEAR(ave, provided(Apto::String("ave_") + stat), 1e-9 * (1.0 + fabs(ave))) << stat << " update " << update;
+      EXPECT_NEAR(var, provided(Apto::String("var_") + stat), 1e-9 * (1.0 + var_scale)) << stat << " update " << update;
+    }
+
+    void expectRebuiltStats(int update) const
+    {
+      double units = 0.0, groups = 0.0;
+      double age = 0.0, age2 = 0.0, u2 = 0.0, size = 0.0, size2 = 0.0;
+      for (int i = 0; i < NUM_GENOMES; i++) {
+        if (!m_counts[i]) continue;
+        const double u = m_counts[i];
+        const double a = update - m_born[i];
+        const double s = genomeLength(i);
+        units += u;
+        groups += 1.0;
+        age += u * a;
+        age2 += u * u * a * a;
+        u2 += u * u;
+        size += u * s;
+        size2 += (u * s) * (u * s);
+      }
+
+      double entropy = 0.0;
+      for (int i = 0; i < NUM_GENOMES; i++) {
+        if (!m_counts[i] || m_counts[i] == units) continue;
+        const double p = m_counts[i] / units;
+        entropy -= p * log(p);
+      }
+
+      EXPECT_EQ((int)groups, m_arbiter->GetProvidedValue("systematics.genotype.current")->IntValue()) << "update " << update;
+      expectStat("age", units, age, age2, update);
+      expectStat("abundance", groups, units, u2, update);
+      expectStat("size", units, size, size2, update);
+      EXPECT_NEAR(entropy, provided("entropy"), 1e-9 * (1.0 + entropy)) << "update " << update;
+    }
+  };
+
+};
+
+
+TEST_F(GenotypeArbiterTest, IncrementalStatsMatchRebuild)
+{
+  for (int update = 1; update <= NUM_UPDATES; update++) {
+    Context ctx(&m_driver, &m_rng);
+    m_arbiter->PerformUpdate(ctx, update - 1);
+
+    // Offspring mostly share a living parent's genome, occasionally mutating to one of the others
+    const int births = m_rng.GetUInt(20);
+    for (int i = 0; i < births; i++) {
+      if (m_live.GetSize() && m_rng.GetUInt(10) < 8) {
+        birth(m_live[m_rng.GetUInt(m_live.GetSize())].genome, update);
+      } else {
+        birth(m_rng.GetUInt(NUM_GENOMES), update);
+      }
+    }
+
+    // Deaths keep the population near its target size, with the occasional die off
+    int deaths = Apto::Max(0, m_live.GetSize() - TARGET_POPULATION) + m_rng.GetUInt(5);
+    if (update % 400 == 0) deaths = m_live.GetSize() - 5;
+    for (int i = 0; i < deaths && m_live.GetSize(); i++) kill(m_rng.GetUInt(m_live.GetSize()));
+
+    m_arbiter->UpdateProvidedValues(update);
+    expectRebuiltStats(update);
+  }
+}
@@ -0,0 +1,182 @@
+/*
+ *  unittests/viewer/OrganismTrace.cc
+ *  avida-core
+ *
+ *  Copyright 2012 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Authors: David M. Bryson <david@programerror.com>
+ *
+ */
+
+#include "avida/viewer/OrganismTrace.h"
+
+#include "avida/private/viewer/SnapshotDelta.h"
+
+#include "gtest/gtest.h"
+
+using namespace Avida;
+using namespace Avida::Viewer;
+
+
+namespace {
+
+  const int NUM_STEPS = 150;
+  const int KEYFRAME_INTERVAL = 16;
+  const int GENOME_LENGTH = 20;
+
+  // Builds one step of a synthetic trace of an organism copying itself.  Over the course of the trace registers, buffers
+  // and task counts change, buffers and functions are added, the genome has an instruction inserted and later one
+  // deleted, the offspring grows, disappears, returns under a new label and finally holds the divided offspring.
+  HardwareSnapshot* BuildStep(int step, HardwareSnapshot* prev)
+  {
+    HardwareSnapshot* snapshot = new HardwareSnapshot(3, prev);
+
+    snapshot->SetRegister(0, step);
+    snapshot->SetRegister(1, step / 3);
+    snapshot->SetRegister(2, 7);
+
+    Apto::Array<int> values(3);
+    values[0] = 1; values[1] = 2; values[2] = 3;
+    snapshot->AddBuffer("input", values);
+    values.Resize(2);
+    values[0] = step / 5; values[1] = 0;
+    snapshot->AddBuffer("output", values);
+    values.Resize(4);
+    values.SetAll(0);
+    values[step % 4] = step;
+    snapshot->AddBuffer("stack A", values);
+    if (step >= 30) {
+      values.SetAll(step / 7);
+      snapshot->AddBuffer("stack B", values);
+    }
+    snapshot->SetSelectedBuffer((step >= 30 && step % 2) ? "stack B" : "stack A");
+
+    snapshot->SetFunctionCount("not", step / 10);
+    snapshot->SetFunctionCount("nand", step / 25);
+    if (step >= 40) snapshot->SetFunctionCount("and", 1);
+
+    // Genome, with an instruction inserted at step 45 and another deleted at step 60
+    Apto::Array<Instruction> genome;
+    for (int i = 0; i < GENOME_LENGTH; i++) genome.Push(Instruction(i % 26));
+    if (step >= 45) {
+      genome.Push(Instruction(0));
+      for (int i = genome.GetSize() - 1; i > 10; i--) genome[i] = genome[i - 1];
+      genome[10] = Instruction(25);
+    }
+    if (step >= 60) {
+      for (int i = 3; i < genome.GetSize() - 1; i++) genome[i] = genome[i + 1];
+      genome.Resize(genome.GetSize() - 1);
+    }
+    Apto::Array<bool> mutated(genome.GetSize());
+    mutated.SetAll(false);
+    if (step >= 45) mutated[10] = true;
+    const int genome_space = snapshot->AddMemSpace("genome", genome, mutated);
+    snapshot->AddHead("IP", genome_space, step % genome.GetSize());
+    if (step < 20) snapshot->AddHead("READ", genome_space, step);
+
+    // Offspring, growing one instruction per step with every seventh copy mutated
+    if (step >= 5 && (step < 90 || step > 95)) {
+      const int length = (step > 95) ? step - 95 : step - 4;
+      Apto::Array<Instruction> offspring(length);
+      Apto::Array<bool> offspring_mutated(length);
+      for (int i = 0; i < length; i++) {
+        offspring[i] = genome[i % genome.GetSize()];
+        offspring_mutated[i] = (i % 7 == 0);
+      }
+      const int offspring_space = snapshot->AddMemSpace((step > 95) ? "offspring 2" : "offspring", offspring,
+                                                        offspring_mutated);
+      snapshot->AddHead("WRITE", offspring_space, length - 1);
+      if (step >= 20) snapshot->AddHead("READ", offspring_space, (length - 1) / 2);
+    }
+
+    snapshot->AddJump(0, (step + GENOME_LENGTH - 1) % GENOME_LENGTH, 0, step % GENOME_LENGTH);
+    if (step % 11 == 0) snapshot->AddJump(0, step % GENOME_LENGTH, 1, 0);
+    snapshot->SetNextInst(Instruction(step % 26));
+
+    if (step == NUM_STEPS - 1) snapshot->SetPostDivide();
+
+    return snapshot;
+  }
+
+
+  class SnapshotDeltaTest : public testing::Test
+  {
+  protected:
+    Apto::Array<HardwareSnapshot*> m_steps;
+
+    void SetUp()
+    {
+      HardwareSnapshot* prev = NULL;
+      for (int step = 0; step < NUM_STEPS; step++) {
+        prev = BuildStep(step, prev);
+        m_steps.Push(prev);
+      }
+    }
+
+    void TearDown()
+    {
+      for (int i = 0; i < m_steps.GetSize(); i++) delete m_steps[i];
+    }
+  };
+
+};
+
+
+TEST_F(SnapshotDeltaTest, SameSnapshotDetectsChanges)
+{
+  HardwareSnapshot copy(0);
+  copy = *m_steps[50];
+  EXPECT_TRUE(Private::SnapshotDelta::SameSnapshot(copy, *m_steps[50]));
+
+  copy.SetRegister(2, 8);
+  EXPECT_FALSE(Private::SnapshotDelta::SameSnapshot(copy, *m_steps[50]));
+
+  for (int step = 1; step < NUM_STEPS; step++) {
+    EXPECT_FALSE(Private::SnapshotDelta::SameSnapshot(*m_steps[step - 1], *m_steps[step])) << "step " << step;
+  }
+}
+
+
+TEST_F(SnapshotDeltaTest, DeltaAppliedToPreviousStep)
+{
+  for (int step = 1; step < NUM_STEPS; step++) {
+    Private::SnapshotDelta delta(*m_steps[step - 1], *m_steps[step]);
+    HardwareSnapshot rebuilt(0);
+    rebuilt = *m_steps[step - 1];
+    delta.ApplyTo(rebuilt);
+    EXPECT_TRUE(Private::SnapshotDelta::SameSnapshot(rebuilt, *m_steps[step])) << "step " << step;
+  }
+}
+
+
+TEST_F(SnapshotDeltaTest, KeyframeAndDeltasRebuildEveryStep)
+{
+  // Stored the way OrganismTrace stores a trace: full keyframes, with every other step as a delta from the one before
+  Apto::Array<Private::SnapshotDelta*> deltas(NUM_STEPS);
+  for (int step = 0; step < NUM_STEPS; step++) {
+    deltas[step] = (step % KEYFRAME_INTERVAL) ? new Private::SnapshotDelta(*m_steps[step - 1], *m_steps[step]) : NULL;
+  }
+
+  for (int step = 0; step < NUM_STEPS; step++) {
+    const int keyframe = step - step % KEYFRAME_INTERVAL;
+    HardwareSnapshot rebuilt(0);
+    rebuilt = *m_steps[keyframe];
+    for (int i = keyframe + 1; i <= step; i++) deltas[i]->ApplyTo(rebuilt);
+    EXPECT_TRUE(Private::SnapshotDelta::SameSnapshot(rebuilt, *m_steps[step])) << "step " << step;
+  }
+
+  for (int step = 0; step < NUM_STEPS; step++) delete deltas[step];
+}